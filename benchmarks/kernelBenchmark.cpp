@@ -0,0 +1,555 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      kernelBenchmark.cpp
+//! \brief     Micro-benchmarks of the solver kernels on synthetic cell states (no XML test case needed)
+//! \details   Each kernel is called on a set of samples (random states drawn with a fixed seed) during repeated timed passes.
+//!            The time per call of the passes gives the mean, standard deviation and minimum reported in ns/call,
+//!            the throughput (millions of calls per second) being computed with the mean.
+
+#include <functional>
+#include <iomanip>
+#include <random>
+#include "../src/Run.h"
+#include "../src/Relaxations/HeaderRelaxations.h"
+#include "../src/Meshes/ElementCartesian.h"
+#include "../src/Meshes/FaceCartesian.h"
+
+using namespace tinyxml2;
+
+//! \brief     Command-line settings of the benchmark
+struct BenchmarkSettings
+{
+  int samples     = 100000; //!< Number of kernel calls per timed pass
+  int repetitions = 20;     //!< Number of timed passes
+  std::string filter;       //!< Only kernels whose name contains this string are run
+  std::string output;       //!< CSV file for the results (optional)
+};
+
+volatile double sink(0.); //!< Receives kernel results so that the compiler cannot discard the calls
+
+//! \class     KernelTimer
+//! \brief     Times kernels over repeated passes and prints their statistics
+class KernelTimer
+{
+  public:
+    KernelTimer(const BenchmarkSettings& settings);
+    ~KernelTimer();
+
+    //! \brief     Return true if the kernel is selected by the filter of the settings
+    //! \param     name           kernel name
+    bool selected(const std::string& name) const;
+    //! \brief     Time a kernel: one untimed warm-up pass, then the timed passes
+    //! \param     name           kernel name (family/variant/function)
+    //! \param     calls          number of kernel calls in a pass
+    //! \param     pass           pass over the samples
+    //! \param     reset          restoration of the samples, run untimed before each pass (optional)
+    void time(const std::string& name, const int& calls, const std::function<void()>& pass, const std::function<void()>& reset = nullptr);
+
+  private:
+    const BenchmarkSettings& m_settings;
+    std::ofstream m_output; //!< CSV results file
+};
+
+//***********************************************************************
+
+KernelTimer::KernelTimer(const BenchmarkSettings& settings) : m_settings(settings)
+{
+  std::cout << std::left << std::setw(52) << "Kernel" << std::right << std::setw(12) << "ns/call" << std::setw(12) << "std dev" << std::setw(12)
+            << "min" << std::setw(14) << "Mcalls/s" << std::endl;
+  if (m_settings.output != "") {
+    m_output.open(m_settings.output.c_str(), std::ios::trunc);
+    m_output << "kernel,calls,repetitions,meanNs,stdDevNs,minNs,mcallsPerSecond" << std::endl;
+  }
+}
+
+//***********************************************************************
+
+KernelTimer::~KernelTimer() {}
+
+//***********************************************************************
+
+bool KernelTimer::selected(const std::string& name) const { return name.find(m_settings.filter) != std::string::npos; }
+
+//***********************************************************************
+
+void KernelTimer::time(const std::string& name, const int& calls, const std::function<void()>& pass, const std::function<void()>& reset)
+{
+  if (!this->selected(name)) return;
+
+  if (reset) reset();
+  pass();
+  std::vector<double> timePerCall(m_settings.repetitions);
+  for (int r = 0; r < m_settings.repetitions; r++) {
+    if (reset) reset();
+    double start(MPI_Wtime());
+    pass();
+    timePerCall[r] = (MPI_Wtime() - start) / calls * 1.e9;
+    errors.clear();
+    warnings.clear();
+  }
+
+  double mean(0.), variance(0.), minimum(timePerCall[0]);
+  for (int r = 0; r < m_settings.repetitions; r++) {
+    mean    += timePerCall[r] / m_settings.repetitions;
+    minimum  = std::min(minimum, timePerCall[r]);
+  }
+  for (int r = 0; r < m_settings.repetitions; r++) {
+    variance += (timePerCall[r] - mean) * (timePerCall[r] - mean) / m_settings.repetitions;
+  }
+  double stdDev(std::sqrt(variance)), throughput(1.e3 / mean);
+
+  std::cout << std::left << std::setw(52) << name << std::right << std::fixed << std::setprecision(2) << std::setw(12) << mean << std::setw(12)
+            << stdDev << std::setw(12) << minimum << std::setw(14) << throughput << std::endl;
+  if (m_output.is_open()) {
+    m_output << name << "," << calls << "," << m_settings.repetitions << "," << mean << "," << stdDev << "," << minimum << "," << throughput << std::endl;
+  }
+}
+
+//***********************************************************************
+
+//! \brief     Create an EOS with the parameters of a material of libEOS
+//! \param     type           EOS type (IG, SG or NASG)
+//! \param     name           material name
+//! \param     parameters     EOS parameters in the order of the libEOS files
+Eos* createEos(const std::string& type, const std::string& name, const std::vector<double>& parameters)
+{
+  static int number(0);
+  std::vector<std::string> nameParameters;
+  Eos* eos(nullptr);
+  if (type == "IG") {
+    eos = new EosIG(nameParameters, number);
+  }
+  else if (type == "SG") {
+    eos = new EosSG(nameParameters, number);
+  }
+  else {
+    eos = new EosNASG(nameParameters, number);
+  }
+  eos->assignParametersEos(name, parameters);
+  number++;
+  return eos;
+}
+
+//***********************************************************************
+
+//! \brief     Benchmark the EOS calls on (pressure, temperature) samples of the range of use of the material
+void benchmarkEos(KernelTimer& timer, Eos* eos, const std::string& type, const int& samples)
+{
+  std::mt19937 generator(2024);
+  std::uniform_real_distribution<double> pressureDist(1.e5, 1.e7), temperatureDist(290., 400.);
+  std::vector<double> density(samples), pressure(samples), energy(samples), temperature(samples);
+  for (int i = 0; i < samples; i++) {
+    pressure[i]    = pressureDist(generator);
+    temperature[i] = temperatureDist(generator);
+    density[i]     = eos->computeDensity(pressure[i], temperature[i]);
+    energy[i]      = eos->computeEnergy(density[i], pressure[i]);
+  }
+
+  std::string prefix("eos/" + type + "/");
+  timer.time(prefix + "computeTemperature", samples, [&]() {
+    double sum(0.);
+    for (int i = 0; i < samples; i++) sum += eos->computeTemperature(density[i], pressure[i]);
+    sink = sum;
+  });
+  timer.time(prefix + "computeEnergy", samples, [&]() {
+    double sum(0.);
+    for (int i = 0; i < samples; i++) sum += eos->computeEnergy(density[i], pressure[i]);
+    sink = sum;
+  });
+  timer.time(prefix + "computeSoundSpeed", samples, [&]() {
+    double sum(0.);
+    for (int i = 0; i < samples; i++) sum += eos->computeSoundSpeed(density[i], pressure[i]);
+    sink = sum;
+  });
+  timer.time(prefix + "computePressure", samples, [&]() {
+    double sum(0.);
+    for (int i = 0; i < samples; i++) sum += eos->computePressure(density[i], energy[i]);
+    sink = sum;
+  });
+  timer.time(prefix + "computeDensity", samples, [&]() {
+    double sum(0.);
+    for (int i = 0; i < samples; i++) sum += eos->computeDensity(pressure[i], temperature[i]);
+    sink = sum;
+  });
+}
+
+//***********************************************************************
+
+//! \brief     Benchmark a slope limiter on random pairs of slopes
+void benchmarkLimiter(KernelTimer& timer, Limiter* limiter, const std::string& name, const int& samples)
+{
+  std::mt19937 generator(2024);
+  std::uniform_real_distribution<double> slopeDist(-1., 1.);
+  std::vector<double> slope1(samples), slope2(samples);
+  for (int i = 0; i < samples; i++) {
+    slope1[i] = slopeDist(generator);
+    slope2[i] = slopeDist(generator);
+  }
+  timer.time("limiter/" + name + "/limiteSlope", samples, [&]() {
+    double sum(0.);
+    for (int i = 0; i < samples; i++) sum += limiter->limiteSlope(slope1[i], slope2[i]);
+    sink = sum;
+  });
+}
+
+//***********************************************************************
+
+//! \brief     Set the global model data (model, number of phases, tools) for a flow model
+//! \param     name           model name (Euler, UEq, PUEq, UEqTotEnergy or PTUEq)
+//! \param     phases         number of phases
+void setModel(const std::string& name, const int& phases)
+{
+  numberPhases     = phases;
+  numberSolids     = 0;
+  numberTransports = 0;
+  TB               = new Tools(numberPhases, numberSolids, numberTransports);
+  if (name == "Euler") {
+    model = new ModEuler(numberTransports);
+  }
+  else if (name == "UEq") {
+    model = new ModUEq(numberTransports, numberPhases);
+  }
+  else if (name == "PUEq") {
+    model = new ModPUEq(numberTransports, numberPhases);
+  }
+  else if (name == "UEqTotEnergy") {
+    model = new ModUEqTotEnergy(numberTransports, numberPhases);
+  }
+  else {
+    model = new ModPTUEq(numberTransports, numberPhases);
+  }
+}
+
+//***********************************************************************
+
+//! \brief     Release the global model data
+void unsetModel()
+{
+  destroy(model);
+  destroy(TB);
+}
+
+//***********************************************************************
+
+//! \brief     Allocate cells with random states of the current model
+//! \details   Pressure, temperature, volume fractions and velocity are drawn, densities follow from the EOS.
+//!            The phase pressures differ (up to 20 %) for the models without pressure equilibrium.
+//! \param     modelName      model name
+//! \param     eos            EOS of the phases
+//! \param     number         number of cells
+//! \param     seed           seed of the random states (same seed, same states)
+std::vector<Cell*> createCells(const std::string& modelName, const std::vector<Eos*>& eos, const int& number, const unsigned int& seed)
+{
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> pressureDist(1.e5, 1.e6), temperatureDist(290., 350.), alphaDist(0.05, 0.95), unitDist(-1., 1.);
+  bool pressureDisequilibrium(modelName == "UEq" || modelName == "UEqTotEnergy");
+  std::vector<AddPhys*> addPhys;
+  std::vector<Cell*> cells(number);
+  for (int i = 0; i < number; i++) {
+    cells[i] = new Cell;
+    cells[i]->allocate(addPhys);
+    double pressure(pressureDist(generator)), temperature(temperatureDist(generator)), alpha(alphaDist(generator));
+    double velocity(50. * unitDist(generator));
+    for (int k = 0; k < numberPhases; k++) {
+      double pressureK(pressure);
+      if (pressureDisequilibrium) pressureK *= 1. + 0.2 * unitDist(generator);
+      Phase* phase(cells[i]->getPhase(k));
+      phase->setEos(eos[k]);
+      if (numberPhases > 1) phase->setAlpha((k == 0) ? alpha : (1. - alpha) / (numberPhases - 1));
+      phase->setPressure(pressureK);
+      phase->setDensity(eos[k]->computeDensity(pressureK, temperature));
+      phase->setVelocity(velocity, 0., 0.);
+    }
+    cells[i]->getMixture()->setVelocity(velocity, 0., 0.);
+    if (modelName == "PTUEq") {
+      cells[i]->getMixture()->setPressure(pressure);
+      cells[i]->getMixture()->setTemperature(temperature);
+    }
+    cells[i]->allocateEos();
+    cells[i]->fulfillState();
+  }
+  return cells;
+}
+
+//***********************************************************************
+
+//! \brief     Release cells
+void deleteCells(std::vector<Cell*>& cells)
+{
+  for (unsigned int i = 0; i < cells.size(); i++) {
+    delete cells[i];
+  }
+  cells.clear();
+}
+
+//***********************************************************************
+
+//! \brief     Benchmark the cell-to-cell Riemann solver, the state completion and the conservative/primitive conversions of a model
+void benchmarkModel(KernelTimer& timer, const std::string& name, const std::vector<Eos*>& eos, const int& samples)
+{
+  std::string prefix("model/" + name + "/");
+  if (!timer.selected(prefix)) return;
+  setModel(name, eos.size());
+  std::vector<Cell*> cells(createCells(name, eos, samples + 1, 2024));
+
+  std::vector<double> boundData(VarBoundary::SIZE, 0.);
+  double dx(1.e-3);
+  timer.time(prefix + "solveRiemannIntern", samples, [&]() {
+    double dtMax(1.e10);
+    for (int i = 0; i < samples; i++) model->solveRiemannIntern(*cells[i], *cells[i + 1], dx, dx, dtMax, boundData);
+    sink = dtMax;
+  });
+  timer.time(prefix + "fulfillState", samples, [&]() {
+    for (int i = 0; i < samples; i++) cells[i]->fulfillState();
+  });
+  timer.time(prefix + "buildCons", samples, [&]() {
+    for (int i = 0; i < samples; i++) cells[i]->getCons()->buildCons(cells[i]->getPhases(), cells[i]->getMixture());
+  });
+  timer.time(prefix + "buildPrim", samples, [&]() {
+    for (int i = 0; i < samples; i++) cells[i]->getCons()->buildPrim(cells[i]->getPhases(), cells[i]->getMixture());
+  });
+
+  deleteCells(cells);
+  unsetModel();
+}
+
+//***********************************************************************
+
+//! \brief     Benchmark a relaxation procedure (velocity-equilibrium model) on out-of-equilibrium states, restored before each pass
+void benchmarkRelaxation(KernelTimer& timer, Relaxation* relaxation, const std::string& name, const std::vector<Eos*>& eos, const int& samples)
+{
+  std::string kernelName("relaxation/UEq/" + name + "/relaxation");
+  if (!timer.selected(kernelName)) {
+    delete relaxation;
+    return;
+  }
+  setModel("UEq", eos.size());
+  std::vector<Cell*> cells(createCells("UEq", eos, samples, 2024)), initialCells(createCells("UEq", eos, samples, 2024));
+  if (relaxation->getType() == TypeRelax::PTMU) static_cast<RelaxationPTMu*>(relaxation)->initializeCriticalPressure(cells[0]);
+
+  double dt(1.e-6);
+  timer.time(
+    kernelName,
+    samples,
+    [&]() {
+      for (int i = 0; i < samples; i++) relaxation->relaxation(cells[i], dt);
+    },
+    [&]() {
+      for (int i = 0; i < samples; i++) {
+        for (int k = 0; k < numberPhases; k++) {
+          cells[i]->copyPhase(k, initialCells[i]->getPhase(k));
+        }
+        cells[i]->copyMixture(initialCells[i]->getMixture());
+      }
+    });
+
+  delete relaxation;
+  deleteCells(cells);
+  deleteCells(initialCells);
+  unsetModel();
+}
+
+//***********************************************************************
+
+//! \brief     Benchmark the Green-Gauss gradients (phase temperatures and velocity, as for conductivity and viscosity) on a 2D Cartesian block
+void benchmarkGradient(KernelTimer& timer, const std::vector<Eos*>& eos, const int& samples)
+{
+  std::string kernelName("gradient/GreenGauss/computeGradients");
+  if (!timer.selected(kernelName)) return;
+  setModel("UEq", eos.size());
+  int n(std::max(2, static_cast<int>(std::sqrt(static_cast<double>(samples)))));
+  std::vector<Cell*> cells(createCells("UEq", eos, n * n, 2024));
+  double dx(1.e-3);
+
+  //1) Cartesian geometry of the cells
+  //----------------------------------
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < n; i++) {
+      Cell* cell(cells[j * n + i]);
+      cell->setElement(new ElementCartesian(), j * n + i);
+      cell->getElement()->setVolume(dx * dx);
+      cell->getElement()->setLCFL(0.6 * dx);
+      cell->getElement()->setPos((i + 0.5) * dx, (j + 0.5) * dx, 0.);
+      cell->getElement()->setSize(dx, dx, 1.);
+    }
+  }
+
+  //2) Inner interfaces in both directions
+  //--------------------------------------
+  std::vector<CellInterface*> cellInterfaces;
+  Coord normal, tangent, binormal(0., 0., 1.);
+  for (int direction = 0; direction < 2; direction++) {
+    normal.setXYZ(1. - direction, static_cast<double>(direction), 0.);
+    tangent.setXYZ(-static_cast<double>(direction), 1. - direction, 0.);
+    for (int j = 0; j < n - direction; j++) {
+      for (int i = 0; i < n - 1 + direction; i++) {
+        Cell* cellLeft(cells[j * n + i]);
+        Cell* cellRight(cells[(j + direction) * n + i + 1 - direction]);
+        FaceCartesian* face(new FaceCartesian());
+        face->initializeOthers(dx, normal, tangent, binormal);
+        face->setSize(direction * dx, (1. - direction) * dx, 1.);
+        face->setPos((i + 1. - 0.5 * direction) * dx, (j + 0.5 + 0.5 * direction) * dx, 0.);
+        cellInterfaces.push_back(new CellInterface);
+        cellInterfaces.back()->setFace(face);
+        cellInterfaces.back()->initialize(cellLeft, cellRight);
+        cellLeft->addCellInterface(cellInterfaces.back());
+        cellRight->addCellInterface(cellInterfaces.back());
+      }
+    }
+  }
+
+  //3) Gradients of the conductivity and viscosity quantities
+  //---------------------------------------------------------
+  GradientGreenGauss greenGauss;
+  std::vector<Variable> variables = {Variable::temperature, Variable::temperature, Variable::velocityU, Variable::velocityV, Variable::velocityW};
+  std::vector<int> phases         = {0, 1, 0, 0, 0};
+  std::vector<Coord> grads(variables.size());
+  int calls(n * n);
+  timer.time(kernelName, calls, [&]() {
+    double sum(0.);
+    for (int c = 0; c < calls; c++) {
+      greenGauss.computeGradients(cells[c], grads, variables, phases);
+      sum += grads[0].getX();
+    }
+    sink = sum;
+  });
+
+  for (unsigned int b = 0; b < cellInterfaces.size(); b++) {
+    delete cellInterfaces[b];
+  }
+  deleteCells(cells);
+  unsetModel();
+}
+
+//***********************************************************************
+
+//! \brief     Print the command-line help
+void usage(const char* executable)
+{
+  std::cout << "Usage: " << executable << " [-n samples] [-r repetitions] [-f filter] [-o file.csv]" << std::endl
+            << "  -n  number of kernel calls per timed pass (default: 100000)" << std::endl
+            << "  -r  number of timed passes (default: 20)" << std::endl
+            << "  -f  only run the kernels whose name contains the filter, e.g. eos/SG or solveRiemannIntern" << std::endl
+            << "  -o  also write the results in a CSV file" << std::endl;
+}
+
+//***********************************************************************
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+  rankCpu = 0;
+  Ncpu    = 1;
+
+  //1) Settings
+  //-----------
+  BenchmarkSettings settings;
+  for (int a = 1; a < argc; a++) {
+    std::string option(argv[a]);
+    if (option == "-h" || a + 1 >= argc) {
+      usage(argv[0]);
+      MPI_Finalize();
+      return (option == "-h") ? 0 : 1;
+    }
+    std::string value(argv[++a]);
+    if (option == "-n") {
+      settings.samples = std::max(1, std::atoi(value.c_str()));
+    }
+    else if (option == "-r") {
+      settings.repetitions = std::max(1, std::atoi(value.c_str()));
+    }
+    else if (option == "-f") {
+      settings.filter = value;
+    }
+    else if (option == "-o") {
+      settings.output = value;
+    }
+    else {
+      usage(argv[0]);
+      MPI_Finalize();
+      return 1;
+    }
+  }
+  std::cout << "ECOGEN kernel benchmark: " << settings.samples << " calls per pass, " << settings.repetitions << " passes" << std::endl;
+
+  //2) Materials (parameters of libEOS: IG_air, SG_water, NASG_waterLiq, SG_waterLiq and IG_waterVap)
+  //---------------------------------------------------------------------------------------------------
+  Eos* air(createEos("IG", "IG_air", {1.4, 717.46, 0., 0.}));
+  Eos* water(createEos("SG", "SG_water", {4.4, 6.e8, 1000., 0., 0.}));
+  Eos* waterNASG(createEos("NASG", "NASG_waterLiq", {1.19, 7028.e5, 6.61e-4, 3610., -1177788., 0.}));
+  Eos* waterLiquid(createEos("SG", "SG_waterLiq", {3.423, 8.99e8, 1231.2, -1.15e6, 0.}));
+  Eos* waterVapor(createEos("IG", "IG_waterVap", {1.358, 1247., 1.97e6, -3.56e4}));
+  air->assignEpsilonForAlphaNull(false);
+
+  //3) Kernels
+  //----------
+  KernelTimer timer(settings);
+  benchmarkEos(timer, air, "IG", settings.samples);
+  benchmarkEos(timer, water, "SG", settings.samples);
+  benchmarkEos(timer, waterNASG, "NASG", settings.samples);
+
+  LimiterMinmod minmod;
+  LimiterVanLeer vanLeer;
+  LimiterVanAlbada vanAlbada;
+  LimiterSuperBee superBee;
+  LimiterMC mc;
+  benchmarkLimiter(timer, &minmod, "minmod", settings.samples);
+  benchmarkLimiter(timer, &vanLeer, "vanleer", settings.samples);
+  benchmarkLimiter(timer, &vanAlbada, "vanalbada", settings.samples);
+  benchmarkLimiter(timer, &superBee, "superbee", settings.samples);
+  benchmarkLimiter(timer, &mc, "mc", settings.samples);
+
+  benchmarkModel(timer, "Euler", {air}, settings.samples);
+  benchmarkModel(timer, "UEq", {air, water}, settings.samples);
+  benchmarkModel(timer, "PUEq", {air, water}, settings.samples);
+  benchmarkModel(timer, "UEqTotEnergy", {air, water}, settings.samples);
+  benchmarkModel(timer, "PTUEq", {waterLiquid, waterVapor}, settings.samples);
+
+  benchmarkRelaxation(timer, new RelaxationPInfinite(), "PInfinite", {air, water}, settings.samples);
+  benchmarkRelaxation(timer, new RelaxationPT(), "PT", {air, water}, settings.samples);
+  XMLDocument xmlRelaxation;
+  xmlRelaxation.Parse("<relaxation type=\"PTMu\"><dataPTMu liquid=\"SG_waterLiq\" vapor=\"IG_waterVap\"/></relaxation>");
+  benchmarkRelaxation(timer,
+                      new RelaxationPTMu(xmlRelaxation.FirstChildElement("relaxation"), {"SG_waterLiq", "IG_waterVap"}, "kernelBenchmark"),
+                      "PTMu",
+                      {waterLiquid, waterVapor},
+                      settings.samples);
+
+  benchmarkGradient(timer, {air, water}, settings.samples);
+
+  delete air;
+  delete water;
+  delete waterNASG;
+  delete waterLiquid;
+  delete waterVapor;
+  MPI_Finalize();
+  return 0;
+}
@@ -0,0 +1,500 @@
+#!/bin/bash
+#set -e # Exit with nonzero exit code if anything fails
+
+# -------------------------------------------------------------------------
+#
+# Configuration for performance benchmarks
+#
+# Arguments: see error handling
+#
+# Assigns global variables:
+#   BENCH_WORK_DIR - work folder in which the benchmark cases are run
+#   BENCH_RESULTS - file collecting the results of the current session
+#
+# Creates:
+#   folders of <history_file> and <baseline_file>
+#
+# Returns:  0 for success, 1 for failure
+#
+# Examples:
+#   configure_benchmark ./ECOGEN nonreg/benchmark/history.csv nonreg/benchmark/baseline.csv
+#
+# -------------------------------------------------------------------------
+configure_benchmark() {
+
+  local n=3
+
+  if [ $# != $n ]
+  then
+    echo ""
+    echo "configure_benchmark: Missing arguments."
+    echo "    Expects $n args:"
+    echo "         <executable> - ECOGEN executable to benchmark"
+    echo "         <history_file> - CSV file in which the results are appended"
+    echo "         <baseline_file> - CSV file with the reference results"
+    echo ""
+    return 1
+  fi
+
+  if [ ! -x "$1" ]
+  then
+    echo "Error: executable $1 not found (build ECOGEN first)."
+    return 1
+  fi
+
+  mkdir -p "$(dirname "$2")" "$(dirname "$3")"
+
+  BENCH_WORK_DIR="$(pwd)/nonreg/benchmark/work"
+  BENCH_RESULTS="$(pwd)/nonreg/benchmark/session.csv"
+  rm -f "$BENCH_RESULTS"
+}
+
+# -------------------------------------------------------------------------
+#
+# Prepare the work folder of a benchmark case: libraries linked, case
+# copied with a time control forced to <iterations> iterations (outputs
+# only at the first and last iterations).
+#
+# Arguments: see error handling
+#
+# Uses global variables:
+#   BENCH_WORK_DIR - work folder in which the benchmark cases are run
+#
+# Returns:  0 for success, 1 for failure, 2 if the case cannot be run here
+#
+# Examples:
+#   prepare_case ./nonreg/nonregTests/euler/1D/shockTubes/HPRight/ 2000
+#
+# -------------------------------------------------------------------------
+prepare_case() {
+
+  local n=2
+
+  if [ $# != $n ]
+  then
+    echo ""
+    echo "prepare_case: Missing arguments."
+    echo "    Expects $n args:"
+    echo "         <test_case> - folder of the test case"
+    echo "         <iterations> - number of iterations to compute"
+    echo ""
+    return 1
+  fi
+
+  local test_case iterations
+  test_case="$1"
+  iterations="$2"
+
+  if [ ! -f "$test_case/main.xml" ]
+  then
+    echo "Error: $test_case is not a test case folder."
+    return 1
+  fi
+
+  #Unstructured meshes are not versioned: they must be generated beforehand with Gmsh
+  local mesh_file
+  mesh_file=$(sed -n 's:.*<file *name *= *"\([^"]*\)".*:\1:p' "$test_case/mesh.xml")
+  if [ -n "$mesh_file" ] && [ ! -f "$mesh_file" ]
+  then
+    echo "WARNING: mesh file $mesh_file not found (to generate with Gmsh). Case skipped."
+    return 2
+  fi
+
+  rm -Rf "$BENCH_WORK_DIR"
+  mkdir -p "$BENCH_WORK_DIR/case"
+  ln -s "$(pwd)/libEOS" "$BENCH_WORK_DIR/libEOS"
+  ln -s "$(pwd)/libMeshes" "$BENCH_WORK_DIR/libMeshes"
+  cp "$test_case"/*.xml "$BENCH_WORK_DIR/case/"
+
+  #Fixed number of iterations
+  local main_xml="$BENCH_WORK_DIR/case/main.xml"
+  if ! grep -q "<iterations " "$main_xml"
+  then
+    sed -i.bak -e "s:\(<timeControlMode[^>]*>\):\1<iterations number=\"0\" iterFreq=\"0\"/>:" "$main_xml"
+  fi
+  sed -i.bak -e "s:<timeControlMode[^>]*>:<timeControlMode iterations=\"true\">:" \
+             -e "s:<iterations [^>]*/>:<iterations number=\"$iterations\" iterFreq=\"$iterations\"/>:" "$main_xml"
+  rm -f "$main_xml.bak"
+
+  cat > "$BENCH_WORK_DIR/ECOGEN.xml" << EOF
+<?xml version = "1.0" encoding = "UTF-8" standalone = "yes"?>
+<ecogen>
+  <testCase>./case/</testCase>
+</ecogen>
+EOF
+}
+
+# -------------------------------------------------------------------------
+#
+# Run a prepared benchmark case and append its performance summary
+# (results/<run>/performance.out) to the session and history files.
+#
+# Arguments: see error handling
+#
+# Uses global variables:
+#   BENCH_WORK_DIR - work folder in which the benchmark cases are run
+#   BENCH_RESULTS - file collecting the results of the current session
+#   MPIRUN - MPI launcher command (default: mpirun)
+#
+# Returns:  0 for success, 1 for failure
+#
+# Examples:
+#   run_case ./ECOGEN ./nonreg/nonregTests/euler/1D/shockTubes/HPRight/ 1 history.csv
+#
+# -------------------------------------------------------------------------
+run_case() {
+
+  local n=4
+
+  if [ $# != $n ]
+  then
+    echo ""
+    echo "run_case: Missing arguments."
+    echo "    Expects $n args:"
+    echo "         <executable> - ECOGEN executable to benchmark"
+    echo "         <test_case> - folder of the test case (used as case identifier)"
+    echo "         <ncpu> - number of CPUs"
+    echo "         <history_file> - CSV file in which the results are appended"
+    echo ""
+    return 1
+  fi
+
+  local executable test_case ncpu history_file
+  executable="$(cd "$(dirname "$1")" && pwd)/$(basename "$1")"
+  test_case="$2"
+  ncpu="$3"
+  history_file="$4"
+
+  if ! $MPIRUN -np "$ncpu" "$executable" "$BENCH_WORK_DIR/" < /dev/null > "$BENCH_WORK_DIR/output.out" 2>&1
+  then
+    echo "Error: run failed (see $BENCH_WORK_DIR/output.out)."
+    return 1
+  fi
+
+  local run_name performance_file
+  run_name=$(sed -n 's:.*<run>\(.*\)</run>.*:\1:p' "$BENCH_WORK_DIR/case/main.xml")
+  performance_file="$BENCH_WORK_DIR/results/$run_name/performance.out"
+  if [ ! -f "$performance_file" ]
+  then
+    echo "Error: $performance_file not found."
+    return 1
+  fi
+
+  local date_value commit_value
+  date_value="$(date +%Y-%m-%dT%H:%M:%S)"
+  commit_value="$(git rev-parse --short HEAD 2> /dev/null)"
+  for file in "$BENCH_RESULTS" "$history_file"
+  do
+    if ! append_results "$file" "$performance_file" "$date_value" "$commit_value" "$test_case"
+    then
+      echo "Error: results could not be appended to $file."
+      return 1
+    fi
+  done
+
+  awk '$1 == "cellIterationsPerSecond" || $1 == "computationTime" || $1 == "peakMemoryMaxCPU_kB" { printf "    %s = %s\n", $1, $2 }' "$performance_file"
+}
+
+# -------------------------------------------------------------------------
+#
+# Append the values of a performance summary to a CSV file, the columns
+# being keyed by metric name: the keys of performance.out depend on the
+# case and on the ECOGEN version, so a key missing from the header adds a
+# column (left empty in the previous lines) and a key missing from the
+# summary leaves its column empty.
+#
+# Arguments: see error handling
+#
+# Returns:  0 for success, 1 for failure
+#
+# Examples:
+#   append_results history.csv results/HPRight/performance.out 2024-01-01T00:00:00 1a2b3c4 ./nonreg/nonregTests/euler/1D/shockTubes/HPRight/
+#
+# -------------------------------------------------------------------------
+append_results() {
+
+  local n=5
+
+  if [ $# != $n ]
+  then
+    echo ""
+    echo "append_results: Missing arguments."
+    echo "    Expects $n args:"
+    echo "         <csv_file> - CSV file in which the results are appended"
+    echo "         <performance_file> - performance summary (\"key value\" lines)"
+    echo "         <date> - date of the run"
+    echo "         <commit> - commit of the executable"
+    echo "         <test_case> - case identifier"
+    echo ""
+    return 1
+  fi
+
+  local csv_file previous_file
+  csv_file="$1"
+  previous_file="$csv_file"
+  if [ ! -s "$csv_file" ]
+  then
+    previous_file=/dev/null
+  fi
+
+  awk -F, -v date="$3" -v commit="$4" -v testCase="$5" '
+    #Performance summary: keys in their order, values keyed by name
+    FNR == NR { split($0, pair, " "); key[++numberKeys] = pair[1]; value[pair[1]] = pair[2]; next }
+    #Previous CSV file: header, then lines kept as is
+    FNR == 1 { for (i = 1; i <= NF; i++) { column[++numberColumns] = $i; known[$i] = 1 }; next }
+    { line[++numberLines] = $0; fields[numberLines] = NF }
+    END {
+      if (numberColumns == 0) {
+        column[1] = "date"; column[2] = "commit"; column[3] = "case"; numberColumns = 3
+        known["date"] = known["commit"] = known["case"] = 1
+      }
+      for (k = 1; k <= numberKeys; k++) {
+        if (!(key[k] in known)) { column[++numberColumns] = key[k]; known[key[k]] = 1 }
+      }
+      value["date"] = date; value["commit"] = commit; value["case"] = testCase
+      for (i = 1; i <= numberColumns; i++) printf "%s%s", (i > 1 ? "," : ""), column[i]
+      printf "\n"
+      #Previous lines padded with empty values for the new columns
+      for (l = 1; l <= numberLines; l++) {
+        printf "%s", line[l]
+        for (i = fields[l] + 1; i <= numberColumns; i++) printf ","
+        printf "\n"
+      }
+      for (i = 1; i <= numberColumns; i++) printf "%s%s", (i > 1 ? "," : ""), value[column[i]]
+      printf "\n"
+    }' "$2" "$previous_file" > "$csv_file.tmp" && mv "$csv_file.tmp" "$csv_file"
+}
+
+# -------------------------------------------------------------------------
+#
+# Compare the results of the current session to the baseline: throughput
+# (cells x iterations per second) and peak memory of each case and CPU
+# number present in both files.
+#
+# Arguments: see error handling
+#
+# Uses global variables:
+#   BENCH_RESULTS - file collecting the results of the current session
+#
+# Returns:  0 for success, 1 if a regression is detected
+#
+# Examples:
+#   compare_to_baseline nonreg/benchmark/baseline.csv 10 10
+#
+# -------------------------------------------------------------------------
+compare_to_baseline() {
+
+  local n=3
+
+  if [ $# != $n ]
+  then
+    echo ""
+    echo "compare_to_baseline: Missing arguments."
+    echo "    Expects $n args:"
+    echo "         <baseline_file> - CSV file with the reference results"
+    echo "         <throughput_tolerance> - allowed throughput decrease (%)"
+    echo "         <memory_tolerance> - allowed peak memory increase (%)"
+    echo ""
+    return 1
+  fi
+
+  if [ ! -s "$1" ]
+  then
+    echo "No baseline $1: nothing to compare (use -s to save one)."
+    return 0
+  fi
+
+  awk -F, -v tolT="$2" -v tolM="$3" '
+    #Column indices from each header, reference values keyed by case and CPU number
+    FNR == 1 { for (i = 1; i <= NF; i++) col[$i] = i; next }
+    {
+      key = $(col["case"]) " " $(col["numberCPUs"])
+      if (FILENAME == ARGV[1]) {
+        refT[key] = $(col["cellIterationsPerSecond"])
+        refM[key] = $(col["peakMemoryMaxCPU_kB"])
+        next
+      }
+      if (!(key in refT)) { printf "  %-70s no baseline\n", key; next }
+      t = $(col["cellIterationsPerSecond"]); m = $(col["peakMemoryMaxCPU_kB"])
+      dT = (refT[key] > 0) ? 100. * (t - refT[key]) / refT[key] : 0.
+      dM = (refM[key] > 0) ? 100. * (m - refM[key]) / refM[key] : 0.
+      status = "OK"
+      if (dT < -tolT || dM > tolM) { status = "REGRESSION"; regression = 1 }
+      printf "  %-70s throughput %+7.1f %%  memory %+7.1f %%  %s\n", key, dT, dM, status
+    }
+    END { exit regression }' "$1" "$BENCH_RESULTS"
+}
+
+# -------------------------------------------------------------------------
+#
+# Print help for main program.
+#
+# -------------------------------------------------------------------------
+usage() {
+  echo ""
+  echo "Usage: $(basename "$0") [-d] [-s] [-l test_list] [-e executable] [-b baseline_file] [-H history_file] [-t tolerance] [-m tolerance]"
+  echo ""
+  echo "    Run the performance benchmark cases at fixed iteration counts, append"\
+       " the results to a history file and compare them to a baseline."
+  echo ""
+  echo "        -d dry-run mode."
+  echo "        -s save the results of this session as the new baseline."
+  echo "        -l <test_list> path and name of file with benchmark list."\
+       " Defaults to './nonreg/ECOGEN_benchmark.list'."
+  echo "        -e <executable> ECOGEN executable. Defaults to './ECOGEN'."
+  echo "        -b <baseline_file> reference results. Defaults to './nonreg/benchmark/baseline.csv'."
+  echo "        -H <history_file> results history. Defaults to './nonreg/benchmark/history.csv'."
+  echo "        -t <tolerance> allowed throughput decrease in %. Defaults to 10."
+  echo "        -m <tolerance> allowed peak memory increase in %. Defaults to 10."
+  echo ""
+  echo "    The MPI launcher can be set with the MPIRUN environment variable"\
+       " (default: 'mpirun')."
+  echo ""
+}
+
+# -------------------------------------------------------------------------
+#
+# Main benchmark script when called from command line.
+#
+# -------------------------------------------------------------------------
+main() {
+  error=0
+  DRY_RUN=false
+  save_baseline=false
+  MPIRUN=${MPIRUN:=mpirun}
+
+  # Parse command line options
+  while getopts ':hdsl:e:b:H:t:m:' OPTION; do
+    case "$OPTION" in
+      l)
+        test_list_file=$OPTARG
+        ;;
+      e)
+        executable=$OPTARG
+        ;;
+      b)
+        baseline_file=$OPTARG
+        ;;
+      H)
+        history_file=$OPTARG
+        ;;
+      t)
+        throughput_tolerance=$OPTARG
+        ;;
+      m)
+        memory_tolerance=$OPTARG
+        ;;
+      s)
+        save_baseline=true
+        ;;
+      d)
+        DRY_RUN=true
+        ;;
+      h)
+        usage
+        exit 0
+        ;;
+      \?)
+        echo ""
+        echo "Error: Illegal option -$OPTARG"
+        usage
+        exit 1
+        ;;
+      :)
+        echo ""
+        echo "Error: Option -$OPTARG requires an argument"
+        usage
+        exit 1
+        ;;
+    esac
+  done
+
+  # Assign default values if parameters are unset
+  test_list_file=${test_list_file:="./nonreg/ECOGEN_benchmark.list"}
+  executable=${executable:="./ECOGEN"}
+  baseline_file=${baseline_file:="./nonreg/benchmark/baseline.csv"}
+  history_file=${history_file:="./nonreg/benchmark/history.csv"}
+  throughput_tolerance=${throughput_tolerance:=10}
+  memory_tolerance=${memory_tolerance:=10}
+
+  if ! configure_benchmark "$executable" "$history_file" "$baseline_file"
+  then
+    exit 1
+  fi
+
+  # Run each case for each CPU number
+  while read -r test_case iterations cpus
+  do
+    case "$test_case" in
+      ""|\#*) continue ;;
+    esac
+    for ncpu in $cpus
+    do
+      echo "Benchmark $test_case ($iterations iterations, $ncpu CPU)..."
+      if [ "$DRY_RUN" = "true" ]; then
+        echo "dry-run: $MPIRUN -np $ncpu $executable $BENCH_WORK_DIR/"
+        continue
+      fi
+      prepare_case "$test_case" "$iterations"
+      case "$?" in
+        0) ;;
+        2) continue ;;
+        *) error=1; continue ;;
+      esac
+      if ! run_case "$executable" "$test_case" "$ncpu" "$history_file"
+      then
+        error=1
+      fi
+    done
+  done < "$test_list_file"
+  rm -Rf "$BENCH_WORK_DIR"
+
+  if [ "$DRY_RUN" = "true" ] || [ ! -s "$BENCH_RESULTS" ]; then
+    exit "$error"
+  fi
+
+  # Comparison to the baseline, or new baseline
+  echo ""
+  echo "Comparison to baseline $baseline_file (tolerances: throughput -$throughput_tolerance %, memory +$memory_tolerance %):"
+  if ! compare_to_baseline "$baseline_file" "$throughput_tolerance" "$memory_tolerance"
+  then
+    echo "Error: performance regression detected."
+    error=1
+  fi
+  if [ "$save_baseline" = "true" ]; then
+    if cp "$BENCH_RESULTS" "$baseline_file"
+    then
+      echo "Results saved as new baseline: $baseline_file"
+    else
+      error=1
+    fi
+  fi
+  rm -f "$BENCH_RESULTS"
+
+  # Sending error code if something went wrong
+  exit "$error"
+}
+
+# -------------------------------------------------------------------------
+#
+# Definition of two usages for current script file:
+#
+#     - the file can be sourced to load the defined functions and allow
+#       individual function call
+#
+#     - the file can be executed as a script to run the benchmarks
+#
+# Examples:
+#   source "./nonreg/benchmark.sh"
+#   ./nonreg/benchmark.sh -h
+#   ./nonreg/benchmark.sh -s
+#   MPIRUN="mpirun --oversubscribe" ./nonreg/benchmark.sh -t 5 -l my_benchmark.list
+#
+# -------------------------------------------------------------------------
+
+# Do not call the main function when we source the .sh file
+if [ "$0" = "${BASH_SOURCE[0]}" ]
+then
+  # Script call from command line: execute the main func
+  main "$@"
+fi
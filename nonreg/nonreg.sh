@@ -558,7 +558,7 @@ check_and_clean() {
 
   echo "Exclude list: $EXCLUDE_LIST"
 
-  cmd="diff --ignore-blank-lines --ignore-space-change "$EXCLUDE_LIST" -x "$TEST_OUTPUTS" -qr -x 'infoCalcul.out' -x '.DS_Store' "$REPORT_DIR"/results_reference "$REPORT_DIR"/results_validation > $REPORT_DIR/diff_nonreg.out 2>&1 || true"
+  cmd="diff --ignore-blank-lines --ignore-space-change "$EXCLUDE_LIST" -x "$TEST_OUTPUTS" -qr -x 'infoCalcul.out' -x 'performance.out' -x '.DS_Store' "$REPORT_DIR"/results_reference "$REPORT_DIR"/results_validation > $REPORT_DIR/diff_nonreg.out 2>&1 || true"
 
   # Here the run_cmd script fails for normal mode due to the combination of output redirection and
   # protected arguments passed to 'eval' ('\$*')
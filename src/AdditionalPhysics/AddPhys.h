@@ -114,12 +114,25 @@ class AddPhys
     //! \brief     Send back true if the reinitialization of the color function is activated
     virtual bool reinitializationActivated() { return false; };
 
-    //! \brief     Communication of the additional physics quantities for parallel purposes with Adaptive Mesh Refinement
-    //! \param     dim                  dimension
-    //! \param     lvl                  level
-    virtual void communicationsAddPhys(const int& /*dim*/, const int& /*lvl*/)
+    //! \brief     Send back true if the additional physic is a diffusive operator (advanced by super time stepping when requested)
+    virtual bool isDiffusive() const { return false; };
+    //! \brief     Compute the largest diffusivity (m2/s) of the additional physic in a cell (diffusive time-step limit)
+    //! \param     cell                 corresponding cell
+    virtual double computeDiffusivity(Cell* /*cell*/) const { return 0.; };
+
+    //! \brief     Send back true if the additional physic only acts where its color function varies (restricted to the narrow band when used)
+    //! \details   Its quantities must vanish in a cell with a uniform color function (see NarrowBand)
+    virtual bool isInterfaceLocalized() const { return false; };
+
+    //! \brief     Relative cost of the gradients and flux of the additional physic on a face, in the units of Model::getFaceCost
+    virtual double getFaceCost() const { return 2.; };
+
+    //! \brief     List the vectors of the additional physic to communicate for parallel purposes
+    //! \details   The vectors of every additional physic are packed together in one message per neighbour (see Parallel::communicationsAddPhys)
+    //! \param     vectors              list completed with the pairs (number of the quantities of the additional physic, index of the vector)
+    virtual void addCommunicatedVectors(std::vector<std::pair<int, int>>& /*vectors*/) const
     {
-      Errors::errorMessage("communicationsAddPhys not implemented for used additional physic");
+      Errors::errorMessage("addCommunicatedVectors not implemented for used additional physic");
     };
 
     //! \brief     Return the associated number of the transport equation (only used for surface tension)
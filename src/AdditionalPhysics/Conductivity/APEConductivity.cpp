@@ -167,9 +167,19 @@ void APEConductivity::solveFluxConductivityOther() const
 
 //***********************************************************************
 
-void APEConductivity::communicationsAddPhys(const int& dim, const int& lvl)
+void APEConductivity::addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const
 {
-  parallel.communicationsVector(Variable::QPA, dim, lvl, m_numQPA, 0); //m_gradT
+  vectors.push_back(std::make_pair(m_numQPA, 0)); //m_gradT
+}
+
+//***********************************************************************
+
+double APEConductivity::computeDiffusivity(Cell* cell) const
+{
+  //Thermal diffusivity built with the heat capacity at constant volume (upper bound), not available for every EOS
+  double cv(cell->getPhase(0)->getEos()->getCv());
+  if (cv <= 0.) return 0.;
+  return m_lambda / (cell->getPhase(0)->getDensity() * cv);
 }
 
 //***********************************************************************
@@ -65,7 +65,9 @@ class APEConductivity : public APEuler
     void solveFluxConductivityOther() const;
 
     void addNonCons(Cell* /*cell*/) override {}; //The conductivity does not involve non-conservative terms.
-    void communicationsAddPhys(const int& dim, const int& lvl) override;
+    void addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const override;
+    bool isDiffusive() const override { return true; };
+    double computeDiffusivity(Cell* cell) const override;
 
   private:
     double m_lambda; //!< Thermal conductivity (W/(m.K)) of phase (taken from the EOS classe) (buffer)
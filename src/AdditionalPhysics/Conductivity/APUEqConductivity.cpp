@@ -216,11 +216,24 @@ void APUEqConductivity::solveFluxConductivityOther() const
 
 //***********************************************************************
 
-void APUEqConductivity::communicationsAddPhys(const int& dim, const int& lvl)
+void APUEqConductivity::addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const
 {
   for (int k = 0; k < numberPhases; k++) {
-    parallel.communicationsVector(Variable::QPA, dim, lvl, m_numQPA, k);
+    vectors.push_back(std::make_pair(m_numQPA, k)); //m_gradTk
   }
 }
 
 //***********************************************************************
+
+double APUEqConductivity::computeDiffusivity(Cell* cell) const
+{
+  //Largest thermal diffusivity of the phases, built with the heat capacity at constant volume (upper bound), not available for every EOS
+  double diffusivity(0.);
+  for (int k = 0; k < numberPhases; k++) {
+    double cv(cell->getPhase(k)->getEos()->getCv());
+    if (cv > 0.) diffusivity = std::max(diffusivity, m_lambdak[k] / (cell->getPhase(k)->getDensity() * cv));
+  }
+  return diffusivity;
+}
+
+//***********************************************************************
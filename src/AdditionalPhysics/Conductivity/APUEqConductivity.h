@@ -71,7 +71,9 @@ class APUEqConductivity : public APUEq
     void solveFluxConductivityOther() const;
     void addNonCons(Cell* /*cell*/) override {}; //The conductivity does not involve non-conservative terms.
 
-    void communicationsAddPhys(const int& dim, const int& lvl) override;
+    void addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const override;
+    bool isDiffusive() const override { return true; };
+    double computeDiffusivity(Cell* cell) const override;
 
   protected:
   private:
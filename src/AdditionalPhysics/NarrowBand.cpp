@@ -0,0 +1,139 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <algorithm>
+#include "NarrowBand.h"
+
+//***********************************************************************
+
+NarrowBand::NarrowBand(const int& numberLayers, const double& threshold) :
+  m_numberLayers(numberLayers), m_threshold(threshold), m_numberCandidates(0)
+{}
+
+//***********************************************************************
+
+NarrowBand::~NarrowBand() {}
+
+//***********************************************************************
+
+bool NarrowBand::initialize(const std::vector<AddPhys*>& addPhys)
+{
+  for (unsigned int pa = 0; pa < addPhys.size(); pa++) {
+    if (addPhys[pa]->isInterfaceLocalized()) m_numTransports.push_back(addPhys[pa]->getNumTransportAssociated());
+  }
+  return !m_numTransports.empty();
+}
+
+//***********************************************************************
+
+void NarrowBand::update(TypeMeshContainer<Cell*>& cells, TypeMeshContainer<CellInterface*>& cellInterfaces)
+{
+  //1) Seeds: cells with a jump of a color function across one of their faces
+  //-------------------------------------------------------------------------
+  m_cells.clear();
+  m_numberCandidates = 0;
+  for (unsigned int i = 0; i < cells.size(); i++) {
+    if (!cells[i]->getSplit()) {
+      m_numberCandidates++;
+      cells[i]->setNarrowBand(this->isSeed(cells[i]));
+      if (cells[i]->getNarrowBand()) m_cells.push_back(cells[i]);
+    }
+  }
+
+  //2) Layers of neighbouring cells of the same level around the seeds
+  //------------------------------------------------------------------
+  //Ghost cells and cells of other levels keep their own flags (ghost cells are always flagged)
+  unsigned int begin(0), end(m_cells.size());
+  for (int layer = 0; layer < m_numberLayers; layer++) {
+    for (unsigned int i = begin; i < end; i++) {
+      for (int b = 0; b < m_cells[i]->getCellInterfacesSize(); b++) {
+        CellInterface* cellInterface(m_cells[i]->getCellInterface(b));
+        if (cellInterface->getSplit() || cellInterface->whoAmI() != 0) continue;
+        Cell* neighbour(cellInterface->getCellLeft() == m_cells[i] ? cellInterface->getCellRight() : cellInterface->getCellLeft());
+        if (!neighbour->getNarrowBand() && !neighbour->getSplit() && neighbour->getLvl() == m_cells[i]->getLvl()) {
+          neighbour->setNarrowBand(true);
+          m_cells.push_back(neighbour);
+        }
+      }
+    }
+    begin = end;
+    end   = m_cells.size();
+  }
+
+  //3) Faces with at least one cell in the band, and cells of the level outside the band sharing one of these faces
+  //----------------------------------------------------------------------------------------------------------------
+  //A band cell of the outer layer may carry a gradient (jumps below the threshold), so the flux of its face with a cell
+  //outside the band does not vanish: this cell has to be time evolved with the band
+  m_cellInterfaces.clear();
+  m_fringeCells.clear();
+  for (unsigned int i = 0; i < cellInterfaces.size(); i++) {
+    if (cellInterfaces[i]->getSplit() || cellInterfaces[i]->hasGhostCell()) continue;
+    Cell* cellLeft(cellInterfaces[i]->getCellLeft());
+    Cell* cellRight(cellInterfaces[i]->whoAmI() == 0 ? cellInterfaces[i]->getCellRight() : nullptr);
+    if (cellLeft->getNarrowBand() || (cellRight != nullptr && cellRight->getNarrowBand())) {
+      m_cellInterfaces.push_back(cellInterfaces[i]);
+      if (!cellLeft->getNarrowBand() && this->isCandidate(cellLeft, cells)) m_fringeCells.push_back(cellLeft);
+      if (cellRight != nullptr && !cellRight->getNarrowBand() && this->isCandidate(cellRight, cells)) m_fringeCells.push_back(cellRight);
+    }
+  }
+  std::sort(m_fringeCells.begin(), m_fringeCells.end());
+  m_fringeCells.erase(std::unique(m_fringeCells.begin(), m_fringeCells.end()), m_fringeCells.end());
+}
+
+//***********************************************************************
+
+bool NarrowBand::isCandidate(Cell* cell, const TypeMeshContainer<Cell*>& cells) const
+{
+  //Cells of other levels are time evolved with their own level
+  return !cell->getSplit() && !cells.empty() && cell->getLvl() == cells[0]->getLvl();
+}
+
+//***********************************************************************
+
+bool NarrowBand::isSeed(Cell* cell) const
+{
+  for (int b = 0; b < cell->getCellInterfacesSize(); b++) {
+    CellInterface* cellInterface(cell->getCellInterface(b));
+    if (cellInterface->getSplit() || cellInterface->whoAmI() != 0) continue;
+    //The quantities of a ghost cell or of a cell of another level may not vanish while this cell is outside their band
+    if (cellInterface->hasGhostCell()) return true;
+    Cell* neighbour(cellInterface->getCellLeft() == cell ? cellInterface->getCellRight() : cellInterface->getCellLeft());
+    if (neighbour->getLvl() != cell->getLvl()) return true;
+    for (unsigned int t = 0; t < m_numTransports.size(); t++) {
+      if (std::fabs(neighbour->getTransport(m_numTransports[t]).getValue() - cell->getTransport(m_numTransports[t]).getValue()) > m_threshold) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+//***********************************************************************
@@ -0,0 +1,88 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef NARROWBAND_H
+#define NARROWBAND_H
+
+#include "AddPhys.h"
+
+//! \class     NarrowBand
+//! \brief     Narrow band of cells around the interfaces, on which the interface-localized additional physics (surface tension) work
+//! \details   Seeds are the cells having a face across which the color function (transport) of an interface-localized additional physic
+//!            jumps by more than a threshold. The band gathers the seeds and the cells of the same level within a given number of layers of
+//!            them; it is rebuilt at each preparation of the additional physics of a level, from the flags kept in the cells.
+//!            Outside the band, the quantities of these physics are set to zero and their fluxes vanish: the gradients, fluxes and
+//!            symmetric terms are only computed on the band cells and on the faces touching them. The cells outside the band sharing
+//!            one of these faces receive its flux and are time evolved with the band cells.
+//!            With a null threshold (default) and finite-difference gradients, results are identical to the ones without band.
+class NarrowBand
+{
+  public:
+    //! \brief     Narrow band constructor
+    //! \param     numberLayers         number of layers of cells added around the seeds
+    //! \param     threshold            jump of the color function across a face above which its cells are seeds
+    NarrowBand(const int& numberLayers, const double& threshold);
+    ~NarrowBand();
+
+    //! \brief     Record the color functions of the interface-localized additional physics
+    //! \param     addPhys              additional physics
+    //! \return    false if there is no interface-localized additional physic (the band is then useless)
+    bool initialize(const std::vector<AddPhys*>& addPhys);
+    //! \brief     Rebuild the band of a level from the current color functions
+    //! \details   Must be called just before the preparation of the additional physics of the level (see Cell::prepareAddPhys)
+    //!            since the flags of the cells state which ones hold non-zero quantities
+    //! \param     cells                cells of the level
+    //! \param     cellInterfaces       cell interfaces of the level
+    void update(TypeMeshContainer<Cell*>& cells, TypeMeshContainer<CellInterface*>& cellInterfaces);
+
+    const std::vector<Cell*>& getCells() const { return m_cells; };
+    //! \brief     Band faces of the level, faces with a ghost cell excepted (always treated once the ghost quantities are received)
+    const std::vector<CellInterface*>& getCellInterfaces() const { return m_cellInterfaces; };
+    //! \brief     Cells of the level outside the band sharing a band face (they receive the flux of this face)
+    const std::vector<Cell*>& getFringeCells() const { return m_fringeCells; };
+    const int& getNumberCandidates() const { return m_numberCandidates; };
+
+  private:
+    //! \brief     Return true if the color functions jump by more than the threshold across a face of the cell
+    bool isSeed(Cell* cell) const;
+    //! \brief     Return true if the cell is a non-split cell of the updated level
+    bool isCandidate(Cell* cell, const TypeMeshContainer<Cell*>& cells) const;
+
+    int m_numberLayers;                           //!< Number of layers of cells added around the seeds
+    double m_threshold;                           //!< Jump of the color function across a face above which its cells are seeds
+    std::vector<int> m_numTransports;             //!< Color functions (transport numbers) of the interface-localized additional physics
+    std::vector<Cell*> m_cells;                   //!< Band cells of the last updated level
+    std::vector<CellInterface*> m_cellInterfaces; //!< Band faces (without ghost cell) of the last updated level
+    std::vector<Cell*> m_fringeCells;             //!< Cells of the last updated level outside the band sharing a band face
+    int m_numberCandidates;                       //!< Non-split cells of the last updated level
+};
+
+#endif // NARROWBAND_H
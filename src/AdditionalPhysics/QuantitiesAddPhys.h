@@ -52,6 +52,8 @@ class QuantitiesAddPhys
     {
       Errors::errorMessage("computeQuantities not implemented for used quantities of additional physics");
     };
+    //! \brief     Set the quantities to zero (cell outside the narrow band of an interface-localized additional physic)
+    virtual void setToZero() { Errors::errorMessage("setToZero not implemented for used quantities of additional physics"); };
     //! \brief     Compute and send back mass energy linked to the physic (0 if no linked energy)
     double computeEnergyAddPhys();
 
@@ -370,9 +370,9 @@ void APUEqSurfaceTension::reinitializeColorFunction(std::vector<Cell*>* cellsLvl
 
 //***********************************************************************
 
-void APUEqSurfaceTension::communicationsAddPhys(const int& dim, const int& lvl)
+void APUEqSurfaceTension::addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const
 {
-  parallel.communicationsVector(Variable::QPA, dim, lvl, m_numQPAGradC);
+  vectors.push_back(std::make_pair(m_numQPAGradC, -1)); //m_gradC
 }
 
 //***********************************************************************
@@ -76,8 +76,9 @@ class APUEqSurfaceTension : public APUEq
 
     void reinitializeColorFunction(std::vector<Cell*>* cellsLvl, const int& lvl) override;
     bool reinitializationActivated() override { return m_reinitializationActivated; };
+    bool isInterfaceLocalized() const override { return true; };
 
-    void communicationsAddPhys(const int& dim, const int& lvl) override;
+    void addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const override;
     const int& getNumTransportAssociated() const override { return m_numTransportAssociated; };
 
   protected:
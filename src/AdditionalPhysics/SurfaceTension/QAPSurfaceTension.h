@@ -42,6 +42,7 @@ class QAPSurfaceTension : public QuantitiesAddPhys
     ~QAPSurfaceTension() override;
 
     void computeQuantities(Cell* cell) override;
+    void setToZero() override { m_gradC[0] = 0.; };
 
     //Accessors
     void setGrad(const Coord& grad, const int& /*num*/ = -1) override;
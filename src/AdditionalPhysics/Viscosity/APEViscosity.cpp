@@ -272,11 +272,19 @@ void APEViscosity::solveFluxViscosityOther() const
 
 //***********************************************************************
 
-void APEViscosity::communicationsAddPhys(const int& dim, const int& lvl)
+void APEViscosity::addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const
 {
-  parallel.communicationsVector(Variable::QPA, dim, lvl, m_numQPA, 1); //m_gradU
-  parallel.communicationsVector(Variable::QPA, dim, lvl, m_numQPA, 2); //m_gradV
-  parallel.communicationsVector(Variable::QPA, dim, lvl, m_numQPA, 3); //m_gradW
+  vectors.push_back(std::make_pair(m_numQPA, 1)); //m_gradU
+  vectors.push_back(std::make_pair(m_numQPA, 2)); //m_gradV
+  vectors.push_back(std::make_pair(m_numQPA, 3)); //m_gradW
+}
+
+//***********************************************************************
+
+double APEViscosity::computeDiffusivity(Cell* cell) const
+{
+  //Kinematic viscosity, increased by the 4/3 factor of the normal viscous stress
+  return 4. / 3. * m_mu / cell->getPhase(0)->getDensity();
 }
 
 //***********************************************************************
@@ -102,7 +102,9 @@ class APEViscosity : public APEuler
       Errors::errorMessage("addSymmetricTermsY not implemented for used additional physic");
     };
 
-    void communicationsAddPhys(const int& dim, const int& lvl) override;
+    void addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const override;
+    bool isDiffusive() const override { return true; };
+    double computeDiffusivity(Cell* cell) const override;
 
   protected:
   private:
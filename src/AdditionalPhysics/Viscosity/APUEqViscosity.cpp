@@ -388,11 +388,23 @@ void APUEqViscosity::addSymmetricTermsRadialAxisOnY(Cell* cell)
 
 //***********************************************************************
 
-void APUEqViscosity::communicationsAddPhys(const int& dim, const int& lvl)
+void APUEqViscosity::addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const
 {
-  parallel.communicationsVector(Variable::QPA, dim, lvl, m_numQPA, 1); //m_gradU
-  parallel.communicationsVector(Variable::QPA, dim, lvl, m_numQPA, 2); //m_gradV
-  parallel.communicationsVector(Variable::QPA, dim, lvl, m_numQPA, 3); //m_gradW
+  vectors.push_back(std::make_pair(m_numQPA, 1)); //m_gradU
+  vectors.push_back(std::make_pair(m_numQPA, 2)); //m_gradV
+  vectors.push_back(std::make_pair(m_numQPA, 3)); //m_gradW
+}
+
+//***********************************************************************
+
+double APUEqViscosity::computeDiffusivity(Cell* cell) const
+{
+  //Kinematic viscosity of the mixture, increased by the 4/3 factor of the normal viscous stress
+  double muMix(0.);
+  for (int k = 0; k < numberPhases; k++) {
+    muMix += cell->getPhase(k)->getAlpha() * m_muk[k];
+  }
+  return 4. / 3. * muMix / cell->getMixture()->getDensity();
 }
 
 //***********************************************************************
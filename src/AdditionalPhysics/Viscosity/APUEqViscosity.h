@@ -98,7 +98,9 @@ class APUEqViscosity : public APUEq
     void addSymmetricTermsRadialAxisOnX(Cell* cell) override;
     void addSymmetricTermsRadialAxisOnY(Cell* cell) override;
 
-    void communicationsAddPhys(const int& dim, const int& lvl) override;
+    void addCommunicatedVectors(std::vector<std::pair<int, int>>& vectors) const override;
+    bool isDiffusive() const override { return true; };
+    double computeDiffusivity(Cell* cell) const override;
 
   protected:
   private:
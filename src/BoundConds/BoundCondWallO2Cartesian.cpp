@@ -52,6 +52,7 @@ BoundCondWallO2Cartesian::BoundCondWallO2Cartesian(int numPhysique) :
 
 BoundCondWallO2Cartesian::~BoundCondWallO2Cartesian()
 {
+  MemoryStats::Redirection slopes(MEMSLOPES);
   if (m_vecPhasesSlopes) { // Needed for cases where the vector is not allocated (dealloc of m_limXm for example)
     for (int k = 0; k < numberPhases; k++) {
       delete m_vecPhasesSlopes[k];
@@ -73,6 +74,7 @@ void BoundCondWallO2Cartesian::createBoundary(TypeMeshContainer<CellInterface*>&
 
 void BoundCondWallO2Cartesian::allocateSlopes(int& /*allocateSlopeLocal*/)
 {
+  MemoryStats::Redirection slopes(MEMSLOPES); //Slope objects are accounted apart from the phases and mixtures of the cells
   //Allocation of phase slopes
   m_vecPhasesSlopes = new Phase*[numberPhases];
   // We set phases from the left cell (because the right cell doesn't exist for the limits)
@@ -130,24 +132,22 @@ void BoundCondWallO2Cartesian::solveRiemann(double& dtMax,
                                             Limiter& interfaceVolumeFractionLimiter,
                                             Prim type)
 {
-  bufferCellLeft->copyVec(m_cellLeft->getPhases(type), m_cellLeft->getMixture(type), m_cellLeft->getTransports(type));
-
   //Calcul des distances cell interfaces <-> cells pour l extrapolation
   double distanceGauche(this->distance(m_cellLeft));
   if (m_face->getNormal().getX() < 0. || m_face->getNormal().getY() < 0. || m_face->getNormal().getZ() < 0.) {
     distanceGauche = -distanceGauche;
   }
 
-  //Left side of interface extrapolation
+  //Left side of interface extrapolation (directly written in the buffer cell)
   double epsInterface(1.e-4);
   m_cellLeft->computeLocalSlopesLimite(
     *this, globalLimiter, interfaceLimiter, globalVolumeFractionLimiter, interfaceVolumeFractionLimiter, epsInterface);
   for (int k = 0; k < numberPhases; k++) {
-    bufferCellLeft->getPhase(k)->extrapolate(*slopesPhasesLocal1[k], distanceGauche);
+    bufferCellLeft->getPhase(k)->copyAndExtrapolate(*m_cellLeft->getPhase(k, type), *slopesPhasesLocal1[k], distanceGauche);
   }
-  bufferCellLeft->getMixture()->extrapolate(*slopesMixtureLocal1, distanceGauche);
+  bufferCellLeft->getMixture()->copyAndExtrapolate(*m_cellLeft->getMixture(type), *slopesMixtureLocal1, distanceGauche);
   for (int k = 0; k < numberTransports; k++) {
-    bufferCellLeft->getTransport(k).extrapolate(slopesTransportLocal1[k], distanceGauche);
+    bufferCellLeft->getTransport(k).copyAndExtrapolate(m_cellLeft->getTransport(k, type), slopesTransportLocal1[k], distanceGauche);
   }
 
   //Computation of extended variables (Phases, Mixture, AddPhys)
@@ -64,25 +64,23 @@ void BoundCondWallO2NS::solveRiemann(double& dtMax,
                                      Limiter& /*interfaceVolumeFractionLimiter*/,
                                      Prim type)
 {
-  // Initialize buffer cells used in Riemann problem
-  bufferCellLeft->copyVec(m_cellLeft->getPhases(type), m_cellLeft->getMixture(type), m_cellLeft->getTransports(type));
-
   // For NS extrapolation a scalar product between the distance
   // Coord rij and the gradient is already done during CellO2NS::computeLocalSlopes
   // and stored in slopesPhase/MixtureLocal1
   // Therefore, to stay compliant with cartesian 2nd order, distance is equal to 1 here
   double distanceLeft = 1.0;
 
-  // Left side of interface extrapolation
+  // Left side of interface extrapolation, directly written in the buffer cell used in Riemann problem
   m_cellLeft->computeLocalSlopes(*this); // Build slopesPhasesLocal1 = theta_i * rij . grad(Wi)
   for (int k = 0; k < numberPhases; k++) {
-    bufferCellLeft->getPhase(k)->extrapolate(*slopesPhasesLocal1[k], distanceLeft); // Build Wij_lim = Wi + theta_i * rij . grad(Wi)
+    // Build Wij_lim = Wi + theta_i * rij . grad(Wi)
+    bufferCellLeft->getPhase(k)->copyAndExtrapolate(*m_cellLeft->getPhase(k, type), *slopesPhasesLocal1[k], distanceLeft);
     bufferCellLeft->getPhase(k)->verifyAndCorrectPhase();
     bufferCellLeft->getPhase(k)->verifyAndCorrectDensityMax();
   }
-  bufferCellLeft->getMixture()->extrapolate(*slopesMixtureLocal1, distanceLeft);
+  bufferCellLeft->getMixture()->copyAndExtrapolate(*m_cellLeft->getMixture(type), *slopesMixtureLocal1, distanceLeft);
   for (int k = 0; k < numberTransports; k++) {
-    bufferCellLeft->getTransport(k).extrapolate(slopesTransportLocal1[k], distanceLeft);
+    bufferCellLeft->getTransport(k).copyAndExtrapolate(m_cellLeft->getTransport(k, type), slopesTransportLocal1[k], distanceLeft);
   }
 
   // Compute extended variables since projection change some of them (Phases, Mixture, AddPhys)
@@ -34,7 +34,7 @@ Config config;
 
 //***********************************************************************
 
-Config::Config() : m_workingFolder("./") {}
+Config::Config() : m_workingFolder("./"), m_threadedOutput(true) {}
 
 //***********************************************************************
 
@@ -45,9 +45,13 @@ class Config
 
     std::string getWorkFolder() { return m_workingFolder; }
     void setWorkFolder(std::string folder) { m_workingFolder = folder; };
+    //! \brief     Return true if result files may be written by a background thread (MPI initialized with MPI_THREAD_FUNNELED at least)
+    bool getThreadedOutput() { return m_threadedOutput; }
+    void setThreadedOutput(bool threadedOutput) { m_threadedOutput = threadedOutput; };
 
   private:
     std::string m_workingFolder;
+    bool m_threadedOutput; //!< Background writer threads allowed by the MPI thread support level
 };
 
 extern Config config;
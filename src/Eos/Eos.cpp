@@ -60,6 +60,33 @@ void Eos::readPhysicalParameters(XMLNode* element)
 
 //***********************************************************************
 
+void Eos::computeTemperatureBatch(const int& numberStates, const double* density, const double* pressure, double* temperature) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    temperature[i] = this->computeTemperature(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void Eos::computeEnergyBatch(const int& numberStates, const double* density, const double* pressure, double* energy) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    energy[i] = this->computeEnergy(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void Eos::computeSoundSpeedBatch(const int& numberStates, const double* density, const double* pressure, double* soundSpeed) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    soundSpeed[i] = this->computeSoundSpeed(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
 double Eos::computeEnthalpy(const double& density, const double& pressure) const
 {
   return this->computeEnergy(density, pressure) + pressure / std::max(density, epsilonAlphaNull);
@@ -140,6 +140,30 @@ class Eos
       Errors::errorMessage("computeSoundSpeed not yet programmed for EOS : " + m_name);
       return 0.;
     };
+
+    //Batched methods: one call for an array of states sharing the same EOS
+    //! \brief    Compute the temperatures of an array of states
+    //! \param    numberStates    number of states
+    //! \param    density         densities (\f$\rho \f$)
+    //! \param    pressure        pressures (p)
+    //! \param    temperature     computed temperatures
+    //! \details  Loop on the virtual computeTemperature(). Overridden by the EOS with closed-form expressions (devirtualized and vectorizable loop).
+    virtual void computeTemperatureBatch(const int& numberStates, const double* density, const double* pressure, double* temperature) const;
+    //! \brief    Compute the internal energies of an array of states
+    //! \param    numberStates    number of states
+    //! \param    density         densities (\f$\rho \f$)
+    //! \param    pressure        pressures (p)
+    //! \param    energy          computed internal energies
+    //! \details  Loop on the virtual computeEnergy(). Overridden by the EOS with closed-form expressions (devirtualized and vectorizable loop).
+    virtual void computeEnergyBatch(const int& numberStates, const double* density, const double* pressure, double* energy) const;
+    //! \brief    Compute the speeds of sound of an array of states
+    //! \param    numberStates    number of states
+    //! \param    density         densities (\f$\rho \f$)
+    //! \param    pressure        pressures (p)
+    //! \param    soundSpeed      computed speeds of sound
+    //! \details  Loop on the virtual computeSoundSpeed(). Overridden by the EOS with closed-form expressions (devirtualized and vectorizable loop).
+    virtual void computeSoundSpeedBatch(const int& numberStates, const double* density, const double* pressure, double* soundSpeed) const;
+
     //! \brief See derived classes
     virtual double computeInterfaceSoundSpeed(const double& /*density*/, const double& /*interfacePressure*/, const double& /*pressure*/) const
     {
@@ -93,6 +93,33 @@ double EosIG::computeSoundSpeed(const double& density, const double& pressure) c
 
 //***********************************************************************
 
+void EosIG::computeTemperatureBatch(const int& numberStates, const double* density, const double* pressure, double* temperature) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    temperature[i] = EosIG::computeTemperature(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void EosIG::computeEnergyBatch(const int& numberStates, const double* density, const double* pressure, double* energy) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    energy[i] = EosIG::computeEnergy(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void EosIG::computeSoundSpeedBatch(const int& numberStates, const double* density, const double* pressure, double* soundSpeed) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    soundSpeed[i] = EosIG::computeSoundSpeed(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
 double EosIG::computeInterfaceSoundSpeed(const double& density, const double& interfacePressure, const double& pressure) const
 {
   return sqrt(((m_gamma - 1.) * interfacePressure + pressure) / std::max(density, epsilonAlphaNull));
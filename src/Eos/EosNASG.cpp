@@ -101,6 +101,33 @@ double EosNASG::computeSoundSpeed(const double& density, const double& pressure)
 
 //***********************************************************************
 
+void EosNASG::computeTemperatureBatch(const int& numberStates, const double* density, const double* pressure, double* temperature) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    temperature[i] = EosNASG::computeTemperature(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void EosNASG::computeEnergyBatch(const int& numberStates, const double* density, const double* pressure, double* energy) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    energy[i] = EosNASG::computeEnergy(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void EosNASG::computeSoundSpeedBatch(const int& numberStates, const double* density, const double* pressure, double* soundSpeed) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    soundSpeed[i] = EosNASG::computeSoundSpeed(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
 double EosNASG::computeInterfaceSoundSpeed(const double& density, const double& interfacePressure, const double& pressure) const
 {
   return sqrt(((m_gamma - 1.) * interfacePressure + pressure + m_gamma * m_pInf) / std::max(density * (1. - density * m_b), epsilonAlphaNull));
@@ -83,6 +83,11 @@ class EosNASG : public Eos
     //! \details   with soundSpeed : \f$  c(p, \rho)  = \sqrt{  \frac{\gamma \ (p+p_{\infty})}{\rho (1-\rho b)}} \f$
     double computeSoundSpeed(const double& density, const double& pressure) const override;
 
+    //Batched methods (devirtualized loops on the closed-form expressions above)
+    void computeTemperatureBatch(const int& numberStates, const double* density, const double* pressure, double* temperature) const override;
+    void computeEnergyBatch(const int& numberStates, const double* density, const double* pressure, double* energy) const override;
+    void computeSoundSpeedBatch(const int& numberStates, const double* density, const double* pressure, double* soundSpeed) const override;
+
     //! \brief     Compute interface sound speed
     //! \param     density            density (\f$\rho\f$)
     //! \param     interfacePressure  interface pressure (pI)
@@ -97,6 +97,33 @@ double EosSG::computeSoundSpeed(const double& density, const double& pressure) c
 
 //***********************************************************************
 
+void EosSG::computeTemperatureBatch(const int& numberStates, const double* density, const double* pressure, double* temperature) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    temperature[i] = EosSG::computeTemperature(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void EosSG::computeEnergyBatch(const int& numberStates, const double* density, const double* pressure, double* energy) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    energy[i] = EosSG::computeEnergy(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void EosSG::computeSoundSpeedBatch(const int& numberStates, const double* density, const double* pressure, double* soundSpeed) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    soundSpeed[i] = EosSG::computeSoundSpeed(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
 double EosSG::computeInterfaceSoundSpeed(const double& density, const double& interfacePressure, const double& pressure) const
 {
   return sqrt(((m_gamma - 1.) * interfacePressure + pressure + m_gamma * m_pInf) / std::max(density, epsilonAlphaNull));
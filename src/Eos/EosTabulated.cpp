@@ -0,0 +1,322 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#include "EosTabulated.h"
+#include "../Parallel/Parallel.h"
+#include <cstdio>
+#include <fstream>
+
+using namespace tinyxml2;
+
+static const char tableMagic[9] = "ECOGENTB";
+static const int tableVersion   = 1;
+
+//***********************************************************************
+
+EosTabulated::EosTabulated(Eos* eos, int& number, XMLElement* element, const std::string& fileName, const std::string& folder) :
+  Eos(number), m_eos(eos), m_consistencyError(0.)
+{
+  m_name   = eos->getName();
+  m_mu     = eos->getMu();
+  m_lambda = eos->getLambda();
+
+  //1) Tabulation parameters
+  //------------------------
+  XMLError error;
+  int points(33), maxPoints(513);
+  double tolerance(1.e-6), consistencyTolerance(1.e-3);
+  error = element->QueryIntAttribute("points", &points);
+  if (error == XML_WRONG_ATTRIBUTE_TYPE || points < 2) throw ErrorXMLAttribut("points", fileName, __FILE__, __LINE__);
+  error = element->QueryIntAttribute("maxPoints", &maxPoints);
+  if (error == XML_WRONG_ATTRIBUTE_TYPE || maxPoints < points) throw ErrorXMLAttribut("maxPoints", fileName, __FILE__, __LINE__);
+  error = element->QueryDoubleAttribute("tolerance", &tolerance);
+  if (error == XML_WRONG_ATTRIBUTE_TYPE || tolerance <= 0.) throw ErrorXMLAttribut("tolerance", fileName, __FILE__, __LINE__);
+  error = element->QueryDoubleAttribute("consistencyTolerance", &consistencyTolerance);
+  if (error == XML_WRONG_ATTRIBUTE_TYPE || consistencyTolerance <= 0.) throw ErrorXMLAttribut("consistencyTolerance", fileName, __FILE__, __LINE__);
+
+  //Ranges: density and pressure are required, energy and temperature enable the optional tables
+  std::vector<std::string> variables = {"density", "pressure", "energy", "temperature"};
+  std::vector<double> ranges(2 * variables.size(), 0.);
+  bool logs[4] = {false, false, false, false};
+  for (unsigned int v = 0; v < variables.size(); v++) {
+    XMLElement* rangeElement(element->FirstChildElement(variables[v].c_str()));
+    if (rangeElement == NULL) {
+      if (v < 2) throw ErrorXMLElement(variables[v], fileName, __FILE__, __LINE__);
+      continue;
+    }
+    error = rangeElement->QueryDoubleAttribute("min", &ranges[2 * v]);
+    if (error != XML_NO_ERROR) throw ErrorXMLAttribut("min", fileName, __FILE__, __LINE__);
+    error = rangeElement->QueryDoubleAttribute("max", &ranges[2 * v + 1]);
+    if (error != XML_NO_ERROR || ranges[2 * v + 1] <= ranges[2 * v]) throw ErrorXMLAttribut("max", fileName, __FILE__, __LINE__);
+    error = rangeElement->QueryBoolAttribute("log", &logs[v]);
+    if (error == XML_WRONG_ATTRIBUTE_TYPE || (logs[v] && ranges[2 * v] <= 0.)) throw ErrorXMLAttribut("log", fileName, __FILE__, __LINE__);
+  }
+  const double &densityMin(ranges[0]), &densityMax(ranges[1]), &pressureMin(ranges[2]), &pressureMax(ranges[3]);
+  const double &energyMin(ranges[4]), &energyMax(ranges[5]), &temperatureMin(ranges[6]), &temperatureMax(ranges[7]);
+  const bool &densityLog(logs[0]), &pressureLog(logs[1]), &energyLog(logs[2]), &temperatureLog(logs[3]);
+
+  //2) Tables loaded from the table file or built by sampling the wrapped EOS
+  //-------------------------------------------------------------------------
+  std::vector<double> parameters = {static_cast<double>(points), static_cast<double>(maxPoints), tolerance};
+  parameters.insert(parameters.end(), ranges.begin(), ranges.end());
+  parameters.insert(parameters.end(), logs, logs + 4);
+  std::string tableFile;
+  if (element->Attribute("file") != NULL) tableFile = folder + element->Attribute("file");
+  if (tableFile.empty() || !this->readTables(tableFile, parameters)) {
+    const Eos* wrapped(m_eos);
+    std::string failure("EOS tabulation: tolerance not reached with maxPoints nodes, or wrapped EOS not finite on the ranges, for the table of ");
+    if (!m_temperature.build([wrapped](const double& d, const double& p) { return wrapped->computeTemperature(d, p); }, densityMin, densityMax,
+                             pressureMin, pressureMax, densityLog, pressureLog, points, maxPoints, tolerance)) {
+      throw ErrorXMLMessage(failure + "temperature", fileName, __FILE__, __LINE__);
+    }
+    if (!m_energy.build([wrapped](const double& d, const double& p) { return wrapped->computeEnergy(d, p); }, densityMin, densityMax, pressureMin,
+                        pressureMax, densityLog, pressureLog, points, maxPoints, tolerance)) {
+      throw ErrorXMLMessage(failure + "energy", fileName, __FILE__, __LINE__);
+    }
+    if (!m_soundSpeed.build([wrapped](const double& d, const double& p) { return wrapped->computeSoundSpeed(d, p); }, densityMin, densityMax,
+                            pressureMin, pressureMax, densityLog, pressureLog, points, maxPoints, tolerance)) {
+      throw ErrorXMLMessage(failure + "speed of sound", fileName, __FILE__, __LINE__);
+    }
+    if (energyMax > energyMin &&
+        !m_pressure.build([wrapped](const double& d, const double& e) { return wrapped->computePressure(d, e); }, densityMin, densityMax, energyMin,
+                          energyMax, densityLog, energyLog, points, maxPoints, tolerance)) {
+      throw ErrorXMLMessage(failure + "pressure", fileName, __FILE__, __LINE__);
+    }
+    if (temperatureMax > temperatureMin &&
+        !m_density.build([wrapped](const double& p, const double& T) { return wrapped->computeDensity(p, T); }, pressureMin, pressureMax,
+                         temperatureMin, temperatureMax, pressureLog, temperatureLog, points, maxPoints, tolerance)) {
+      throw ErrorXMLMessage(failure + "density", fileName, __FILE__, __LINE__);
+    }
+    if (!tableFile.empty()) this->writeTables(tableFile, parameters);
+  }
+
+  //3) Thermodynamic consistency between the tables
+  //-----------------------------------------------
+  this->computeConsistencyError();
+  if (m_consistencyError > consistencyTolerance) {
+    std::stringstream message;
+    message << "EOS tabulation: relative error of the round trips between tables (" << m_consistencyError
+            << ") greater than consistencyTolerance, decrease tolerance";
+    throw ErrorXMLMessage(message.str(), fileName, __FILE__, __LINE__);
+  }
+}
+
+//***********************************************************************
+
+EosTabulated::~EosTabulated() { delete m_eos; }
+
+//***********************************************************************
+
+void EosTabulated::assignParametersEos(std::string name, std::vector<double> parametersEos)
+{
+  m_eos->assignParametersEos(name, parametersEos);
+  m_name = name;
+}
+
+//***********************************************************************
+
+double EosTabulated::computeTemperature(const double& density, const double& pressure) const
+{
+  if (m_temperature.contains(density, pressure)) return m_temperature.interpolate(density, pressure);
+  return m_eos->computeTemperature(density, pressure);
+}
+
+//***********************************************************************
+
+double EosTabulated::computeEnergy(const double& density, const double& pressure) const
+{
+  if (m_energy.contains(density, pressure)) return m_energy.interpolate(density, pressure);
+  return m_eos->computeEnergy(density, pressure);
+}
+
+//***********************************************************************
+
+double EosTabulated::computePressure(const double& density, const double& energy) const
+{
+  if (m_pressure.isBuilt() && m_pressure.contains(density, energy)) return m_pressure.interpolate(density, energy);
+  return m_eos->computePressure(density, energy);
+}
+
+//***********************************************************************
+
+double EosTabulated::computeDensity(const double& pressure, const double& temperature) const
+{
+  if (m_density.isBuilt() && m_density.contains(pressure, temperature)) return m_density.interpolate(pressure, temperature);
+  return m_eos->computeDensity(pressure, temperature);
+}
+
+//***********************************************************************
+
+double EosTabulated::computeSoundSpeed(const double& density, const double& pressure) const
+{
+  if (m_soundSpeed.contains(density, pressure)) return m_soundSpeed.interpolate(density, pressure);
+  return m_eos->computeSoundSpeed(density, pressure);
+}
+
+//***********************************************************************
+
+void EosTabulated::computeTemperatureBatch(const int& numberStates, const double* density, const double* pressure, double* temperature) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    temperature[i] = m_temperature.contains(density[i], pressure[i]) ? m_temperature.interpolate(density[i], pressure[i])
+                                                                     : m_eos->computeTemperature(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void EosTabulated::computeEnergyBatch(const int& numberStates, const double* density, const double* pressure, double* energy) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    energy[i] = m_energy.contains(density[i], pressure[i]) ? m_energy.interpolate(density[i], pressure[i])
+                                                           : m_eos->computeEnergy(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+void EosTabulated::computeSoundSpeedBatch(const int& numberStates, const double* density, const double* pressure, double* soundSpeed) const
+{
+  for (int i = 0; i < numberStates; i++) {
+    soundSpeed[i] = m_soundSpeed.contains(density[i], pressure[i]) ? m_soundSpeed.interpolate(density[i], pressure[i])
+                                                                   : m_eos->computeSoundSpeed(density[i], pressure[i]);
+  }
+}
+
+//***********************************************************************
+
+bool EosTabulated::readTables(const std::string& tableFile, const std::vector<double>& parameters)
+{
+  std::ifstream file(tableFile.c_str(), std::ios::in | std::ios::binary);
+  if (!file) return false;
+
+  //Header: magic, version, name of the wrapped EOS and tabulation parameters
+  char magic[8];
+  int version(0), nameSize(0), numberParameters(0), optionalTables[2] = {0, 0};
+  file.read(magic, 8);
+  file.read(reinterpret_cast<char*>(&version), sizeof(int));
+  file.read(reinterpret_cast<char*>(&nameSize), sizeof(int));
+  if (!file || std::string(magic, 8) != tableMagic || version != tableVersion || nameSize != static_cast<int>(m_name.size())) return false;
+  std::string name(nameSize, ' ');
+  file.read(&name[0], nameSize);
+  file.read(reinterpret_cast<char*>(&numberParameters), sizeof(int));
+  if (!file || name != m_name || numberParameters != static_cast<int>(parameters.size())) return false;
+  std::vector<double> fileParameters(numberParameters);
+  file.read(reinterpret_cast<char*>(fileParameters.data()), numberParameters * sizeof(double));
+  file.read(reinterpret_cast<char*>(optionalTables), sizeof(optionalTables));
+  if (!file || fileParameters != parameters) return false;
+
+  //Tables, checked against the wrapped EOS (its parameters are not in the header)
+  if (!m_temperature.read(file) || !m_energy.read(file) || !m_soundSpeed.read(file)) return false;
+  if (optionalTables[0] && !m_pressure.read(file)) return false;
+  if (optionalTables[1] && !m_density.read(file)) return false;
+  return this->verifyTables();
+}
+
+//***********************************************************************
+
+void EosTabulated::writeTables(const std::string& tableFile, const std::vector<double>& parameters) const
+{
+  if (rankCpu != 0) return;
+  //Written in a temporary file renamed once complete, a partial file is never read
+  std::string temporaryFile(tableFile + ".tmp");
+  std::ofstream file(temporaryFile.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file) return;
+  int nameSize(m_name.size()), numberParameters(parameters.size());
+  int optionalTables[2] = {m_pressure.isBuilt(), m_density.isBuilt()};
+  file.write(tableMagic, 8);
+  file.write(reinterpret_cast<const char*>(&tableVersion), sizeof(int));
+  file.write(reinterpret_cast<const char*>(&nameSize), sizeof(int));
+  file.write(m_name.c_str(), nameSize);
+  file.write(reinterpret_cast<const char*>(&numberParameters), sizeof(int));
+  file.write(reinterpret_cast<const char*>(parameters.data()), numberParameters * sizeof(double));
+  file.write(reinterpret_cast<const char*>(optionalTables), sizeof(optionalTables));
+  m_temperature.write(file);
+  m_energy.write(file);
+  m_soundSpeed.write(file);
+  if (optionalTables[0]) m_pressure.write(file);
+  if (optionalTables[1]) m_density.write(file);
+  file.close();
+  if (file) std::rename(temporaryFile.c_str(), tableFile.c_str());
+}
+
+//***********************************************************************
+
+bool EosTabulated::verifyTables() const
+{
+  const Eos* wrapped(m_eos);
+  const int numberNodes(64);
+  const double tolerance(1.e-10);
+  bool valid(true);
+  valid = valid && m_temperature.verifyNodes([wrapped](const double& d, const double& p) { return wrapped->computeTemperature(d, p); }, numberNodes,
+                                             tolerance);
+  valid = valid && m_energy.verifyNodes([wrapped](const double& d, const double& p) { return wrapped->computeEnergy(d, p); }, numberNodes, tolerance);
+  valid = valid && m_soundSpeed.verifyNodes([wrapped](const double& d, const double& p) { return wrapped->computeSoundSpeed(d, p); }, numberNodes,
+                                            tolerance);
+  if (m_pressure.isBuilt()) {
+    valid = valid && m_pressure.verifyNodes([wrapped](const double& d, const double& e) { return wrapped->computePressure(d, e); }, numberNodes,
+                                            tolerance);
+  }
+  if (m_density.isBuilt()) {
+    valid = valid && m_density.verifyNodes([wrapped](const double& p, const double& T) { return wrapped->computeDensity(p, T); }, numberNodes,
+                                           tolerance);
+  }
+  return valid;
+}
+
+//***********************************************************************
+
+void EosTabulated::computeConsistencyError()
+{
+  m_consistencyError = 0.;
+  if (!m_pressure.isBuilt() && !m_density.isBuilt()) return;
+  for (int j = 0; j < m_energy.getNumberPointsY() - 1; j++) {
+    double pressure(m_energy.positionY(j + 0.5));
+    for (int i = 0; i < m_energy.getNumberPointsX() - 1; i++) {
+      double density(m_energy.positionX(i + 0.5));
+      //Round trip p -> e(rho, p) -> p(rho, e)
+      if (m_pressure.isBuilt()) {
+        double energy(m_energy.interpolate(density, pressure));
+        if (m_pressure.contains(density, energy)) {
+          m_consistencyError = std::max(m_consistencyError, m_pressure.relativeError(pressure, m_pressure.interpolate(density, energy)));
+        }
+      }
+      //Round trip rho -> T(rho, p) -> rho(p, T)
+      if (m_density.isBuilt()) {
+        double temperature(m_temperature.interpolate(density, pressure));
+        if (m_density.contains(pressure, temperature)) {
+          m_consistencyError = std::max(m_consistencyError, m_density.relativeError(density, m_density.interpolate(pressure, temperature)));
+        }
+      }
+    }
+  }
+}
+
+//***********************************************************************
@@ -0,0 +1,179 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef EOSTABULATED_H
+#define EOSTABULATED_H
+
+#include "Eos.h"
+#include "../Maths/InterpolationTable.h"
+
+//! \class     EosTabulated
+//! \brief     Tabulated version of any equation of state
+//! \details   The wrapped EOS is sampled at startup (or the tables are loaded from a file written by a previous run) on the
+//!            ranges given in the markup <tabulation> of the EOS file:
+//!            - temperature, internal energy and speed of sound as functions of (density, pressure),
+//!            - pressure as a function of (density, internal energy) if an energy range is given,
+//!            - density as a function of (pressure, temperature) if a temperature range is given.
+//!            The second variable of each table is the second argument of the corresponding method of the wrapped EOS.
+//!            Values are then given by monotone bicubic interpolation (see InterpolationTable), the relative error being
+//!            lower than the required tolerance. The wrapped EOS is used outside the tables and for all the other methods.
+class EosTabulated : public Eos
+{
+  public:
+    //! \brief     EosTabulated constructor
+    //! \param     eos              wrapped EOS (deleted with the tabulated EOS)
+    //! \param     number           number of the wrapped EOS
+    //! \param     element          XML element <tabulation>
+    //! \param     fileName         name of the EOS file (error messages)
+    //! \param     folder           folder of the EOS files, where the table file is stored
+    EosTabulated(Eos* eos, int& number, tinyxml2::XMLElement* element, const std::string& fileName, const std::string& folder);
+    ~EosTabulated() override;
+
+    //! \brief     Assign the parameters of the wrapped EOS (the tables are not updated)
+    void assignParametersEos(std::string name, std::vector<double> parametersEos) override;
+
+    //Tabulated methods
+    double computeTemperature(const double& density, const double& pressure) const override;
+    double computeEnergy(const double& density, const double& pressure) const override;
+    double computePressure(const double& density, const double& energy) const override;
+    double computeDensity(const double& pressure, const double& temperature) const override;
+    double computeSoundSpeed(const double& density, const double& pressure) const override;
+    void computeTemperatureBatch(const int& numberStates, const double* density, const double* pressure, double* temperature) const override;
+    void computeEnergyBatch(const int& numberStates, const double* density, const double* pressure, double* energy) const override;
+    void computeSoundSpeedBatch(const int& numberStates, const double* density, const double* pressure, double* soundSpeed) const override;
+
+    //Methods of the wrapped EOS
+    double computeInterfaceSoundSpeed(const double& density, const double& interfacePressure, const double& pressure) const override
+    {
+      return m_eos->computeInterfaceSoundSpeed(density, interfacePressure, pressure);
+    };
+    double computeAcousticImpedance(const double& density, const double& pressure) const override
+    {
+      return m_eos->computeAcousticImpedance(density, pressure);
+    };
+    double computeDensityTimesInterfaceSoundSpeedSquare(const double& density, const double& interfacePressure, const double& pressure) const override
+    {
+      return m_eos->computeDensityTimesInterfaceSoundSpeedSquare(density, interfacePressure, pressure);
+    };
+    double computeEntropy(const double& temperature, const double& pressure) const override { return m_eos->computeEntropy(temperature, pressure); };
+    double computePressureIsentropic(const double& initialPressure, const double& initialDensity, const double& finalDensity) const override
+    {
+      return m_eos->computePressureIsentropic(initialPressure, initialDensity, finalDensity);
+    };
+    double computePressureHugoniot(const double& initialPressure, const double& initialDensity, const double& finalDensity) const override
+    {
+      return m_eos->computePressureHugoniot(initialPressure, initialDensity, finalDensity);
+    };
+    double computeDensityIsentropic(const double& initialPressure,
+                                    const double& initialDensity,
+                                    const double& finalPressure,
+                                    double* drhodp = 0) const override
+    {
+      return m_eos->computeDensityIsentropic(initialPressure, initialDensity, finalPressure, drhodp);
+    };
+    double computeDensityHugoniot(const double& initialPressure,
+                                  const double& initialDensity,
+                                  const double& finalPressure,
+                                  double* drhodp = 0) const override
+    {
+      return m_eos->computeDensityHugoniot(initialPressure, initialDensity, finalPressure, drhodp);
+    };
+    double computeDensityPfinal(const double& initialPressure,
+                                const double& initialDensity,
+                                const double& finalPressure,
+                                double* drhodp = 0) const override
+    {
+      return m_eos->computeDensityPfinal(initialPressure, initialDensity, finalPressure, drhodp);
+    };
+    double computeEnthalpyIsentropic(const double& initialPressure,
+                                     const double& initialDensity,
+                                     const double& finalPressure,
+                                     double* dhdp = 0) const override
+    {
+      return m_eos->computeEnthalpyIsentropic(initialPressure, initialDensity, finalPressure, dhdp);
+    };
+    double computeDensitySaturation(const double& pressure, const double& Tsat, const double& dTsatdP, double* drhodp = 0) const override
+    {
+      return m_eos->computeDensitySaturation(pressure, Tsat, dTsatdP, drhodp);
+    };
+    double computeDensityEnergySaturation(const double& pressure, const double& rho, const double& drhodp, double* drhoedp = 0) const override
+    {
+      return m_eos->computeDensityEnergySaturation(pressure, rho, drhodp, drhoedp);
+    };
+    void sendSpecialMixtureEos(double& gamPinfOverGamMinusOne, double& eRef, double& oneOverGamMinusOne, double& covolume) const override
+    {
+      m_eos->sendSpecialMixtureEos(gamPinfOverGamMinusOne, eRef, oneOverGamMinusOne, covolume);
+    };
+    double vfpfh(const double& pressure, const double& enthalpy) const override { return m_eos->vfpfh(pressure, enthalpy); };
+    double dvdpch(const double& pressure, const double& enthalpy) const override { return m_eos->dvdpch(pressure, enthalpy); };
+    double dvdhcp(const double& pressure) const override { return m_eos->dvdhcp(pressure); };
+    double drhodpcT(const double& pressure, const double& temperature) const override { return m_eos->drhodpcT(pressure, temperature); };
+    double dedrho(const double& density, const double& temperature) const override { return m_eos->dedrho(density, temperature); };
+    double dedrhoSecond(const double& density, const double& temperature) const override { return m_eos->dedrhoSecond(density, temperature); };
+    void verifyPressure(const double& pressure, const std::string& message = " ") const override { m_eos->verifyPressure(pressure, message); };
+    void verifyAndModifyPressure(double& pressure) const override { m_eos->verifyAndModifyPressure(pressure); };
+    void verifyAndCorrectDensityMax(const double& mass, double& alpha, double& density) const override
+    {
+      m_eos->verifyAndCorrectDensityMax(mass, alpha, density);
+    };
+    void verifyAndCorrectDensityMax(double& density) const override { m_eos->verifyAndCorrectDensityMax(density); };
+
+    //Get
+    //! \brief  Type of the wrapped EOS
+    TypeEOS getType() const override { return m_eos->getType(); };
+    const double& getGamma() const override { return m_eos->getGamma(); };
+    const double& getPInf() const override { return m_eos->getPInf(); };
+    const double& getCv() const override { return m_eos->getCv(); };
+    const double& getERef() const override { return m_eos->getERef(); };
+    const double& getSRef() const override { return m_eos->getSRef(); };
+    //! \brief  Maximum relative error measured on the round trips between the tables (thermodynamic consistency)
+    const double& getConsistencyError() const { return m_consistencyError; };
+
+  private:
+    //! \brief     Read the tables from the file
+    //! \return    false if the file does not exist or does not match the tabulation parameters or the wrapped EOS
+    bool readTables(const std::string& tableFile, const std::vector<double>& parameters);
+    //! \brief     Write the tables in the file (first CPU only)
+    void writeTables(const std::string& tableFile, const std::vector<double>& parameters) const;
+    //! \brief     Check the tables against the wrapped EOS on a sample of nodes (tables loaded from a file)
+    bool verifyTables() const;
+    //! \brief     Measure the relative errors of the round trips p(rho, e(rho, p)) and rho(p, T(rho, p))
+    void computeConsistencyError();
+
+    Eos* m_eos;                       //!< Wrapped EOS
+    InterpolationTable m_temperature; //!< Temperature (density, pressure)
+    InterpolationTable m_energy;      //!< Internal energy (density, pressure)
+    InterpolationTable m_soundSpeed;  //!< Speed of sound (density, pressure)
+    InterpolationTable m_pressure;    //!< Pressure (density, internal energy), optional
+    InterpolationTable m_density;     //!< Density (pressure, temperature), optional
+    double m_consistencyError;        //!< Maximum relative error of the round trips between tables
+};
+
+#endif // EOSTABULATED_H
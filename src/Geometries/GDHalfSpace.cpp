@@ -85,7 +85,7 @@ GDHalfSpace::GDHalfSpace(std::string name,
   //---------------------------------------------
   //Inialize random number generator
   // int rank;
-  // MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  // MPI_Comm_rank(computingComm, &rank);
   // srand(rank);
 }
 
@@ -0,0 +1,863 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Checkpoint.h"
+#include "../Run.h"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
+//Macro for system interactions (creation of folders)
+#ifdef WIN32
+  #include <direct.h>
+#else
+  #include <sys/types.h>
+  #include <sys/stat.h>
+#endif
+
+static const char checkpointMagic[9]         = "ECOGENCP";
+static const unsigned int checkpointEndian   = 0x01020304;
+static const int checkpointVersion           = 2;
+static const MPI_Offset checkpointChunkBytes = 1 << 30; //Maximum size of a single MPI-IO call (bytes)
+static const int checkpointIndexSize         = 3;       //Index record of a level-0 cell: key, tree offset, leaf offset
+
+//Helpers to fill and read the checkpoint header
+template <typename T> static void appendToHeader(std::string& header, const T& value)
+{
+  header.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void appendToHeader(std::string& header, const std::string& value)
+{
+  long long size(value.size());
+  appendToHeader(header, size);
+  header.append(value);
+}
+
+template <typename T> static void extractFromHeader(const std::string& header, std::size_t& position, T& value)
+{
+  if (position + sizeof(T) > header.size()) throw ErrorInput("checkpoint header is truncated");
+  std::memcpy(&value, header.data() + position, sizeof(T));
+  position += sizeof(T);
+}
+
+static void extractFromHeader(const std::string& header, std::size_t& position, std::string& value)
+{
+  long long size(0);
+  extractFromHeader(header, position, size);
+  if (size < 0 || position + size > header.size()) throw ErrorInput("checkpoint header is truncated");
+  value.assign(header.data() + position, size);
+  position += size;
+}
+
+//Bits mixing of the checksums (splitmix64 finalizer)
+static unsigned long long mixBits(unsigned long long value)
+{
+  value ^= value >> 30;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31;
+  return value;
+}
+
+//***********************************************************************
+
+Checkpoint::Checkpoint(const std::string& folderOutput, int iterFreq, Run* run) :
+  m_run(run),
+  m_cellRef(0),
+  m_folder(folderOutput + "checkpoints/"),
+  m_iterFreq(iterFreq),
+  m_number(0),
+  m_numberFields(0),
+  m_numberCellsLvl0(0),
+  m_treeBytes(0),
+  m_numberLeaves(0),
+  m_headerSize(0)
+{
+  if (rankCpu == 0 && m_iterFreq > 0) {
+#ifdef WIN32
+    _mkdir(m_folder.c_str());
+#else
+    mkdir(m_folder.c_str(), S_IRWXU);
+#endif
+  }
+  MPI_Barrier(computingComm);
+}
+
+//***********************************************************************
+
+Checkpoint::~Checkpoint() {}
+
+//***********************************************************************
+
+bool Checkpoint::isToWrite(const int& iteration, const bool& computationEnded) const
+{
+  if (m_iterFreq <= 0) return false;
+  return (iteration % m_iterFreq == 0) || computationEnded;
+}
+
+//***********************************************************************
+
+void Checkpoint::write(Mesh* mesh, TypeMeshContainer<Cell*>* cellsLvl)
+{
+  double startTime(MPI_Wtime());
+  m_number++;
+  if (rankCpu == 0) std::cout << "T" << m_run->m_numTest << " | Writing checkpoint number: " << m_number << "... " << std::flush;
+
+  //1) Fields and global ordering of the data
+  //-----------------------------------------
+  std::vector<Field> fields;
+  this->listFields(fields);
+  m_numberFields = fields.size();
+  Layout layout;
+  this->buildLayout(mesh, cellsLvl, layout);
+  this->computeSegments(mesh, layout, true);
+  if (mesh->getType() != AMR) {
+    m_numberCellsCpu.resize(Ncpu);
+    MPI_Allgather(&layout.numberLeaves, 1, MPI_LONG_LONG, m_numberCellsCpu.data(), 1, MPI_LONG_LONG, computingComm);
+  }
+  int numberSegments(layout.segments.size()), maxSegments(0);
+  MPI_Allreduce(&numberSegments, &maxSegments, 1, MPI_INT, MPI_MAX, computingComm);
+
+  //2) Header size (the header itself is written last, with the checksums)
+  //-----------------------------------------------------------------------
+  m_checksums.assign(fields.size() + 2, 0);
+  long long headerSize(0);
+  if (rankCpu == 0) headerSize = this->buildHeader(mesh, m_checksums).size();
+  MPI_Bcast(&headerSize, 1, MPI_LONG_LONG, 0, computingComm);
+  m_headerSize = headerSize;
+
+  std::string file(this->createFilename(m_number));
+  std::string fileTmp(file + ".tmp");
+  MPI_File fileHandle;
+  if (MPI_File_open(computingComm, const_cast<char*>(fileTmp.c_str()), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fileHandle) != MPI_SUCCESS) {
+    throw ErrorECOGEN("Checkpoint::write: impossible to open file " + fileTmp, __FILE__, __LINE__);
+  }
+  MPI_File_set_size(fileHandle, 0);
+
+  //3) AMR index and refinement bitmasks
+  //------------------------------------
+  std::vector<unsigned long long> localChecksums(m_checksums.size(), 0);
+  if (mesh->getType() == AMR) {
+    std::vector<long long> index;
+    long long firstCell(0), firstTreeByte(0);
+    for (int s = 0; s < maxSegments; s++) {
+      index.clear();
+      MPI_Offset offset(m_headerSize), offsetTree(m_headerSize + (m_numberCellsLvl0 + 1) * checkpointIndexSize * sizeof(long long));
+      const unsigned char* tree(nullptr);
+      long long treeBytes(0);
+      if (s < numberSegments) {
+        const Segment& segment(layout.segments[s]);
+        for (long long c = firstCell; c < firstCell + segment.numberCells; c++) {
+          index.push_back(static_cast<long long>(layout.cellsLvl0[c]->getElement()->getKey().getIndex()));
+          index.push_back(segment.treeStart + layout.treeStarts[c] - firstTreeByte);
+          index.push_back(segment.leafStart + layout.leafStarts[c] - layout.leafStarts[firstCell]);
+        }
+        localChecksums[0] += checksum(index.data(), index.size(), segment.position * checkpointIndexSize);
+        offset += segment.position * checkpointIndexSize * sizeof(long long);
+        offsetTree += segment.treeStart;
+        tree      = layout.tree.data() + firstTreeByte;
+        treeBytes = segment.treeBytes;
+        localChecksums[1] += checksum(tree, treeBytes, segment.treeStart);
+        firstCell += segment.numberCells;
+        firstTreeByte += segment.treeBytes;
+      }
+      writeAll(fileHandle, offset, reinterpret_cast<const char*>(index.data()), index.size() * sizeof(long long));
+      writeAll(fileHandle, offsetTree, reinterpret_cast<const char*>(tree), treeBytes);
+    }
+    if (rankCpu == 0) {
+      //Last record gives the end of the bitmasks and of the leaves
+      long long end[checkpointIndexSize] = {-1, m_treeBytes, m_numberLeaves};
+      localChecksums[0] += checksum(end, checkpointIndexSize, m_numberCellsLvl0 * checkpointIndexSize);
+      MPI_File_write_at(fileHandle, m_headerSize + m_numberCellsLvl0 * checkpointIndexSize * sizeof(long long), end,
+                        checkpointIndexSize, MPI_LONG_LONG, MPI_STATUS_IGNORE);
+    }
+  }
+
+  //4) Fields, leaves in global order
+  //---------------------------------
+  std::vector<double> dataset, orderedDataset;
+  for (unsigned int f = 0; f < fields.size(); f++) {
+    const int components(fields[f].components);
+    mesh->getData(cellsLvl, dataset, fields[f].var, fields[f].phase);
+    if (mesh->getType() == AMR) {
+      orderedDataset.resize(dataset.size());
+      for (std::size_t l = 0; l < layout.leavesIndices.size(); l++) {
+        for (int c = 0; c < components; c++) orderedDataset[l * components + c] = dataset[layout.leavesIndices[l] * components + c];
+      }
+      dataset.swap(orderedDataset);
+    }
+    long long firstLeaf(0);
+    for (int s = 0; s < maxSegments; s++) {
+      MPI_Offset offset(this->getFieldOffset(fields, f));
+      const double* data(nullptr);
+      long long number(0);
+      if (s < numberSegments) {
+        const Segment& segment(layout.segments[s]);
+        offset += segment.leafStart * components * sizeof(double);
+        data   = dataset.data() + firstLeaf * components;
+        number = segment.numberLeaves * components;
+        localChecksums[f + 2] += checksum(data, number, segment.leafStart * components);
+        firstLeaf += segment.numberLeaves;
+      }
+      writeAll(fileHandle, offset, reinterpret_cast<const char*>(data), number * sizeof(double));
+    }
+  }
+
+  //5) Header with checksums
+  //------------------------
+  MPI_Allreduce(localChecksums.data(), m_checksums.data(), m_checksums.size(), MPI_UNSIGNED_LONG_LONG, MPI_SUM, computingComm);
+  if (rankCpu == 0) {
+    std::string header(this->buildHeader(mesh, m_checksums));
+    MPI_File_write_at(fileHandle, 0, const_cast<char*>(header.data()), header.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+  MPI_File_close(&fileHandle);
+
+  //6) Validation of the checkpoint (a partially written file never replaces a valid one)
+  //-------------------------------------------------------------------------------------
+  MPI_Barrier(computingComm);
+  if (rankCpu == 0) {
+    std::remove(file.c_str());
+    if (std::rename(fileTmp.c_str(), file.c_str()) != 0) {
+      throw ErrorECOGEN("Checkpoint::write: impossible to rename file " + fileTmp, __FILE__, __LINE__);
+    }
+    std::cout << "OK in " << MPI_Wtime() - startTime << " seconds" << std::endl;
+  }
+  MPI_Barrier(computingComm);
+}
+
+//***********************************************************************
+
+void Checkpoint::readHeader(const int& checkpointNumber, Mesh* mesh)
+{
+  //1) Reading of the header by CPU 0 and broadcast
+  //-----------------------------------------------
+  std::string file(this->createFilename(checkpointNumber));
+  MPI_File fileHandle;
+  if (MPI_File_open(computingComm, const_cast<char*>(file.c_str()), MPI_MODE_RDONLY, MPI_INFO_NULL, &fileHandle) != MPI_SUCCESS) {
+    throw ErrorInput("failed to open checkpoint file: " + file);
+  }
+  long long headerSize(0);
+  std::string header(24, '\0');
+  if (rankCpu == 0) {
+    MPI_Offset fileSize(0);
+    MPI_File_get_size(fileHandle, &fileSize);
+    if (fileSize >= 24) {
+      MPI_File_read_at(fileHandle, 0, &header[0], 24, MPI_BYTE, MPI_STATUS_IGNORE);
+      std::memcpy(&headerSize, &header[16], sizeof(headerSize));
+      if (header.compare(0, 8, checkpointMagic) != 0 || headerSize < 24 || headerSize > fileSize) headerSize = 0;
+    }
+  }
+  MPI_Bcast(&headerSize, 1, MPI_LONG_LONG, 0, computingComm);
+  if (headerSize == 0) {
+    MPI_File_close(&fileHandle);
+    throw ErrorInput("invalid checkpoint file: " + file);
+  }
+  header.resize(headerSize);
+  if (rankCpu == 0) MPI_File_read_at(fileHandle, 0, &header[0], headerSize, MPI_BYTE, MPI_STATUS_IGNORE);
+  MPI_Bcast(&header[0], headerSize, MPI_BYTE, 0, computingComm);
+  MPI_File_close(&fileHandle);
+  m_headerSize = headerSize;
+
+  //2) Checking compatibility with the current simulation
+  //-----------------------------------------------------
+  std::size_t position(8);
+  unsigned int endian(0);
+  int version(0), numberCpu(0), meshType(0), lvlMax(0), numberPhases(0), numberTransports(0), numFichier(0);
+  long long iteration(0);
+  double compTime(0.), AMRTime(0.), comTime(0.);
+  std::string modelName;
+  extractFromHeader(header, position, endian);
+  if (endian != checkpointEndian) throw ErrorInput("checkpoint written with a different byte order: " + file);
+  extractFromHeader(header, position, version);
+  if (version != checkpointVersion) throw ErrorInput("unsupported checkpoint version: " + file);
+  extractFromHeader(header, position, headerSize);
+  extractFromHeader(header, position, numberCpu);
+  extractFromHeader(header, position, meshType);
+  extractFromHeader(header, position, lvlMax);
+  if (meshType != static_cast<int>(mesh->getType()) || lvlMax != mesh->getLvlMax()) {
+    throw ErrorInput("resume simulation not possible - mesh type or AMR level differs from checkpoint file");
+  }
+  if (mesh->getType() != AMR && numberCpu != Ncpu) {
+    throw ErrorInput("resume simulation not possible - number of CPU differs from checkpoint file (only AMR checkpoints can be redistributed)");
+  }
+  extractFromHeader(header, position, numberPhases);
+  extractFromHeader(header, position, numberTransports);
+  if (numberPhases != m_run->m_numberPhases || numberTransports != m_run->m_numberTransports) {
+    throw ErrorInput("resume simulation not possible - number of phases or transports differs from checkpoint file");
+  }
+  extractFromHeader(header, position, m_numberFields);
+  extractFromHeader(header, position, m_number);
+  extractFromHeader(header, position, numFichier);
+  extractFromHeader(header, position, iteration);
+  extractFromHeader(header, position, m_run->m_physicalTime);
+  extractFromHeader(header, position, m_run->m_dt);
+  extractFromHeader(header, position, compTime);
+  extractFromHeader(header, position, AMRTime);
+  extractFromHeader(header, position, comTime);
+  extractFromHeader(header, position, modelName);
+  if (modelName != m_run->m_model->whoAmI()) {
+    throw ErrorInput("resume simulation not possible - model differs from checkpoint file (" + modelName + ")");
+  }
+  m_eosNames.resize(numberPhases);
+  for (int phase = 0; phase < numberPhases; phase++) extractFromHeader(header, position, m_eosNames[phase]);
+  extractFromHeader(header, position, m_numberCellsLvl0);
+  extractFromHeader(header, position, m_treeBytes);
+  extractFromHeader(header, position, m_numberLeaves);
+  m_numberCellsCpu.clear();
+  if (mesh->getType() != AMR) {
+    m_numberCellsCpu.resize(Ncpu);
+    for (int p = 0; p < Ncpu; p++) extractFromHeader(header, position, m_numberCellsCpu[p]);
+  }
+  m_checksums.resize(m_numberFields + 2);
+  for (unsigned int c = 0; c < m_checksums.size(); c++) extractFromHeader(header, position, m_checksums[c]);
+
+  //3) Restoring time data
+  //----------------------
+  m_run->m_iteration = static_cast<int>(iteration);
+  m_run->m_dtNext    = m_run->m_dt;
+  TB->physicalTime   = m_run->m_physicalTime;
+  m_run->m_stat.setCompTime(compTime, AMRTime, comTime);
+  m_run->m_outPut->setNumFile(numFichier);
+  if (rankCpu == 0) m_run->m_outPut->truncateInfos(numFichier);
+  if (rankCpu == 0 && numberCpu != Ncpu) {
+    std::cout << "T" << m_run->m_numTest << " | Checkpoint written on " << numberCpu << " CPU, redistributed on " << Ncpu << " CPU" << std::endl;
+  }
+}
+
+//***********************************************************************
+
+void Checkpoint::readData(Mesh* mesh,
+                          TypeMeshContainer<Cell*>* cellsLvl,
+                          TypeMeshContainer<Cell*>* cellsLvlGhost,
+                          TypeMeshContainer<CellInterface*>* cellInterfacesLvl,
+                          const std::vector<AddPhys*>& addPhys,
+                          int& nbCellsTotalAMR)
+{
+  //1) Checking fields
+  //------------------
+  std::vector<Field> fields;
+  this->listFields(fields);
+  if (static_cast<int>(fields.size()) != m_numberFields) {
+    throw ErrorInput("resume simulation not possible - number of fields differs from checkpoint file");
+  }
+  for (int phase = 0; phase < m_run->m_numberPhases; phase++) {
+    std::string eosName;
+    if (m_cellRef->getPhase(phase)->getEos() != nullptr) eosName = m_cellRef->getPhase(phase)->getEos()->getName();
+    if (eosName != m_eosNames[phase]) {
+      throw ErrorInput("resume simulation not possible - EOS of phase " + IO::toString(phase) + " differs from checkpoint file (" + m_eosNames[phase] + ")");
+    }
+  }
+
+  std::string file(this->createFilename(m_number));
+  MPI_File fileHandle;
+  if (MPI_File_open(computingComm, const_cast<char*>(file.c_str()), MPI_MODE_RDONLY, MPI_INFO_NULL, &fileHandle) != MPI_SUCCESS) {
+    throw ErrorInput("failed to open checkpoint file: " + file);
+  }
+
+  //2) Tree structure (AMR): index and bitmasks of the local level-0 cells
+  //----------------------------------------------------------------------
+  Layout layout;
+  int numberSegments(0), maxSegments(0);
+  if (mesh->getType() == AMR) {
+    this->buildLayout(mesh, cellsLvl, layout);
+    this->computeSegments(mesh, layout, false);
+    long long numberCellsLvl0(layout.cellsLvl0.size()), totalCellsLvl0(0);
+    MPI_Allreduce(&numberCellsLvl0, &totalCellsLvl0, 1, MPI_LONG_LONG, MPI_SUM, computingComm);
+    if (totalCellsLvl0 != m_numberCellsLvl0) {
+      MPI_File_close(&fileHandle);
+      throw ErrorInput("resume simulation not possible - number of cells differs from checkpoint file");
+    }
+    numberSegments = layout.segments.size();
+    MPI_Allreduce(&numberSegments, &maxSegments, 1, MPI_INT, MPI_MAX, computingComm);
+
+    //Index records (the record following a segment gives its end) and bitmasks of each segment
+    std::vector<unsigned long long> localChecksums(2, 0), checksums(2, 0);
+    std::vector<long long> index;
+    std::vector<unsigned char> tree;
+    std::unordered_map<Cell*, long long> treeStarts;
+    bool validIndex(true);
+    long long firstCell(0);
+    for (int s = 0; s < maxSegments; s++) {
+      MPI_Offset offset(m_headerSize), offsetTree(m_headerSize + (m_numberCellsLvl0 + 1) * checkpointIndexSize * sizeof(long long));
+      long long numberRecords(0), treeBytes(0);
+      if (s < numberSegments) {
+        offset += layout.segments[s].position * checkpointIndexSize * sizeof(long long);
+        numberRecords = layout.segments[s].numberCells + 1;
+      }
+      index.resize(numberRecords * checkpointIndexSize);
+      readAll(fileHandle, offset, reinterpret_cast<char*>(index.data()), index.size() * sizeof(long long));
+      if (s < numberSegments) {
+        Segment& segment(layout.segments[s]);
+        long long numberCells(segment.numberCells);
+        localChecksums[0] += checksum(index.data(), numberCells * checkpointIndexSize, segment.position * checkpointIndexSize);
+        for (long long c = 0; c < numberCells; c++) {
+          if (index[c * checkpointIndexSize] != static_cast<long long>(layout.cellsLvl0[firstCell + c]->getElement()->getKey().getIndex())) validIndex = false;
+          treeStarts[layout.cellsLvl0[firstCell + c]] = tree.size() + index[c * checkpointIndexSize + 1] - index[1];
+        }
+        const long long* end(&index[numberCells * checkpointIndexSize]);
+        if (segment.position + numberCells == m_numberCellsLvl0 && (end[0] != -1 || end[1] != m_treeBytes || end[2] != m_numberLeaves)) validIndex = false;
+        segment.treeStart    = index[1];
+        segment.treeBytes    = end[1] - index[1];
+        segment.leafStart    = index[2];
+        segment.numberLeaves = end[2] - index[2];
+        if (segment.treeBytes < 0 || segment.numberLeaves < 0 || segment.treeStart + segment.treeBytes > m_treeBytes) validIndex = false;
+        if (validIndex) {
+          offsetTree += segment.treeStart;
+          treeBytes = segment.treeBytes;
+        }
+        firstCell += numberCells;
+      }
+      std::size_t treePosition(tree.size());
+      tree.resize(treePosition + treeBytes);
+      readAll(fileHandle, offsetTree, reinterpret_cast<char*>(tree.data() + treePosition), treeBytes);
+      if (s < numberSegments) localChecksums[1] += checksum(tree.data() + treePosition, treeBytes, layout.segments[s].treeStart);
+    }
+    if (rankCpu == 0) {
+      long long end[checkpointIndexSize] = {-1, m_treeBytes, m_numberLeaves};
+      localChecksums[0] += checksum(end, checkpointIndexSize, m_numberCellsLvl0 * checkpointIndexSize);
+    }
+    MPI_Allreduce(localChecksums.data(), checksums.data(), 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, computingComm);
+    int error(!validIndex), globalError(0);
+    MPI_Allreduce(&error, &globalError, 1, MPI_INT, MPI_MAX, computingComm);
+    if (globalError || checksums[0] != m_checksums[0] || checksums[1] != m_checksums[1]) {
+      MPI_File_close(&fileHandle);
+      throw ErrorInput("corrupted checkpoint file " + file + " - checksum error on AMR tree");
+    }
+
+    //Split flags level by level, level-0 cells taken in the order of the level arrays
+    int numberChildren(2);
+    if (mesh->getNumberCellsZ() != 1) numberChildren = 8;
+    else if (mesh->getNumberCellsY() != 1) numberChildren = 4;
+    std::vector<std::vector<int>> splitFlagsLvl(mesh->getLvlMax() + 1);
+    for (unsigned int c = 0; c < cellsLvl[0].size(); c++) {
+      long long bit(treeStarts[cellsLvl[0][c]] * 8);
+      if (!this->decodeTree(tree.data(), tree.size(), bit, 0, mesh->getLvlMax(), numberChildren, splitFlagsLvl)) error = 1;
+    }
+    MPI_Allreduce(&error, &globalError, 1, MPI_INT, MPI_MAX, computingComm);
+    if (globalError) {
+      MPI_File_close(&fileHandle);
+      throw ErrorInput("resume simulation not possible - tree structure differs from checkpoint file");
+    }
+    std::vector<int> splitFlags;
+    for (unsigned int lvl = 0; lvl < splitFlagsLvl.size(); lvl++) splitFlags.insert(splitFlags.end(), splitFlagsLvl[lvl].begin(), splitFlagsLvl[lvl].end());
+    Output::buildTree(splitFlags, mesh, cellsLvl, cellsLvlGhost, cellInterfacesLvl, addPhys, nbCellsTotalAMR);
+
+    //Leaves of the rebuilt tree in global order
+    std::vector<Segment> segments(layout.segments);
+    this->buildLayout(mesh, cellsLvl, layout);
+    layout.segments = segments;
+    long long numberLeaves(0);
+    for (unsigned int s = 0; s < segments.size(); s++) numberLeaves += segments[s].numberLeaves;
+    error = (layout.tree != tree || layout.numberLeaves != numberLeaves);
+    MPI_Allreduce(&error, &globalError, 1, MPI_INT, MPI_MAX, computingComm);
+    if (globalError) {
+      MPI_File_close(&fileHandle);
+      throw ErrorInput("resume simulation not possible - tree structure differs from checkpoint file");
+    }
+  }
+  else {
+    this->buildLayout(mesh, cellsLvl, layout);
+    this->computeSegments(mesh, layout, true);
+    int error(layout.numberLeaves != m_numberCellsCpu[rankCpu]), globalError(0);
+    MPI_Allreduce(&error, &globalError, 1, MPI_INT, MPI_MAX, computingComm);
+    if (globalError) {
+      MPI_File_close(&fileHandle);
+      throw ErrorInput("resume simulation not possible - number of cells differs from checkpoint file");
+    }
+    numberSegments = layout.segments.size();
+    MPI_Allreduce(&numberSegments, &maxSegments, 1, MPI_INT, MPI_MAX, computingComm);
+  }
+
+  //3) Fields, leaves in global order
+  //---------------------------------
+  std::vector<double> dataset, orderedDataset;
+  for (unsigned int f = 0; f < fields.size(); f++) {
+    const int components(fields[f].components);
+    orderedDataset.resize(layout.numberLeaves * components);
+    unsigned long long localChecksum(0), globalChecksum(0);
+    long long firstLeaf(0);
+    for (int s = 0; s < maxSegments; s++) {
+      MPI_Offset offset(this->getFieldOffset(fields, f));
+      long long number(0);
+      if (s < numberSegments) {
+        offset += layout.segments[s].leafStart * components * sizeof(double);
+        number = layout.segments[s].numberLeaves * components;
+      }
+      readAll(fileHandle, offset, reinterpret_cast<char*>(orderedDataset.data() + firstLeaf * components), number * sizeof(double));
+      if (s < numberSegments) {
+        localChecksum += checksum(orderedDataset.data() + firstLeaf * components, number, layout.segments[s].leafStart * components);
+        firstLeaf += layout.segments[s].numberLeaves;
+      }
+    }
+    MPI_Allreduce(&localChecksum, &globalChecksum, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, computingComm);
+    if (globalChecksum != m_checksums[f + 2]) {
+      MPI_File_close(&fileHandle);
+      throw ErrorInput("corrupted checkpoint file " + file + " - checksum error on field " + fields[f].name);
+    }
+    if (mesh->getType() == AMR) {
+      dataset.resize(orderedDataset.size());
+      for (std::size_t l = 0; l < layout.leavesIndices.size(); l++) {
+        for (int c = 0; c < components; c++) dataset[layout.leavesIndices[l] * components + c] = orderedDataset[l * components + c];
+      }
+      mesh->setDataSet(dataset, cellsLvl, fields[f].var, fields[f].phase);
+    }
+    else {
+      mesh->setDataSet(orderedDataset, cellsLvl, fields[f].var, fields[f].phase);
+    }
+  }
+  MPI_File_close(&fileHandle);
+}
+
+//***********************************************************************
+
+void Checkpoint::listFields(std::vector<Field>& fields) const
+{
+  fields.clear();
+  Field field;
+  //Phases variables
+  for (int phase = 0; phase < m_run->m_numberPhases; phase++) {
+    field.phase      = phase;
+    field.components = 1;
+    for (int var = 1; var <= m_cellRef->getPhase(phase)->getNumberScalars(); var++) {
+      field.name = "F" + IO::toString(phase) + "_" + m_cellRef->getPhase(phase)->returnNameScalar(var);
+      field.var  = var;
+      fields.push_back(field);
+    }
+    field.components = 3;
+    for (int var = 1; var <= m_cellRef->getPhase(phase)->getNumberVectors(); var++) {
+      field.name = "F" + IO::toString(phase) + "_" + m_cellRef->getPhase(phase)->returnNameVector(var);
+      field.var  = -var;
+      fields.push_back(field);
+    }
+  }
+  //Mixture variables
+  if (m_run->m_numberPhases > 1) {
+    field.phase      = -1;
+    field.components = 1;
+    for (int var = 1; var <= m_cellRef->getMixture()->getNumberScalars(); var++) {
+      field.name = m_cellRef->getMixture()->returnNameScalar(var);
+      field.var  = var;
+      fields.push_back(field);
+    }
+    field.components = 3;
+    for (int var = 1; var <= m_cellRef->getMixture()->getNumberVectors(); var++) {
+      field.name = m_cellRef->getMixture()->returnNameVector(var);
+      field.var  = -var;
+      fields.push_back(field);
+    }
+  }
+  //Transports
+  field.phase      = -2;
+  field.components = 1;
+  for (int var = 1; var <= m_run->m_numberTransports; var++) {
+    field.name = "T" + IO::toString(var);
+    field.var  = var;
+    fields.push_back(field);
+  }
+  //xi indicator for AMR
+  if (m_run->m_mesh->getType() == AMR) {
+    field.name  = "Xi";
+    field.var   = 1;
+    field.phase = -3;
+    fields.push_back(field);
+  }
+}
+
+//***********************************************************************
+
+std::string Checkpoint::createFilename(const int& number) const
+{
+  std::stringstream name;
+  name << m_folder << "checkpoint_" << number << ".ecp";
+  return name.str();
+}
+
+//***********************************************************************
+
+std::string Checkpoint::buildHeader(Mesh* mesh, const std::vector<unsigned long long>& checksums) const
+{
+  std::string header;
+  long long headerSize(0);
+  header.append(checkpointMagic, 8);
+  appendToHeader(header, checkpointEndian);
+  appendToHeader(header, checkpointVersion);
+  appendToHeader(header, headerSize); //Updated below
+  appendToHeader(header, Ncpu);
+  appendToHeader(header, static_cast<int>(mesh->getType()));
+  appendToHeader(header, mesh->getLvlMax());
+  appendToHeader(header, m_run->m_numberPhases);
+  appendToHeader(header, m_run->m_numberTransports);
+  appendToHeader(header, m_numberFields);
+  appendToHeader(header, m_number);
+  appendToHeader(header, m_run->m_outPut->getNumFile());
+  appendToHeader(header, static_cast<long long>(m_run->m_iteration));
+  appendToHeader(header, m_run->m_physicalTime);
+  appendToHeader(header, m_run->m_dtNext);
+  appendToHeader(header, m_run->m_stat.getComputationTime());
+  appendToHeader(header, m_run->m_stat.getAMRTime());
+  appendToHeader(header, m_run->m_stat.getCommunicationTime());
+  appendToHeader(header, m_run->m_model->whoAmI());
+  for (int phase = 0; phase < m_run->m_numberPhases; phase++) {
+    std::string eosName;
+    if (m_cellRef->getPhase(phase)->getEos() != nullptr) eosName = m_cellRef->getPhase(phase)->getEos()->getName();
+    appendToHeader(header, eosName);
+  }
+  appendToHeader(header, m_numberCellsLvl0);
+  appendToHeader(header, m_treeBytes);
+  appendToHeader(header, m_numberLeaves);
+  for (unsigned int p = 0; p < m_numberCellsCpu.size(); p++) appendToHeader(header, m_numberCellsCpu[p]);
+  for (unsigned int c = 0; c < checksums.size(); c++) appendToHeader(header, checksums[c]);
+  headerSize = header.size();
+  std::memcpy(&header[16], &headerSize, sizeof(headerSize));
+  return header;
+}
+
+//***********************************************************************
+
+void Checkpoint::buildLayout(Mesh* mesh, TypeMeshContainer<Cell*>* cellsLvl, Layout& layout) const
+{
+  layout.cellsLvl0.assign(cellsLvl[0].begin(), cellsLvl[0].end());
+  layout.treeStarts.clear();
+  layout.leafStarts.clear();
+  layout.tree.clear();
+  layout.leavesIndices.clear();
+  if (mesh->getType() == AMR) {
+    //Level-0 cells in key order, leaves in depth-first order inside each level-0 cell
+    std::sort(layout.cellsLvl0.begin(), layout.cellsLvl0.end(), [](Cell* cell0, Cell* cell1) {
+      return cell0->getElement()->getKey() < cell1->getElement()->getKey();
+    });
+    std::vector<Cell*> leaves;
+    for (unsigned int c = 0; c < layout.cellsLvl0.size(); c++) {
+      layout.treeStarts.push_back(layout.tree.size());
+      layout.leafStarts.push_back(leaves.size());
+      int bit(0);
+      this->encodeTree(layout.cellsLvl0[c], mesh->getLvlMax(), layout.tree, bit, leaves);
+    }
+    //Position of each leaf in the Mesh::getData() order (levels then cells)
+    std::unordered_map<Cell*, long long> getDataIndices;
+    long long index(0);
+    for (int lvl = 0; lvl <= mesh->getLvlMax(); lvl++) {
+      for (unsigned int c = 0; c < cellsLvl[lvl].size(); c++) {
+        if (!cellsLvl[lvl][c]->getSplit()) getDataIndices[cellsLvl[lvl][c]] = index++;
+      }
+    }
+    layout.leavesIndices.resize(leaves.size());
+    for (std::size_t l = 0; l < leaves.size(); l++) layout.leavesIndices[l] = getDataIndices[leaves[l]];
+    layout.numberLeaves = leaves.size();
+  }
+  else {
+    std::vector<double> dataset;
+    mesh->getData(cellsLvl, dataset, 1, 0);
+    layout.numberLeaves = dataset.size();
+  }
+}
+
+//***********************************************************************
+
+void Checkpoint::encodeTree(Cell* cell, const int& lvlMax, std::vector<unsigned char>& tree, int& bit, std::vector<Cell*>& leaves) const
+{
+  //Cells of the highest level cannot be split: no flag
+  if (cell->getLvl() < lvlMax) {
+    if (bit % 8 == 0) tree.push_back(0);
+    if (cell->getSplit()) tree.back() |= static_cast<unsigned char>(1 << (bit % 8));
+    bit++;
+  }
+  if (cell->getSplit()) {
+    for (int i = 0; i < cell->getNumberCellsChildren(); i++) this->encodeTree(cell->getCellChild(i), lvlMax, tree, bit, leaves);
+  }
+  else {
+    leaves.push_back(cell);
+  }
+}
+
+//***********************************************************************
+
+bool Checkpoint::decodeTree(const unsigned char* tree,
+                            long long size,
+                            long long& bit,
+                            int lvl,
+                            const int& lvlMax,
+                            const int& numberChildren,
+                            std::vector<std::vector<int>>& splitFlags) const
+{
+  int split(0);
+  if (lvl < lvlMax) {
+    if (bit >= 8 * size) return false;
+    split = (tree[bit / 8] >> (bit % 8)) & 1;
+    bit++;
+  }
+  splitFlags[lvl].push_back(split);
+  if (split) {
+    for (int i = 0; i < numberChildren; i++) {
+      if (!this->decodeTree(tree, size, bit, lvl + 1, lvlMax, numberChildren, splitFlags)) return false;
+    }
+  }
+  return true;
+}
+
+//***********************************************************************
+
+void Checkpoint::computeSegments(Mesh* mesh, Layout& layout, bool globalOffsets)
+{
+  layout.segments.clear();
+  Segment segment;
+  if (mesh->getType() == AMR) {
+    //Consecutive level-0 cells in the global ordering form a segment
+    long long previousPosition(-2);
+    for (unsigned int c = 0; c < layout.cellsLvl0.size(); c++) {
+      long long position(mesh->getPositionCellLvl0(layout.cellsLvl0[c]));
+      long long treeBytes((c + 1 < layout.treeStarts.size() ? layout.treeStarts[c + 1] : layout.tree.size()) - layout.treeStarts[c]);
+      long long numberLeaves((c + 1 < layout.leafStarts.size() ? layout.leafStarts[c + 1] : layout.numberLeaves) - layout.leafStarts[c]);
+      if (position != previousPosition + 1) {
+        segment.position     = position;
+        segment.numberCells  = 0;
+        segment.treeStart    = 0;
+        segment.treeBytes    = 0;
+        segment.leafStart    = 0;
+        segment.numberLeaves = 0;
+        layout.segments.push_back(segment);
+      }
+      layout.segments.back().numberCells++;
+      layout.segments.back().treeBytes += treeBytes;
+      layout.segments.back().numberLeaves += numberLeaves;
+      previousPosition = position;
+    }
+    if (!globalOffsets) return;
+
+    //Offsets from the segments of all CPU sorted by position
+    int numberSegments(layout.segments.size());
+    std::vector<int> numbersSegments(Ncpu), displacements(Ncpu, 0);
+    MPI_Allgather(&numberSegments, 1, MPI_INT, numbersSegments.data(), 1, MPI_INT, computingComm);
+    for (int p = 0; p < Ncpu; p++) {
+      numbersSegments[p] *= 4;
+      if (p > 0) displacements[p] = displacements[p - 1] + numbersSegments[p - 1];
+    }
+    std::vector<long long> localData, globalData(displacements[Ncpu - 1] + numbersSegments[Ncpu - 1]);
+    for (unsigned int s = 0; s < layout.segments.size(); s++) {
+      localData.push_back(layout.segments[s].position);
+      localData.push_back(layout.segments[s].numberCells);
+      localData.push_back(layout.segments[s].treeBytes);
+      localData.push_back(layout.segments[s].numberLeaves);
+    }
+    MPI_Allgatherv(localData.data(), localData.size(), MPI_LONG_LONG, globalData.data(), numbersSegments.data(), displacements.data(), MPI_LONG_LONG,
+                   computingComm);
+    std::map<long long, std::array<long long, 3>> globalSegments; //position -> number of cells, tree bytes, number of leaves
+    for (std::size_t g = 0; g < globalData.size(); g += 4) globalSegments[globalData[g]] = {{globalData[g + 1], globalData[g + 2], globalData[g + 3]}};
+    std::map<long long, std::array<long long, 2>> starts; //position -> tree start, leaf start
+    long long treeStart(0), leafStart(0), numberCellsLvl0(0);
+    for (auto it = globalSegments.begin(); it != globalSegments.end(); ++it) {
+      starts[it->first] = {{treeStart, leafStart}};
+      numberCellsLvl0 += it->second[0];
+      treeStart += it->second[1];
+      leafStart += it->second[2];
+    }
+    for (unsigned int s = 0; s < layout.segments.size(); s++) {
+      layout.segments[s].treeStart = starts[layout.segments[s].position][0];
+      layout.segments[s].leafStart = starts[layout.segments[s].position][1];
+    }
+    m_numberCellsLvl0 = numberCellsLvl0;
+    m_treeBytes       = treeStart;
+    m_numberLeaves    = leafStart;
+  }
+  else {
+    //One segment per CPU, ordered by CPU number
+    long long start(0), total(0);
+    MPI_Exscan(&layout.numberLeaves, &start, 1, MPI_LONG_LONG, MPI_SUM, computingComm);
+    if (rankCpu == 0) start = 0;
+    MPI_Allreduce(&layout.numberLeaves, &total, 1, MPI_LONG_LONG, MPI_SUM, computingComm);
+    segment.position     = start;
+    segment.numberCells  = layout.numberLeaves;
+    segment.treeStart    = 0;
+    segment.treeBytes    = 0;
+    segment.leafStart    = start;
+    segment.numberLeaves = layout.numberLeaves;
+    layout.segments.push_back(segment);
+    m_numberCellsLvl0 = total;
+    m_treeBytes       = 0;
+    m_numberLeaves    = total;
+  }
+}
+
+//***********************************************************************
+
+MPI_Offset Checkpoint::getFieldOffset(const std::vector<Field>& fields, const unsigned int& field) const
+{
+  //Sections: header, index and bitmasks (AMR), then the fields one after the other
+  MPI_Offset offset(m_headerSize + m_treeBytes);
+  if (m_run->m_mesh->getType() == AMR) offset += (m_numberCellsLvl0 + 1) * checkpointIndexSize * sizeof(long long);
+  for (unsigned int f = 0; f < field; f++) offset += fields[f].components * m_numberLeaves * sizeof(double);
+  return offset;
+}
+
+//***********************************************************************
+
+template <typename T> unsigned long long Checkpoint::checksum(const T* values, long long number, long long firstPosition)
+{
+  //Sum of the hashes of (global position, value): the result does not depend on the distribution of the data among CPUs
+  unsigned long long sum(0);
+  for (long long i = 0; i < number; i++) {
+    unsigned long long bits(0);
+    std::memcpy(&bits, &values[i], sizeof(T));
+    sum += mixBits(bits ^ mixBits(static_cast<unsigned long long>(firstPosition + i)));
+  }
+  return sum;
+}
+
+//***********************************************************************
+
+void Checkpoint::writeAll(MPI_File file, MPI_Offset offset, const char* buffer, MPI_Offset size)
+{
+  //Collective calls are split in chunks, all CPUs do the same number of calls
+  long long numberChunks((size + checkpointChunkBytes - 1) / checkpointChunkBytes), maxChunks(0);
+  MPI_Allreduce(&numberChunks, &maxChunks, 1, MPI_LONG_LONG, MPI_MAX, computingComm);
+  for (long long c = 0; c < maxChunks; c++) {
+    MPI_Offset start(std::min(c * checkpointChunkBytes, size));
+    int count(static_cast<int>(std::min(checkpointChunkBytes, size - start)));
+    MPI_File_write_at_all(file, offset + start, const_cast<char*>(buffer) + start, count, MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+}
+
+//***********************************************************************
+
+void Checkpoint::readAll(MPI_File file, MPI_Offset offset, char* buffer, MPI_Offset size)
+{
+  long long numberChunks((size + checkpointChunkBytes - 1) / checkpointChunkBytes), maxChunks(0);
+  MPI_Allreduce(&numberChunks, &maxChunks, 1, MPI_LONG_LONG, MPI_MAX, computingComm);
+  for (long long c = 0; c < maxChunks; c++) {
+    MPI_Offset start(std::min(c * checkpointChunkBytes, size));
+    int count(static_cast<int>(std::min(checkpointChunkBytes, size - start)));
+    MPI_File_read_at_all(file, offset + start, buffer + start, count, MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+}
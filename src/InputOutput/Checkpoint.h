@@ -0,0 +1,153 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <string>
+#include <vector>
+#include <mpi.h>
+#include "../Meshes/HeaderMesh.h"
+#include "../Order1/Cell.h"
+
+class Run;
+
+//! \class     Checkpoint
+//! \brief     Native binary checkpoint/restart files, independent of the visualisation output
+//! \details   One file per checkpoint (results/run/checkpoints/checkpoint_N.ecp) written with collective MPI-IO.
+//!            The file starts with a header (model, number of phases and transports, EOS names, iteration, time,
+//!            time step, sizes and one checksum per section) followed by globally ordered sections:
+//!            - AMR only: an index with one record (Morton key, tree offset, leaf offset) per level-0 cell in key
+//!              order, then the refinement bitmasks of the level-0 cells (split flags in depth-first order),
+//!            - the fields as raw doubles (native byte order, checked at reading), leaves being ordered by level-0
+//!              key then depth-first.
+//!            Fields are the ones needed to resume a simulation: phases, mixture and transport variables, plus the
+//!            xi indicator for AMR. Since nothing depends on the CPU that wrote the data, an AMR checkpoint can be
+//!            read on any number of CPUs: the level-0 cells are distributed by key ranges then load balanced.
+//!            Other meshes must be resumed with the same number of CPUs.
+class Checkpoint
+{
+  public:
+    //! \brief   Checkpoint constructor
+    //! \param   folderOutput  Results folder of the run (checkpoints are stored in its subfolder checkpoints/)
+    //! \param   iterFreq      Writing frequency in number of iterations (0 for reading only)
+    //! \param   run           Run pointer
+    Checkpoint(const std::string& folderOutput, int iterFreq, Run* run);
+    virtual ~Checkpoint();
+
+    //! \brief   Set the reference cell used to list the fields (number of variables per phase)
+    void initializeCheckpoint(const Cell* cellRef) { m_cellRef = cellRef; };
+
+    //! \brief   Return true if a checkpoint has to be written at the end of the current iteration
+    //! \param   iteration         Current iteration number
+    //! \param   computationEnded  True for the last iteration of the simulation
+    bool isToWrite(const int& iteration, const bool& computationEnded) const;
+
+    //! \brief   Write a checkpoint of the current state of the simulation
+    void write(Mesh* mesh, TypeMeshContainer<Cell*>* cellsLvl);
+
+    //! \brief   Read the checkpoint header and restore time data (iteration, time, time step, statistics)
+    //! \param   checkpointNumber  Number of the checkpoint to resume from
+    //! \param   mesh              Mesh object of the current simulation
+    void readHeader(const int& checkpointNumber, Mesh* mesh);
+
+    //! \brief   Read the checkpoint fields (and rebuild the AMR tree if any), checksums are verified
+    void readData(Mesh* mesh,
+                  TypeMeshContainer<Cell*>* cellsLvl,
+                  TypeMeshContainer<Cell*>* cellsLvlGhost,
+                  TypeMeshContainer<CellInterface*>* cellInterfacesLvl,
+                  const std::vector<AddPhys*>& addPhys,
+                  int& nbCellsTotalAMR);
+
+  private:
+    //! \brief   Description of a field saved in the checkpoint
+    struct Field
+    {
+      std::string name; //!<Name used in error messages
+      int var;          //!<Variable number as used by Mesh::getData() (negative for vectors)
+      int phase;        //!<Phase number as used by Mesh::getData() (-1: mixture, -2: transport, -3: xi)
+      int components;   //!<Number of values per cell
+    };
+
+    //! \brief   Set of consecutive level-0 cells of a CPU in the global ordering
+    struct Segment
+    {
+      long long position;     //!<Global position of the first level-0 cell
+      long long numberCells;  //!<Number of level-0 cells
+      long long treeStart;    //!<Global offset of the first refinement bitmask (bytes)
+      long long treeBytes;    //!<Size of the refinement bitmasks (bytes)
+      long long leafStart;    //!<Global position of the first leaf
+      long long numberLeaves; //!<Number of leaves
+    };
+
+    //! \brief   Local part of the globally ordered data
+    struct Layout
+    {
+      std::vector<Cell*> cellsLvl0;          //!<Level-0 cells in global order
+      std::vector<long long> treeStarts;     //!<Local offset of the bitmask of each level-0 cell (AMR)
+      std::vector<long long> leafStarts;     //!<Local position of the first leaf of each level-0 cell (AMR)
+      std::vector<unsigned char> tree;       //!<Refinement bitmasks (AMR)
+      std::vector<long long> leavesIndices;  //!<Index in Mesh::getData() order of each leaf in global order (AMR)
+      std::vector<Segment> segments;         //!<Segments of consecutive level-0 cells
+      long long numberLeaves;                //!<Total number of leaves of the CPU
+    };
+
+    void listFields(std::vector<Field>& fields) const;
+    std::string createFilename(const int& number) const;
+    std::string buildHeader(Mesh* mesh, const std::vector<unsigned long long>& checksums) const;
+    void buildLayout(Mesh* mesh, TypeMeshContainer<Cell*>* cellsLvl, Layout& layout) const;
+    void encodeTree(Cell* cell, const int& lvlMax, std::vector<unsigned char>& tree, int& bit, std::vector<Cell*>& leaves) const;
+    bool decodeTree(const unsigned char* tree, long long size, long long& bit, int lvl, const int& lvlMax, const int& numberChildren,
+                    std::vector<std::vector<int>>& splitFlags) const;
+    void computeSegments(Mesh* mesh, Layout& layout, bool globalOffsets);
+    MPI_Offset getFieldOffset(const std::vector<Field>& fields, const unsigned int& field) const;
+
+    template <typename T> static unsigned long long checksum(const T* values, long long number, long long firstPosition);
+    static void writeAll(MPI_File file, MPI_Offset offset, const char* buffer, MPI_Offset size);
+    static void readAll(MPI_File file, MPI_Offset offset, char* buffer, MPI_Offset size);
+
+    Run* m_run;                   //!<Pointer to run
+    const Cell* m_cellRef;        //!<Reference cell to list the fields
+    std::string m_folder;         //!<Folder of checkpoint files
+    int m_iterFreq;               //!<Writing frequency in number of iterations (0 for reading only)
+    int m_number;                 //!<Number of the last written or read checkpoint
+
+    //Data of the current checkpoint header
+    int m_numberFields;                          //!<Number of fields
+    std::vector<std::string> m_eosNames;         //!<EOS names of the phases
+    long long m_numberCellsLvl0;                 //!<Total number of level-0 cells
+    long long m_treeBytes;                       //!<Total size of the refinement bitmasks (bytes, 0 without AMR)
+    long long m_numberLeaves;                    //!<Total number of leaves (cells without AMR)
+    std::vector<long long> m_numberCellsCpu;     //!<Number of cells of each CPU (only without AMR)
+    std::vector<unsigned long long> m_checksums; //!<Checksums of the index, of the tree and of each field
+    MPI_Offset m_headerSize;                     //!<Size of the header (bytes)
+};
+
+#endif //CHECKPOINT_H
@@ -362,6 +362,26 @@ void Input::inputMain(std::string casTest)
       else {
         throw ErrorXMLDev(fileName.str(), __FILE__, __LINE__);
       }
+      //Get time integration (optional, MUSCL-Hancock predictor-corrector by default)
+      sousElement = element->FirstChildElement("timeIntegration");
+      if (sousElement != NULL) {
+        contenu = sousElement->FirstChild();
+        if (contenu == NULL) throw ErrorXMLElement("timeIntegration", fileName.str(), __FILE__, __LINE__);
+        std::string timeIntegration = contenu->ToText()->Value();
+        Tools::uppercase(timeIntegration);
+        if (timeIntegration == "MUSCLHANCOCK") {
+          m_run->m_timeIntegration = MUSCLHANCOCK;
+        }
+        else if (timeIntegration == "SSPRK2") {
+          m_run->m_timeIntegration = SSPRK2;
+        }
+        else if (timeIntegration == "SSPRK3") {
+          m_run->m_timeIntegration = SSPRK3;
+        }
+        else {
+          throw ErrorXMLDev(fileName.str(), __FILE__, __LINE__);
+        }
+      }
     }
 
     //Reprise de calcul depuis file resultat
@@ -371,7 +391,53 @@ void Input::inputMain(std::string casTest)
       if (error != XML_NO_ERROR) throw ErrorXMLAttribut("resumeFileNumber", fileName.str(), __FILE__, __LINE__);
       error = element->QueryIntAttribute("AMRsaveFreq", &m_run->m_resumeAMRsaveFreq);
       if (error != XML_NO_ERROR) throw ErrorXMLAttribut("AMRsaveFreq", fileName.str(), __FILE__, __LINE__);
+      //Resume from a native binary checkpoint instead of result files (resumeFileNumber is then the checkpoint number)
+      if (element->QueryBoolAttribute("checkpoint", &m_run->m_resumeFromCheckpoint) != XML_NO_ERROR) m_run->m_resumeFromCheckpoint = false;
+    }
+
+    //Native binary checkpoints
+    int checkpointFreq(0);
+    element = computationParam->FirstChildElement("checkpoint");
+    if (element != NULL) {
+      error = element->QueryIntAttribute("iterFreq", &checkpointFreq);
+      if (error != XML_NO_ERROR || checkpointFreq <= 0) throw ErrorXMLAttribut("iterFreq", fileName.str(), __FILE__, __LINE__);
+    }
+    if (checkpointFreq > 0 || m_run->m_resumeFromCheckpoint) {
+      m_run->m_checkpoint = new Checkpoint(m_run->m_outPut->getFolderOutput(), checkpointFreq, m_run);
+    }
+
+    //Compact exchange of the ghost cells between CPUs (optional)
+    element = computationParam->FirstChildElement("communications");
+    if (element != NULL) {
+      if (element->QueryBoolAttribute("compact", &m_run->m_compactExchange) != XML_NO_ERROR) m_run->m_compactExchange = false;
+    }
+
+    //Super time stepping of the diffusive additional physics (optional)
+    element = computationParam->FirstChildElement("diffusiveFluxes");
+    if (element != NULL) {
+      if (element->QueryBoolAttribute("superTimeStepping", &m_run->m_superTimeStepping) != XML_NO_ERROR) m_run->m_superTimeStepping = false;
     }
+
+    //Narrow band around the interfaces for the interface-localized additional physics (optional)
+    element = computationParam->FirstChildElement("narrowBand");
+    if (element != NULL) {
+      int numberLayers(1);
+      double threshold(0.);
+      if (element->QueryIntAttribute("layers", &numberLayers) != XML_NO_ERROR) numberLayers = 1;
+      if (numberLayers < 1) throw ErrorXMLAttribut("layers", fileName.str(), __FILE__, __LINE__);
+      if (element->QueryDoubleAttribute("threshold", &threshold) != XML_NO_ERROR) threshold = 0.;
+      if (threshold < 0.) throw ErrorXMLAttribut("threshold", fileName.str(), __FILE__, __LINE__);
+      m_run->m_narrowBand = new NarrowBand(numberLayers, threshold);
+    }
+
+    //Warm start of the Newton iterations from the last converged solution of each cell/face (optional)
+    bool warmStart(false);
+    element = computationParam->FirstChildElement("newtonSolvers");
+    if (element != NULL) {
+      if (element->QueryBoolAttribute("warmStart", &warmStart) != XML_NO_ERROR) warmStart = false;
+    }
+    WarmStart::activate(warmStart);
+    WarmStart::reset();
   }
   catch (ErrorXML&) {
     throw;
@@ -424,6 +490,7 @@ void Input::inputMesh(std::string casTest)
 
       std::string meshExtension(MeshUnStruct::readMeshFileExtension(meshFile));
       Tools::uppercase(meshExtension);
+      MeshUnStruct* meshUnStruct(nullptr);
       if (meshExtension == "MSH") // Gmsh format
       {
         std::string version(MUSGmsh::readVersion(meshFile));
@@ -434,21 +501,48 @@ void Input::inputMesh(std::string casTest)
             error = element->QueryBoolAttribute("GMSHSwitchTags", &switchTags);
             if (error != XML_NO_ERROR) throw ErrorXMLAttribut("GMSHSwitchTags", fileName.str(), __FILE__, __LINE__);
           }
-          m_run->m_mesh = new MUSGmshV2(meshFile, meshExtension, switchTags);
+          meshUnStruct = new MUSGmshV2(meshFile, meshExtension, switchTags);
         }
-        else if (version == "4.1") m_run->m_mesh = new MUSGmshV4(meshFile, meshExtension);
+        else if (version == "4.1") meshUnStruct = new MUSGmshV4(meshFile, meshExtension);
         else throw ErrorXML("mesh version not found for file : " + meshFile, __FILE__, __LINE__);
       }
       else if (meshExtension == "MESH") throw ErrorXML("MESH format is not supported for file : " + meshFile, __FILE__, __LINE__);
       else {
         throw ErrorXML("mesh extension not supported for file : " + meshFile, __FILE__, __LINE__);
       }
+      m_run->m_mesh = meshUnStruct;
+
+      //Space-filling-curve renumbering of cells and cell interfaces (cache locality)
+      element = meshNS->FirstChildElement("renumbering");
+      if (element != NULL) {
+        bool renumbering(false);
+        error = element->QueryBoolAttribute("state", &renumbering);
+        if (error != XML_NO_ERROR) throw ErrorXMLAttribut("state", fileName.str(), __FILE__, __LINE__);
+        meshUnStruct->setRenumbering(renumbering);
+      }
+
+      //Binary mesh cache (skips mesh file parsing and faces building when up to date)
+      element = meshNS->FirstChildElement("meshCache");
+      if (element != NULL) {
+        bool meshCache(false);
+        error = element->QueryBoolAttribute("state", &meshCache);
+        if (error != XML_NO_ERROR) throw ErrorXMLAttribut("state", fileName.str(), __FILE__, __LINE__);
+        meshUnStruct->setMeshCache(meshCache);
+      }
 
       //Get pretraitement parallele
       element = meshNS->FirstChildElement("parallel");
       if (element != NULL) {
         error = element->QueryBoolAttribute("GMSHPretraitement", &m_run->m_parallelPreTreatment);
         if (error != XML_NO_ERROR) throw ErrorXMLAttribut("GMSHPretraitement", fileName.str(), __FILE__, __LINE__);
+        //Partitioner used by the pre-treatment (optionnal): Gmsh partition tags (default) or built-in space-filling curve
+        const char* partitioner(element->Attribute("partitioner"));
+        if (partitioner != NULL) {
+          std::string partitionerName(partitioner);
+          Tools::uppercase(partitionerName);
+          if (partitionerName != "GMSH" && partitionerName != "SFC") throw ErrorXMLAttribut("partitioner", fileName.str(), __FILE__, __LINE__);
+          meshUnStruct->setPartitioner(partitionerName);
+        }
       }
       //AMR method not possible with unstructured mesh
       element = meshNS->FirstChildElement("AMR");
@@ -1086,6 +1180,12 @@ Eos* Input::inputEOS(std::string EOS, int& numberEOS)
     eos->assignParametersEos(EOS.c_str(), parametresEos);
     //Read physical parameters (viscosity, thermal conductivity, etc.)
     eos->readPhysicalParameters(xmlNode);
+    //Tabulation of the EOS (optional)
+    element = xmlNode->FirstChildElement("tabulation");
+    if (element != NULL) {
+      int number(eos->getNumber());
+      eos = new EosTabulated(eos, number, element, fileName.str(), config.getWorkFolder() + "./libEOS/");
+    }
 
     return eos;
   }
@@ -1520,6 +1620,12 @@ void Input::verifyCompatibilityInput(std::string testCase)
       throw ErrorXMLMessage("Recording of saturation pressure is possible only for a liquid/vapor fluid", fileName.str(), __FILE__, __LINE__);
     }
 
+    // Runge-Kutta stages reuse the conservative save of the cells, which AMR needs to gather the fluxes of the finer levels
+    if (m_run->m_timeIntegration != MUSCLHANCOCK && m_run->m_lvlMax > 0) {
+      std::stringstream fileName(testCase + m_nameMain);
+      throw ErrorXMLMessage("Runge-Kutta time integration is not compatible with AMR", fileName.str(), __FILE__, __LINE__);
+    }
+
     // Check second-order compatibility on unstructured meshes
     if (m_run->m_order == "SECONDORDER") {
       if (m_run->m_mesh->getType() == TypeM::UNS) {
@@ -49,6 +49,7 @@ Output::Output(std::string casTest, std::string nameRun, XMLElement* element, st
   //Names communs
   //------------
   m_infoCalcul                 = "infoCalcul.out";
+  m_performance                = "performance.out";
   m_infoMesh                   = "infoMesh";
   m_treeStructure              = "treeStructure";
   m_domainDecomposition        = "domainDecomposition";
@@ -107,7 +108,7 @@ Output::Output(std::string casTest, std::string nameRun, XMLElement* element, st
     mkdir(m_folderErrorsAndWarnings.c_str(), S_IRWXU);
 #endif
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
 
   //Determination du mode Little / Big Endian
   //-----------------------------------------
@@ -130,6 +131,7 @@ Output::Output(std::string nameRun, int fileNumberRestartMeshMapping, Input* inp
   //Names communs
   //------------
   m_infoCalcul                 = "infoCalcul.out";
+  m_performance                = "performance.out";
   m_infoMesh                   = "infoMesh";
   m_treeStructure              = "treeStructure";
   m_domainDecomposition        = "domainDecomposition";
@@ -319,54 +321,64 @@ void Output::readTree(Mesh* mesh,
   try {
     std::ifstream fileStream;
     int splitCell(0);
-    std::string chaine;
+    std::vector<int> splitFlags;
     std::string file = m_folderInfoMesh + createFilename(m_treeStructure.c_str(), -1, rankCpu, m_numFichier);
     fileStream.open(file.c_str(), std::ios::in);
     if (!fileStream.is_open()) {
       // Avoid segfault if file doesn't exist
       throw ErrorInput("failed to open file: " + file);
     }
+    while (fileStream >> splitCell) {
+      splitFlags.push_back(splitCell);
+    }
+    fileStream.close();
 
-    for (int lvl = 0; lvl <= mesh->getLvlMax(); lvl++) {
-      //Refine cells and cell interfaces
-      for (unsigned int c = 0; c < cellsLvl[lvl].size(); c++) {
-        fileStream >> splitCell;
-        if (splitCell) mesh->refineCellAndCellInterfaces(cellsLvl[lvl][c], addPhys, nbCellsTotalAMR);
-      }
+    buildTree(splitFlags, mesh, cellsLvl, cellsLvlGhost, cellInterfacesLvl, addPhys, nbCellsTotalAMR);
+  }
+  catch (ErrorECOGEN&) {
+    throw;
+  }
+}
 
-      if (lvl < mesh->getLvlMax()) {
-        if (Ncpu > 1) {
-          //Refine ghost cells
-          parallel.communicationsSplit(lvl);
-          cellsLvlGhost[lvl + 1].clear();
-          for (unsigned int i = 0; i < cellsLvlGhost[lvl].size(); i++) {
-            cellsLvlGhost[lvl][i]->chooseRefineDeraffineGhost(mesh->getNumberCellsY(), mesh->getNumberCellsZ(), addPhys, cellsLvlGhost);
-          }
+//***********************************************************************
 
-          //Update of persistent communications of cells lvl + 1
-          parallel.communicationsNumberGhostCells(lvl + 1);
-          parallel.updatePersistentCommunicationsLvlAMR(lvl + 1, mesh->getProblemDimension());
-        }
+void Output::buildTree(const std::vector<int>& splitFlags,
+                       Mesh* mesh,
+                       TypeMeshContainer<Cell*>* cellsLvl,
+                       TypeMeshContainer<Cell*>* cellsLvlGhost,
+                       TypeMeshContainer<CellInterface*>* cellInterfacesLvl,
+                       const std::vector<AddPhys*>& addPhys,
+                       int& nbCellsTotalAMR)
+{
+  unsigned int index(0);
+  for (int lvl = 0; lvl <= mesh->getLvlMax(); lvl++) {
+    //Refine cells and cell interfaces
+    for (unsigned int c = 0; c < cellsLvl[lvl].size(); c++) {
+      if (index >= splitFlags.size()) throw ErrorInput("tree structure does not match the mesh");
+      if (splitFlags[index++]) mesh->refineCellAndCellInterfaces(cellsLvl[lvl][c], addPhys, nbCellsTotalAMR);
+    }
 
-        //Reconstruction of the arrays of cells and cell interfaces of lvl + 1
-        cellsLvl[lvl + 1].clear();
-        cellInterfacesLvl[lvl + 1].clear();
-        for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
-          cellsLvl[lvl][i]->buildLvlCellsAndLvlInternalCellInterfacesArrays(cellsLvl, cellInterfacesLvl);
-        }
-        for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) {
-          cellInterfacesLvl[lvl][i]->constructionArrayExternalCellInterfacesLvl(cellInterfacesLvl);
+    if (lvl < mesh->getLvlMax()) {
+      if (Ncpu > 1) {
+        //Refine ghost cells
+        parallel.communicationsSplit(lvl);
+        cellsLvlGhost[lvl + 1].clear();
+        for (unsigned int i = 0; i < cellsLvlGhost[lvl].size(); i++) {
+          cellsLvlGhost[lvl][i]->chooseRefineDeraffineGhost(mesh->getNumberCellsY(), mesh->getNumberCellsZ(), addPhys, cellsLvlGhost);
         }
+
+        //Update of persistent communications of cells lvl + 1
+        parallel.communicationsNumberGhostCells(lvl + 1);
+        parallel.updatePersistentCommunicationsLvlAMR(lvl + 1, mesh->getProblemDimension());
       }
+
+      //Reconstruction of the arrays of cells and cell interfaces of lvl + 1
+      mesh->buildLvlCellsAndLvlCellInterfacesArrays(cellsLvl, cellInterfacesLvl, lvl);
     }
-    nbCellsTotalAMR = 0;
-    for (unsigned int i = 0; i < cellsLvl[0].size(); i++) {
-      cellsLvl[0][i]->updateNbCellsTotalAMR(nbCellsTotalAMR);
-    }
-    fileStream.close();
   }
-  catch (ErrorECOGEN&) {
-    throw;
+  nbCellsTotalAMR = 0;
+  for (unsigned int i = 0; i < cellsLvl[0].size(); i++) {
+    cellsLvl[0][i]->updateNbCellsTotalAMR(nbCellsTotalAMR);
   }
 }
 
@@ -383,6 +395,10 @@ void Output::writeInfos()
 
 //***********************************************************************
 
+void Output::reduceMemoryStats() { MemoryStats::reduce(m_memoryReport); }
+
+//***********************************************************************
+
 void Output::writeProgress()
 {
   double progress;
@@ -412,66 +428,10 @@ void Output::saveInfoCells() const
 
 //***********************************************************************
 
-void Output::writeDataset(std::vector<double> dataset, std::ofstream& fileStream, TypeData typeData)
+void Output::writeDataset(std::vector<double>& dataset, StagedFile& fileStream, TypeData typeData)
 {
   if (m_precision != 0) fileStream.precision(m_precision);
-  if (!m_writeBinary) {
-    for (unsigned int k = 0; k < dataset.size(); k++) {
-      fileStream << dataset[k] << " ";
-    }
-  }
-  else {
-    int donneeInt;
-    float donneeFloat;
-    double donneeDouble;
-    char donneeChar;
-    int taille;
-    switch (typeData) {
-    case DOUBLE:
-      taille = dataset.size() * sizeof(double);
-      break;
-    case FLOAT:
-      taille = dataset.size() * sizeof(float);
-      break;
-    case INT:
-      taille = dataset.size() * sizeof(int);
-      break;
-    case CHAR:
-      taille = dataset.size() * sizeof(char);
-      break;
-    }
-    IO::writeb64(fileStream, taille);
-    char* chaineTampon = new char[taille];
-    int index          = 0;
-    switch (typeData) {
-    case DOUBLE:
-      for (unsigned int k = 0; k < dataset.size(); k++) {
-        donneeDouble = static_cast<double>(dataset[k]);
-        IO::addToTheString(chaineTampon, index, donneeDouble);
-      }
-      break;
-    case FLOAT:
-      for (unsigned int k = 0; k < dataset.size(); k++) {
-        donneeFloat = static_cast<float>(dataset[k]);
-        IO::addToTheString(chaineTampon, index, donneeFloat);
-      }
-      break;
-    case INT:
-      for (unsigned int k = 0; k < dataset.size(); k++) {
-        donneeInt = static_cast<int>(std::round(dataset[k]));
-        IO::addToTheString(chaineTampon, index, donneeInt);
-      }
-      break;
-    case CHAR:
-      for (unsigned int k = 0; k < dataset.size(); k++) {
-        donneeChar = static_cast<char>(dataset[k]);
-        IO::addToTheString(chaineTampon, index, donneeChar);
-      }
-      break;
-    }
-    IO::writeb64Chaine(fileStream, chaineTampon, taille);
-    delete[] chaineTampon;
-  }
+  fileStream.stageDataset(dataset, typeData, m_precision, m_writeBinary);
 }
 
 //***********************************************************************
@@ -538,6 +498,10 @@ void Output::printWritingInfo() const
   std::cout << "T" << m_run->m_numTest << " | RESULTS FILE NUMBER: " << m_numFichier << ", ITERATION " << m_run->m_iteration << std::endl;
   std::cout << "T" << m_run->m_numTest << " |     Physical time       = " << m_run->m_physicalTime << " s " << std::endl;
   std::cout << "T" << m_run->m_numTest << " |     Last time step      = " << m_run->m_dt << " s " << std::endl;
+  if (!m_memoryReport.empty()) {
+    std::cout << "T" << m_run->m_numTest << " |     Tracked memory      = " << m_memoryReport[2 * NUMBERMEMORYCATEGORIES] / 1.e6 << " MB (peak "
+              << m_memoryReport.back() / 1.e6 << " MB)" << std::endl;
+  }
   m_run->m_stat.printScreenStats(m_run->m_numTest);
 }
 
@@ -558,6 +522,11 @@ void Output::saveInfos() const
     fileStream << m_numFichier << " " << m_run->m_iteration << " " << m_run->m_physicalTime << " " << m_run->m_dtNext << " " << secondCompTime << " "
                << secondAMRTime << " " << secondComTime;
 
+    //Memory accounting: bytes and number of objects of each category, then total, max over CPUs and peaks (bytes)
+    for (unsigned int i = 0; i < m_memoryReport.size(); i++) {
+      fileStream << " " << static_cast<long long>(m_memoryReport[i]);
+    }
+
     //Additional output with purpose to track the radius of a bubble over time and the maximum pressures.
     //To comment if not needed. Be carefull when using it, integration for bubble radius and maximum pressure at the wall are not generalized.
     //-----
@@ -576,6 +545,80 @@ void Output::saveInfos() const
 
 //***********************************************************************
 
+void Output::savePerformance(const int& iterations, const double& cellIterations) const
+{
+  //1) Global quantities (stage times are local wall times: the slowest CPU is retained)
+  //------------------------------------------------------------------------------------
+  double localData[NUMBERSTAGES + 1], maxData[NUMBERSTAGES + 1];
+  for (int s = 0; s < NUMBERSTAGES; s++) {
+    localData[s] = m_run->m_stat.getStageTime(static_cast<TimeStage>(s));
+  }
+  //Peak resident memory of the process since its start (kB on Linux, bytes on macOS)
+  double peakMemory(0.);
+#ifndef WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    peakMemory = static_cast<double>(usage.ru_maxrss);
+  #ifdef __APPLE__
+    peakMemory /= 1024.;
+  #endif
+  }
+#endif
+  localData[NUMBERSTAGES] = peakMemory;
+  const TimeStage maskedStages[3] = {SOURCES, RELAXATIONS, ADDPHYS};
+  double sumData[8] = {cellIterations,
+                       peakMemory,
+                       static_cast<double>(m_run->m_stat.getNumberActiveCells(SOURCES)),
+                       static_cast<double>(m_run->m_stat.getNumberCandidateCells(SOURCES)),
+                       static_cast<double>(m_run->m_stat.getNumberActiveCells(RELAXATIONS)),
+                       static_cast<double>(m_run->m_stat.getNumberCandidateCells(RELAXATIONS)),
+                       static_cast<double>(m_run->m_stat.getNumberActiveCells(ADDPHYS)),
+                       static_cast<double>(m_run->m_stat.getNumberCandidateCells(ADDPHYS))},
+         totalData[8];
+  MPI_Reduce(localData, maxData, NUMBERSTAGES + 1, MPI_DOUBLE, MPI_MAX, 0, computingComm);
+  MPI_Reduce(sumData, totalData, 8, MPI_DOUBLE, MPI_SUM, 0, computingComm);
+  //Peak of the memory tracked per category (see MemoryStats)
+  std::vector<double> memoryReport;
+  MemoryStats::reduce(memoryReport);
+
+  //2) Printing "key value" lines
+  //-----------------------------
+  if (rankCpu == 0) {
+    std::ofstream fileStream((m_folderOutput + m_performance).c_str(), std::ios::trunc);
+    double computationTime(m_run->m_stat.getComputationTime());
+    fileStream.precision(8);
+    fileStream << "numberCPUs " << Ncpu << std::endl;
+    fileStream << "iterations " << iterations << std::endl;
+    fileStream << "cellIterations " << totalData[0] << std::endl;
+    fileStream << "computationTime " << computationTime << std::endl;
+    fileStream << "AMRTime " << m_run->m_stat.getAMRTime() << std::endl;
+    fileStream << "communicationTime " << m_run->m_stat.getCommunicationTime() << std::endl;
+    for (int s = 0; s < NUMBERSTAGES; s++) {
+      fileStream << "stageTime_" << timeStats::getStageName(static_cast<TimeStage>(s)) << " " << maxData[s] << std::endl;
+    }
+    if (m_run->m_stat.getNumberSuperTimeSteps() > 0) {
+      fileStream << "superTimeSteps " << m_run->m_stat.getNumberSuperTimeSteps() << std::endl;
+      fileStream << "superTimeStepStages " << m_run->m_stat.getNumberSuperTimeStepStages() << std::endl;
+      fileStream << "superTimeStepStagesMax " << m_run->m_stat.getMaxSuperTimeStepStages() << std::endl;
+    }
+    //Fraction of the cells skipped by the activity masks of the sources and relaxations and by the narrow band
+    for (int s = 0; s < 3; s++) {
+      if (totalData[3 + 2 * s] > 0.) {
+        fileStream << "skippedCellsFraction_" << timeStats::getStageName(maskedStages[s]) << " "
+                   << 1. - totalData[2 + 2 * s] / totalData[3 + 2 * s] << std::endl;
+      }
+    }
+    fileStream << "cellIterationsPerSecond " << ((computationTime > 0.) ? totalData[0] / computationTime : 0.) << std::endl;
+    fileStream << "peakMemoryMaxCPU_kB " << maxData[NUMBERSTAGES] << std::endl;
+    fileStream << "peakMemoryTotal_kB " << totalData[1] << std::endl;
+    fileStream << "trackedMemoryPeakMaxCPU_B " << static_cast<long long>(memoryReport[memoryReport.size() - 2]) << std::endl;
+    fileStream << "trackedMemoryPeakTotal_B " << static_cast<long long>(memoryReport.back()) << std::endl;
+    fileStream.close();
+  }
+}
+
+//***********************************************************************
+
 void Output::readInfos()
 {
   std::fstream fileStream;
@@ -624,7 +667,7 @@ void Output::readInfos()
   }
 
   //Erasing end of file
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
   if (rankCpu == 0) {
     fileStream.close();
     fileStream.open((m_folderOutput + m_infoCalcul).c_str(), std::ios::out | std::ios::trunc); //Opening in printing mode with erasing
@@ -646,6 +689,26 @@ void Output::readInfos()
 
 //***********************************************************************
 
+void Output::truncateInfos(const int& numberFiles)
+{
+  std::fstream fileStream;
+  std::vector<std::string> lines;
+  std::string line;
+  fileStream.open((m_folderOutput + m_infoCalcul).c_str(), std::ios::in);
+  //First line for CPU number, then one line per result file
+  while (static_cast<int>(lines.size()) < numberFiles + 1 && std::getline(fileStream, line)) {
+    lines.push_back(line);
+  }
+  fileStream.close();
+  fileStream.open((m_folderOutput + m_infoCalcul).c_str(), std::ios::out | std::ios::trunc);
+  for (unsigned int i = 0; i < lines.size(); i++) {
+    fileStream << lines[i] << std::endl;
+  }
+  fileStream.close();
+}
+
+//***********************************************************************
+
 int Output::readNbCpu()
 {
   std::fstream fileStream;
@@ -37,6 +37,7 @@
 #else
   #include <sys/types.h>
   #include <sys/stat.h>
+  #include <sys/resource.h>
 #endif
 
 #include <fstream>
@@ -45,6 +46,7 @@
 #include "../Meshes/HeaderMesh.h"
 #include "../Order1/Cell.h"
 #include "IO.h"
+#include "StagedFile.h"
 
 class Output;
 
@@ -123,8 +125,16 @@ class Output
     };
     void printTree(Mesh* mesh, std::vector<Cell*>* cellsLvl, int m_resumeAMRsaveFreq);
     virtual void writeInfos();
+    //! \brief   Gather the memory accounting of all CPUs for the next infoCalcul line (collective on computingComm)
+    void reduceMemoryStats();
     virtual void writeProgress();
+    //! \brief   Wait for result files still pending in an asynchronous writing pipeline
+    virtual void drainWritings() {};
     void saveInfoCells() const;
+    //! \brief   Save the performance summary of the run (machine-readable, used by the benchmark suite of nonreg/)
+    //! \param   iterations       number of iterations computed by this run
+    //! \param   cellIterations   local number of cells times iterations computed by this run
+    void savePerformance(const int& iterations, const double& cellIterations) const;
 
     virtual void initializeSpecificOutput()
     {
@@ -184,9 +194,21 @@ class Output
                   TypeMeshContainer<CellInterface*>* cellInterfacesLvl,
                   const std::vector<AddPhys*>& addPhys,
                   int& nbCellsTotalAMR);
+    //! \brief   Rebuild the AMR tree from the split flags of every cell, level after level (as saved by printTree)
+    static void buildTree(const std::vector<int>& splitFlags,
+                          Mesh* mesh,
+                          TypeMeshContainer<Cell*>* cellsLvl,
+                          TypeMeshContainer<Cell*>* cellsLvlGhost,
+                          TypeMeshContainer<CellInterface*>* cellInterfacesLvl,
+                          const std::vector<AddPhys*>& addPhys,
+                          int& nbCellsTotalAMR);
+    //! \brief   Keep only the informations of the first result files in the infoCalcul file (used when resuming from a checkpoint)
+    //! \param   numberFiles  Number of result files to keep
+    void truncateInfos(const int& numberFiles);
 
     //Accessor
     int getNumFile() const { return m_numFichier; };
+    void setNumFile(const int& numFichier) { m_numFichier = numFichier; };
     virtual double getNextTime()
     {
       try {
@@ -217,7 +239,8 @@ class Output
     void saveInfos() const;
     std::string createFilename(const char* name, int lvl = -1, int proc = -1, int numFichier = -1) const;
 
-    void writeDataset(std::vector<double> dataset, std::ofstream& fileStream, TypeData typeData);
+    //! \brief   Stage a dataset into a file (the dataset content is moved, encoding is done when the file is written)
+    void writeDataset(std::vector<double>& dataset, StagedFile& fileStream, TypeData typeData);
     void getDataset(std::istringstream& data, std::vector<double>& dataset);
 
     Input* m_input;    //!<Pointer to input
@@ -227,6 +250,8 @@ class Output
     //Attributes names file/folder
     std::string m_simulationName;             //!<Test case name (defined in "main.xml")
     std::string m_infoCalcul;                 //!<Filename to save useful info of computation
+    std::string m_performance;                //!<Filename of the performance summary of the run
+    std::vector<double> m_memoryReport;       //!<Memory accounting gathered over the CPUs (see MemoryStats::reduce())
     std::string m_infoMesh;                   //!<Filename of mesh info file
     std::string m_treeStructure;              //!<Filename for tree structure backup
     std::string m_domainDecomposition;        //!<Filename for domain decomposition backup
@@ -0,0 +1,206 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#include "OutputPipeline.h"
+#include <chrono>
+#include <iostream>
+
+//***********************************************************************
+
+OutputPipeline::OutputPipeline() :
+  m_asynchronous(false), m_maxPendingBytes(0), m_pendingBytes(0), m_pendingFiles(0), m_stop(false), m_failed(false), m_waitingTime(0.)
+{}
+
+//***********************************************************************
+
+OutputPipeline::~OutputPipeline()
+{
+  try {
+    this->drain();
+  }
+  catch (ErrorECOGEN& e) {
+    std::cerr << e.infoError() << std::endl;
+  }
+  this->stopWriter();
+  for (unsigned int f = 0; f < m_queue.size(); f++) {
+    delete m_queue[f];
+  }
+}
+
+//***********************************************************************
+
+void OutputPipeline::setAsynchronous(bool asynchronous, std::size_t maxPendingBytes)
+{
+  this->drain();
+  this->stopWriter();
+  m_asynchronous    = asynchronous;
+  m_maxPendingBytes = maxPendingBytes;
+  if (m_asynchronous) {
+    m_stop   = false;
+    m_writer = std::thread(&OutputPipeline::writerLoop, this);
+  }
+}
+
+//***********************************************************************
+
+void OutputPipeline::submit(StagedFile* file)
+{
+  this->checkError();
+  file->flushText();
+
+  //1) Synchronous writing
+  //----------------------
+  if (!m_asynchronous) {
+    try {
+      file->write();
+    }
+    catch (...) {
+      delete file;
+      throw;
+    }
+    delete file;
+    return;
+  }
+
+  //2) Back-pressure: wait until the file fits within the memory bound
+  //------------------------------------------------------------------
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (m_pendingFiles > 0 && m_pendingBytes + file->getSize() > m_maxPendingBytes) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    while (!m_failed && m_pendingFiles > 0 && m_pendingBytes + file->getSize() > m_maxPendingBytes) {
+      m_fileWritten.wait(lock);
+    }
+    m_waitingTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+  if (m_failed) {
+    lock.unlock();
+    delete file;
+    this->checkError();
+  }
+
+  //3) Queue the file for the writer thread
+  //---------------------------------------
+  m_pendingBytes += file->getSize();
+  m_pendingFiles++;
+  m_queue.push_back(file);
+  lock.unlock();
+  m_fileAvailable.notify_one();
+}
+
+//***********************************************************************
+
+void OutputPipeline::drain()
+{
+  if (m_asynchronous) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    while (m_pendingFiles > 0) {
+      m_fileWritten.wait(lock);
+    }
+    m_waitingTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+  this->checkError();
+}
+
+//***********************************************************************
+
+void OutputPipeline::writerLoop()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    while (!m_stop && m_queue.empty()) {
+      m_fileAvailable.wait(lock);
+    }
+    if (m_queue.empty()) break; //Stop requested and nothing left to write
+
+    StagedFile* file = m_queue.front();
+    m_queue.pop_front();
+    std::size_t size = file->getSize();
+    bool skip(m_failed); //Files queued after a failure are discarded
+
+    //Encoding and writing are done outside of the lock so that the solver can queue the next files
+    lock.unlock();
+    bool failed(false);
+    ErrorECOGEN error;
+    if (!skip) {
+      try {
+        file->write();
+      }
+      catch (ErrorECOGEN& e) {
+        failed = true;
+        error  = e;
+      }
+      //Any other exception must not escape the thread (std::terminate): it is reported to the solver the same way
+      catch (std::exception& e) {
+        failed = true;
+        error  = ErrorECOGEN("writing of a result file failed: " + std::string(e.what()), __FILE__, __LINE__);
+      }
+      catch (...) {
+        failed = true;
+        error  = ErrorECOGEN("writing of a result file failed: unknown exception", __FILE__, __LINE__);
+      }
+    }
+    delete file;
+    lock.lock();
+
+    if (failed && !m_failed) {
+      m_failed = true;
+      m_error  = error;
+    }
+    m_pendingBytes -= size;
+    m_pendingFiles--;
+    m_fileWritten.notify_all();
+  }
+}
+
+//***********************************************************************
+
+void OutputPipeline::checkError()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_failed) {
+    m_failed = false;
+    throw m_error;
+  }
+}
+
+//***********************************************************************
+
+void OutputPipeline::stopWriter()
+{
+  if (m_writer.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_fileAvailable.notify_one();
+    m_writer.join();
+  }
+}
@@ -0,0 +1,93 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef OUTPUTPIPELINE_H
+#define OUTPUTPIPELINE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "StagedFile.h"
+#include "../Errors.h"
+
+//! \class     OutputPipeline
+//! \brief     FIFO of staged output files written by a background thread
+//! \details   In synchronous mode (default) a submitted file is written immediately. In asynchronous mode the file
+//!            is queued and a single writer thread encodes and writes it while the solver goes on. The memory held
+//!            by the queue is bounded: when submitting a file would exceed the bound, the solver waits for the writer
+//!            (back-pressure). At least one file is always accepted so that a snapshot larger than the bound can still
+//!            be written. The writer thread never calls MPI.
+class OutputPipeline
+{
+  public:
+    OutputPipeline();
+    //! \brief   Drain pending files before destruction (errors are reported on std::cerr)
+    virtual ~OutputPipeline();
+
+    //! \brief   Select the writing mode
+    //! \param   asynchronous     Choice to write files with a background thread
+    //! \param   maxPendingBytes  Maximum memory held by files waiting to be written (bytes)
+    void setAsynchronous(bool asynchronous, std::size_t maxPendingBytes);
+
+    //! \brief   Write or queue a staged file, the pipeline takes ownership of it
+    //! \details Throws if a previous writing failed
+    void submit(StagedFile* file);
+
+    //! \brief   Wait for all pending files to be written
+    //! \details Throws if a writing failed
+    void drain();
+
+    bool isAsynchronous() const { return m_asynchronous; };
+    //! \brief   Total time the solver spent waiting for the writer (seconds)
+    double getWaitingTime() const { return m_waitingTime; };
+
+  private:
+    void writerLoop();
+    void checkError();
+    void stopWriter();
+
+    bool m_asynchronous;             //!<Choice to write files with a background thread
+    std::size_t m_maxPendingBytes;   //!<Maximum memory held by pending files (bytes)
+    std::size_t m_pendingBytes;      //!<Memory held by pending files, including the file being written (bytes)
+    int m_pendingFiles;              //!<Number of pending files, including the file being written
+    std::deque<StagedFile*> m_queue; //!<Files waiting to be written
+    bool m_stop;                     //!<Request for the writer thread to stop once the queue is empty
+    bool m_failed;                   //!<A writing failed, the error is kept in m_error
+    ErrorECOGEN m_error;             //!<First error raised by the writer thread
+    double m_waitingTime;            //!<Total time the solver spent waiting for the writer (seconds)
+
+    std::thread m_writer;
+    std::mutex m_mutex;
+    std::condition_variable m_fileAvailable; //!<Signaled to the writer when a file is queued or stop is requested
+    std::condition_variable m_fileWritten;   //!<Signaled to the solver when a file has been written
+};
+
+#endif //OUTPUTPIPELINE_H
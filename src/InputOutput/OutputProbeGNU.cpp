@@ -127,14 +127,14 @@ void OutputProbeGNU::locateProbeInMesh(const TypeMeshContainer<Cell*>& cells, co
     //Is probe belonging to this CPU ?
     if (Ncpu != 1) {
       double minimumAllCPU(minimumDistance);
-      MPI_Allreduce(&minimumDistance, &minimumAllCPU, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      MPI_Allreduce(&minimumDistance, &minimumAllCPU, 1, MPI_DOUBLE, MPI_MIN, computingComm);
       if (std::fabs(minimumAllCPU - minimumDistance) > 1.e-10) {
         m_possessesProbe[rankCpu] = false;
       }
       else {
         m_possessesProbe[rankCpu] = true;
       }
-      MPI_Allgather(&m_possessesProbe[rankCpu], 1, MPI_C_BOOL, m_possessesProbe, 1, MPI_C_BOOL, MPI_COMM_WORLD);
+      MPI_Allgather(&m_possessesProbe[rankCpu], 1, MPI_C_BOOL, m_possessesProbe, 1, MPI_C_BOOL, computingComm);
       //Checking for belonging a single CPU
       for (int c = 0; c < Ncpu; c++) {
         if (m_possessesProbe[c] == true) {
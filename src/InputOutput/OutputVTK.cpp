@@ -30,6 +30,7 @@
 
 #include "OutputVTK.h"
 #include "../Run.h"
+#include "../Config.h"
 
 using namespace tinyxml2;
 
@@ -39,6 +40,21 @@ OutputVTK::OutputVTK(std::string casTest, std::string run, XMLElement* element,
   Output(casTest, run, element, fileName, entree)
 {
   m_type = TypeOutput::VTK;
+
+  //Asynchronous writing of result files
+  bool asynchronous(false);
+  if (element->QueryBoolAttribute("asynchronous", &asynchronous) != XML_NO_ERROR) asynchronous = false;
+  if (asynchronous && !config.getThreadedOutput()) {
+    //The MPI library does not support the writer thread: fall back to synchronous writing
+    if (rankCpu == 0) std::cout << "WARNING: asynchronous output ignored, MPI thread support lower than MPI_THREAD_FUNNELED" << std::endl;
+    asynchronous = false;
+  }
+  if (asynchronous) {
+    int bufferSize(1024); //Maximum memory held by pending files (MB), default if not specified
+    element->QueryIntAttribute("bufferSize", &bufferSize);
+    if (bufferSize <= 0) throw ErrorXMLAttribut("bufferSize", fileName, __FILE__, __LINE__);
+    m_pipeline.setAsynchronous(true, static_cast<std::size_t>(bufferSize) * 1024 * 1024);
+  }
 }
 
 //***********************************************************************
@@ -111,6 +127,17 @@ void OutputVTK::writeResults(Mesh* mesh, std::vector<Cell*>* cellsLvl)
 
 //***********************************************************************
 
+void OutputVTK::drainWritings()
+{
+  m_pipeline.drain();
+  if (m_pipeline.isAsynchronous() && rankCpu == 0) {
+    std::cout << "T" << m_run->m_numTest << " | Asynchronous output: solver waited " << m_pipeline.getWaitingTime() << " s for pending writings"
+              << std::endl;
+  }
+}
+
+//***********************************************************************
+
 void OutputVTK::readResults(Mesh* mesh, std::vector<Cell*>* cellsLvl)
 {
   try {
@@ -350,17 +377,14 @@ std::string OutputVTK::createFilenameVTK(const char* name, Mesh* mesh, int proc,
 
 void OutputVTK::writeResultsVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl)
 {
-  std::ofstream fileStream;
+  std::string file       = m_folderDatasets + createFilenameVTK(m_fileNameResults.c_str(), mesh, rankCpu, m_numFichier);
+  StagedFile* stagedFile = new StagedFile(file);
+  StagedFile& fileStream = *stagedFile;
 
   try {
 
-    //1) Opening and creation of file
-    //-------------------------------
-    std::string file = m_folderDatasets + createFilenameVTK(m_fileNameResults.c_str(), mesh, rankCpu, m_numFichier);
-    fileStream.open(file.c_str(), std::ios::trunc);
-    if (!fileStream) {
-      throw ErrorECOGEN("Impossible d ouvrir le file " + file, __FILE__, __LINE__);
-    }
+    //1) Creation of file (staged in memory, written by the output pipeline)
+    //----------------------------------------------------------------------
     fileStream << "<?xml version=\"1.0\"?>" << std::endl;
 
     //2) Write mesh
@@ -401,12 +425,16 @@ void OutputVTK::writeResultsVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl)
       throw ErrorECOGEN("Output::writeResultsVTK : type mesh unknown", __FILE__, __LINE__);
       break;
     }
-    fileStream.close();
 
   } //End try
   catch (ErrorECOGEN&) {
+    delete stagedFile;
     throw;
   }
+
+  //5) Write or queue the file
+  //--------------------------
+  m_pipeline.submit(stagedFile);
 }
 
 //***********************************************************************
@@ -414,15 +442,14 @@ void OutputVTK::writeResultsVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl)
 void OutputVTK::writeCollectionVTK(Mesh* mesh)
 {
   try {
-    std::ofstream fileStream;
+    //Collections are small and fully rewritten at each output: they go through the pipeline to keep the writing order
+    StagedFile* stagedFile(0);
     //ifstream fileStream2((m_folderOutput + m_infoCalcul).c_str()); //For real-time file name
     //double realTime, a, b, c, d, e, f, g, h, i, j, k, l, m;          //For real-time file name
     //double realTime, a, b, c, d;                                     //For real-time file name
     //Creation du file de sortie collection Paraview
-    fileStream.open(m_fileCollectionParaview.c_str(), std::ios::trunc);
-    if (!fileStream) {
-      throw ErrorECOGEN("Impossible d ouvrir le file " + m_fileCollectionParaview, __FILE__, __LINE__);
-    }
+    stagedFile             = new StagedFile(m_fileCollectionParaview);
+    StagedFile& fileStream = *stagedFile;
     fileStream << "<?xml version=\"1.0\"?>" << std::endl;
     fileStream << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"";
     if (!m_writeBinary) {
@@ -444,22 +471,20 @@ void OutputVTK::writeCollectionVTK(Mesh* mesh)
     }
     fileStream << "    </Collection>" << std::endl;
     fileStream << "</VTKFile>" << std::endl;
-    fileStream.close();
+    m_pipeline.submit(stagedFile);
     //fileStream2.close(); //For real-time file name
 
     //Creation du file de sortie collection VisIt
-    fileStream.open(m_fileCollectionVisIt.c_str(), std::ios::trunc);
-    if (!fileStream) {
-      throw ErrorECOGEN("Impossible d ouvrir le file " + m_fileCollectionVisIt, __FILE__, __LINE__);
-    }
-    fileStream << "!NBLOCKS " << Ncpu << std::endl;
+    stagedFile                  = new StagedFile(m_fileCollectionVisIt);
+    StagedFile& fileStreamVisIt = *stagedFile;
+    fileStreamVisIt << "!NBLOCKS " << Ncpu << std::endl;
     for (int time = 0; time <= m_numFichier; time++) {
       for (int p = 0; p < Ncpu; p++) {
         std::string file = "datasets/" + createFilenameVTK(m_fileNameResults.c_str(), mesh, p, time);
-        fileStream << file.c_str() << std::endl;
+        fileStreamVisIt << file.c_str() << std::endl;
       }
     }
-    fileStream.close();
+    m_pipeline.submit(stagedFile);
   }
   catch (ErrorXML&) {
     throw;
@@ -468,7 +493,7 @@ void OutputVTK::writeCollectionVTK(Mesh* mesh)
 
 //***********************************************************************
 
-void OutputVTK::writePhysicalDataVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl, std::ofstream& fileStream, bool parallel)
+void OutputVTK::writePhysicalDataVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl, StagedFile& fileStream, bool parallel)
 {
   std::vector<double> dataset;
 
@@ -679,7 +704,7 @@ void OutputVTK::writePhysicalDataVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl, s
 
 //***********************************************************************
 
-void OutputVTK::writeMeshRectilinearVTK(Mesh* mesh, std::ofstream& fileStream, bool parallel)
+void OutputVTK::writeMeshRectilinearVTK(Mesh* mesh, StagedFile& fileStream, bool parallel)
 {
   std::vector<double> dataset;
 
@@ -760,7 +785,7 @@ void OutputVTK::writeMeshRectilinearVTK(Mesh* mesh, std::ofstream& fileStream, b
 
 //***********************************************************************
 
-void OutputVTK::writeMeshUnstructuredVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl, std::ofstream& fileStream, bool parallel)
+void OutputVTK::writeMeshUnstructuredVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl, StagedFile& fileStream, bool parallel)
 {
   std::vector<double> dataset;
 
@@ -862,7 +887,7 @@ void OutputVTK::writeMeshUnstructuredVTK(Mesh* mesh, std::vector<Cell*>* cellsLv
 
 //***********************************************************************
 
-void OutputVTK::writeFinFichierRectilinearVTK(std::ofstream& fileStream, bool parallel)
+void OutputVTK::writeFinFichierRectilinearVTK(StagedFile& fileStream, bool parallel)
 {
   std::string prefix;
   if (parallel) {
@@ -879,7 +904,7 @@ void OutputVTK::writeFinFichierRectilinearVTK(std::ofstream& fileStream, bool pa
 
 //***********************************************************************
 
-void OutputVTK::writeFinFichierUnstructuredVTK(std::ofstream& fileStream, bool parallel)
+void OutputVTK::writeFinFichierUnstructuredVTK(StagedFile& fileStream, bool parallel)
 {
   std::string prefix;
   if (parallel) {
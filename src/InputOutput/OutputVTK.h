@@ -32,6 +32,7 @@
 #define OUTPUTVTK_H
 
 #include "Output.h"
+#include "OutputPipeline.h"
 
 class OutputVTK : public Output
 {
@@ -42,6 +43,7 @@ class OutputVTK : public Output
 
     void initializeSpecificOutput() override;
     void writeResults(Mesh* mesh, std::vector<Cell*>* cellsLvl) override;
+    void drainWritings() override;
 
     void readResults(Mesh* mesh, std::vector<Cell*>* cellsLvl) override;
     void readResultsCpu(Mesh* mesh, std::vector<Cell*>* cellsLvl, int cpu) override;
@@ -53,13 +55,15 @@ class OutputVTK : public Output
 
     void writeResultsVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl);
     void writeCollectionVTK(Mesh* mesh);
-    void writePhysicalDataVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl, std::ofstream& fileStream, bool parallel = false);
+    void writePhysicalDataVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl, StagedFile& fileStream, bool parallel = false);
 
     //Dependant du type de mesh
-    void writeMeshRectilinearVTK(Mesh* mesh, std::ofstream& fileStream, bool parallel = false);
-    void writeMeshUnstructuredVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl, std::ofstream& fileStream, bool parallel = false);
-    void writeFinFichierRectilinearVTK(std::ofstream& fileStream, bool parallel = false);
-    void writeFinFichierUnstructuredVTK(std::ofstream& fileStream, bool parallel = false);
+    void writeMeshRectilinearVTK(Mesh* mesh, StagedFile& fileStream, bool parallel = false);
+    void writeMeshUnstructuredVTK(Mesh* mesh, std::vector<Cell*>* cellsLvl, StagedFile& fileStream, bool parallel = false);
+    void writeFinFichierRectilinearVTK(StagedFile& fileStream, bool parallel = false);
+    void writeFinFichierUnstructuredVTK(StagedFile& fileStream, bool parallel = false);
+
+    OutputPipeline m_pipeline; //!<Writing of result files (synchronous or with a background thread)
 
     //Non used / old
     // void writeFichierParallelXML(Mesh *mesh, std::vector<Cell*>* cellsLvl);
@@ -0,0 +1,170 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#include "StagedFile.h"
+#include "IO.h"
+#include "../Errors.h"
+#include <cmath>
+
+//***********************************************************************
+
+StagedFile::StagedFile(const std::string& fileName) : std::ostream(nullptr), m_fileName(fileName), m_size(0)
+{
+  this->rdbuf(&m_buffer);
+  MemoryStats::add(MEMOUTPUTSTAGING, 0);
+}
+
+//***********************************************************************
+
+StagedFile::~StagedFile() { MemoryStats::remove(MEMOUTPUTSTAGING, m_size); }
+
+//***********************************************************************
+
+void StagedFile::stageDataset(std::vector<double>& dataset, TypeData typeData, int precision, bool binary)
+{
+  m_segments.push_back(Segment());
+  Segment& segment   = m_segments.back();
+  segment.text       = m_buffer.str();
+  segment.hasDataset = true;
+  segment.dataset.swap(dataset);
+  segment.typeData  = typeData;
+  segment.precision = precision;
+  segment.binary    = binary;
+  m_size += segment.text.size() + segment.dataset.size() * sizeof(double);
+  MemoryStats::add(MEMOUTPUTSTAGING, segment.text.size() + segment.dataset.size() * sizeof(double), 0);
+  m_buffer.str("");
+  dataset.clear();
+}
+
+//***********************************************************************
+
+void StagedFile::flushText()
+{
+  std::string text(m_buffer.str());
+  if (!text.empty()) {
+    m_segments.push_back(Segment());
+    m_segments.back().text.swap(text);
+    m_segments.back().hasDataset = false;
+    m_size += m_segments.back().text.size();
+    MemoryStats::add(MEMOUTPUTSTAGING, m_segments.back().text.size(), 0);
+    m_buffer.str("");
+  }
+}
+
+//***********************************************************************
+
+void StagedFile::write()
+{
+  this->flushText();
+
+  std::ofstream fileStream(m_fileName.c_str(), std::ios::trunc);
+  if (!fileStream) {
+    throw ErrorECOGEN("Impossible d ouvrir le file " + m_fileName, __FILE__, __LINE__);
+  }
+  for (unsigned int s = 0; s < m_segments.size(); s++) {
+    fileStream.write(m_segments[s].text.data(), m_segments[s].text.size());
+    if (m_segments[s].hasDataset) {
+      encodeDataset(fileStream, m_segments[s].dataset, m_segments[s].typeData, m_segments[s].precision, m_segments[s].binary);
+    }
+  }
+  fileStream.close();
+  if (fileStream.fail()) {
+    throw ErrorECOGEN("Error while writing file " + m_fileName, __FILE__, __LINE__);
+  }
+
+  //Release staged memory
+  std::vector<Segment>().swap(m_segments);
+  MemoryStats::remove(MEMOUTPUTSTAGING, m_size, 0);
+  m_size = 0;
+}
+
+//***********************************************************************
+
+void StagedFile::encodeDataset(std::ostream& stream, const std::vector<double>& dataset, TypeData typeData, int precision, bool binary)
+{
+  if (precision != 0) stream.precision(precision);
+  if (!binary) {
+    for (unsigned int k = 0; k < dataset.size(); k++) {
+      stream << dataset[k] << " ";
+    }
+  }
+  else {
+    int donneeInt;
+    float donneeFloat;
+    double donneeDouble;
+    char donneeChar;
+    int taille;
+    switch (typeData) {
+    case DOUBLE:
+      taille = dataset.size() * sizeof(double);
+      break;
+    case FLOAT:
+      taille = dataset.size() * sizeof(float);
+      break;
+    case INT:
+      taille = dataset.size() * sizeof(int);
+      break;
+    case CHAR:
+      taille = dataset.size() * sizeof(char);
+      break;
+    }
+    IO::writeb64(stream, taille);
+    char* chaineTampon = new char[taille];
+    int index          = 0;
+    switch (typeData) {
+    case DOUBLE:
+      for (unsigned int k = 0; k < dataset.size(); k++) {
+        donneeDouble = static_cast<double>(dataset[k]);
+        IO::addToTheString(chaineTampon, index, donneeDouble);
+      }
+      break;
+    case FLOAT:
+      for (unsigned int k = 0; k < dataset.size(); k++) {
+        donneeFloat = static_cast<float>(dataset[k]);
+        IO::addToTheString(chaineTampon, index, donneeFloat);
+      }
+      break;
+    case INT:
+      for (unsigned int k = 0; k < dataset.size(); k++) {
+        donneeInt = static_cast<int>(std::round(dataset[k]));
+        IO::addToTheString(chaineTampon, index, donneeInt);
+      }
+      break;
+    case CHAR:
+      for (unsigned int k = 0; k < dataset.size(); k++) {
+        donneeChar = static_cast<char>(dataset[k]);
+        IO::addToTheString(chaineTampon, index, donneeChar);
+      }
+      break;
+    }
+    IO::writeb64Chaine(stream, chaineTampon, taille);
+    delete[] chaineTampon;
+  }
+}
@@ -0,0 +1,91 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef STAGEDFILE_H
+#define STAGEDFILE_H
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../Tools.h"
+#include "../MemoryStats.h"
+
+//! \class     StagedFile
+//! \brief     In-memory image of an output file, written later by an OutputPipeline
+//! \details   Text is written through the usual std::ostream interface. Datasets are kept as raw copies of the
+//!            field values and only encoded (ASCII or base64 binary) when the file is written to disk. Snapshotting
+//!            a field therefore costs one memory copy on the solver side.
+class StagedFile : public std::ostream
+{
+  public:
+    //! \param   fileName  Full path of the file to be written
+    StagedFile(const std::string& fileName);
+    virtual ~StagedFile();
+
+    //! \brief   Stage a dataset at the current position of the file
+    //! \param   dataset   Values to be written, the vector is emptied (its content is moved into the staged file)
+    //! \param   typeData  Type used to encode the values
+    //! \param   precision Number of digits for ASCII writing (0 for default)
+    //! \param   binary    Choice to write binary/ASCII
+    void stageDataset(std::vector<double>& dataset, TypeData typeData, int precision, bool binary);
+
+    //! \brief   Move the text written so far into the staged content (done before submission to size the file)
+    void flushText();
+
+    //! \brief   Encode the staged content and write it to disk (truncating any existing file)
+    void write();
+
+    //! \brief   Encode a dataset into a stream (common to staged and direct writings)
+    static void encodeDataset(std::ostream& stream, const std::vector<double>& dataset, TypeData typeData, int precision, bool binary);
+
+    const std::string& getFileName() const { return m_fileName; };
+    //! \brief   Approximate memory held by the staged file (bytes)
+    std::size_t getSize() const { return m_size; };
+
+  private:
+    //! \brief   Piece of a staged file: a text block followed by an optional dataset
+    struct Segment
+    {
+      std::string text;
+      bool hasDataset;
+      std::vector<double> dataset;
+      TypeData typeData;
+      int precision;
+      bool binary;
+    };
+
+    std::string m_fileName;           //!<Full path of the file to be written
+    std::stringbuf m_buffer;          //!<Text written since the last staged dataset
+    std::vector<Segment> m_segments;  //!<Content of the file in writing order
+    std::size_t m_size;               //!<Approximate memory held by the staged file (bytes)
+};
+
+#endif //STAGEDFILE_H
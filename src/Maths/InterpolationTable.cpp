@@ -0,0 +1,294 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#include "InterpolationTable.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+//***********************************************************************
+
+InterpolationTable::InterpolationTable() :
+  m_nx(0),
+  m_ny(0),
+  m_xMin(0.),
+  m_xMax(0.),
+  m_yMin(0.),
+  m_yMax(0.),
+  m_logX(false),
+  m_logY(false),
+  m_uMin(0.),
+  m_du(1.),
+  m_vMin(0.),
+  m_dv(1.),
+  m_valueScale(0.),
+  m_error(0.)
+{}
+
+//***********************************************************************
+
+InterpolationTable::~InterpolationTable() {}
+
+//***********************************************************************
+
+bool InterpolationTable::build(const std::function<double(const double&, const double&)>& function,
+                               const double& xMin,
+                               const double& xMax,
+                               const double& yMin,
+                               const double& yMax,
+                               const bool& logX,
+                               const bool& logY,
+                               const int& points,
+                               const int& maxPoints,
+                               const double& tolerance)
+{
+  m_xMin = xMin;
+  m_xMax = xMax;
+  m_yMin = yMin;
+  m_yMax = yMax;
+  m_logX = logX;
+  m_logY = logY;
+  m_uMin = m_logX ? std::log(xMin) : xMin;
+  m_vMin = m_logY ? std::log(yMin) : yMin;
+  int nx(std::max(points, 2)), ny(std::max(points, 2));
+
+  while (true) {
+    //1) Sampling of the nodes
+    //------------------------
+    m_nx = nx;
+    m_ny = ny;
+    m_du = ((m_logX ? std::log(xMax) : xMax) - m_uMin) / static_cast<double>(m_nx - 1);
+    m_dv = ((m_logY ? std::log(yMax) : yMax) - m_vMin) / static_cast<double>(m_ny - 1);
+    if (!this->sample(function)) {
+      m_nodes.clear();
+      return false;
+    }
+
+    //2) Errors at the middles of the edges in each direction and at the centers of the cells
+    //---------------------------------------------------------------------------------------
+    double errorX(0.), errorY(0.), errorCenter(0.);
+    for (int j = 0; j < m_ny; j++) {
+      double y(this->positionY(j)), yMid(this->positionY(j + 0.5));
+      for (int i = 0; i < m_nx; i++) {
+        double x(this->positionX(i)), xMid(this->positionX(i + 0.5));
+        if (i < m_nx - 1) errorX = std::max(errorX, this->relativeError(function(xMid, y), this->interpolate(xMid, y)));
+        if (j < m_ny - 1) errorY = std::max(errorY, this->relativeError(function(x, yMid), this->interpolate(x, yMid)));
+        if (i < m_nx - 1 && j < m_ny - 1) {
+          errorCenter = std::max(errorCenter, this->relativeError(function(xMid, yMid), this->interpolate(xMid, yMid)));
+        }
+      }
+    }
+    m_error = std::max(errorCenter, std::max(errorX, errorY));
+    if (m_error <= tolerance) return true;
+
+    //3) Refinement of the directions where the tolerance is not reached
+    //-------------------------------------------------------------------
+    bool refineX(errorX > tolerance), refineY(errorY > tolerance);
+    if (!refineX && !refineY) {
+      refineX = true;
+      refineY = true;
+    }
+    if (refineX) nx = 2 * nx - 1;
+    if (refineY) ny = 2 * ny - 1;
+    if (nx > maxPoints || ny > maxPoints) return false;
+  }
+}
+
+//***********************************************************************
+
+bool InterpolationTable::sample(const std::function<double(const double&, const double&)>& function)
+{
+  m_nodes.assign(4 * m_nx * m_ny, 0.);
+  double valueMax(0.);
+  for (int j = 0; j < m_ny; j++) {
+    for (int i = 0; i < m_nx; i++) {
+      double value(function(this->positionX(i), this->positionY(j)));
+      if (!std::isfinite(value)) return false;
+      m_nodes[4 * (j * m_nx + i)] = value;
+      valueMax                    = std::max(valueMax, std::fabs(value));
+    }
+  }
+  m_valueScale = std::max(1.e-6 * valueMax, std::numeric_limits<double>::min());
+
+  //Derivatives in the first direction (fx), then in the second direction of f and fx (fy, fxy)
+  for (int j = 0; j < m_ny; j++) {
+    monotoneSlopes(m_nx, &m_nodes[4 * j * m_nx], 4, &m_nodes[4 * j * m_nx + 1], 4);
+  }
+  for (int i = 0; i < m_nx; i++) {
+    monotoneSlopes(m_ny, &m_nodes[4 * i], 4 * m_nx, &m_nodes[4 * i + 2], 4 * m_nx);
+    monotoneSlopes(m_ny, &m_nodes[4 * i + 1], 4 * m_nx, &m_nodes[4 * i + 3], 4 * m_nx);
+  }
+  return true;
+}
+
+//***********************************************************************
+
+void InterpolationTable::monotoneSlopes(const int& number, const double* values, const int& valueStride, double* slopes, const int& slopeStride)
+{
+  if (number < 4) {
+    double delta((number >= 2) ? (values[(number - 1) * valueStride] - values[0]) / (number - 1) : 0.);
+    for (int i = 0; i < number; i++) slopes[i * slopeStride] = delta;
+    return;
+  }
+  for (int i = 0; i < number; i++) {
+    const double* v(values + i * valueStride);
+    //1) Fourth-order centered differences, third-order one-sided differences near the ends
+    //-------------------------------------------------------------------------------------
+    double slope;
+    if (i == 0) slope = (-11. * v[0] + 18. * v[valueStride] - 9. * v[2 * valueStride] + 2. * v[3 * valueStride]) / 6.;
+    else if (i == number - 1) slope = (11. * v[0] - 18. * v[-valueStride] + 9. * v[-2 * valueStride] - 2. * v[-3 * valueStride]) / 6.;
+    else if (i == 1) slope = (-2. * v[-valueStride] - 3. * v[0] + 6. * v[valueStride] - v[2 * valueStride]) / 6.;
+    else if (i == number - 2) slope = (2. * v[valueStride] + 3. * v[0] - 6. * v[-valueStride] + v[-2 * valueStride]) / 6.;
+    else slope = (v[-2 * valueStride] - 8. * v[-valueStride] + 8. * v[valueStride] - v[2 * valueStride]) / 12.;
+
+    //2) Monotonicity filter (Hyman): slope of the sign of the adjacent differences and lower than 3 times their magnitude, zero at extrema
+    //-------------------------------------------------------------------------------------------------------------------------------------
+    double deltaL((i > 0) ? v[0] - v[-valueStride] : v[valueStride] - v[0]);
+    double deltaR((i < number - 1) ? v[valueStride] - v[0] : deltaL);
+    if (deltaL * deltaR <= 0. || slope * deltaL <= 0.) slope = 0.;
+    else slope = std::copysign(std::min(std::fabs(slope), 3. * std::min(std::fabs(deltaL), std::fabs(deltaR))), slope);
+    slopes[i * slopeStride] = slope;
+  }
+}
+
+//***********************************************************************
+
+double InterpolationTable::positionX(const double& s) const
+{
+  if (s <= 0.) return m_xMin;
+  if (s >= m_nx - 1) return m_xMax;
+  double u(m_uMin + s * m_du);
+  return m_logX ? std::exp(u) : u;
+}
+
+//***********************************************************************
+
+double InterpolationTable::positionY(const double& s) const
+{
+  if (s <= 0.) return m_yMin;
+  if (s >= m_ny - 1) return m_yMax;
+  double v(m_vMin + s * m_dv);
+  return m_logY ? std::exp(v) : v;
+}
+
+//***********************************************************************
+
+double InterpolationTable::interpolate(const double& x, const double& y) const
+{
+  //Cell containing the point and local coordinates in [0, 1]
+  double s(((m_logX ? std::log(x) : x) - m_uMin) / m_du);
+  double r(((m_logY ? std::log(y) : y) - m_vMin) / m_dv);
+  int i(std::min(std::max(static_cast<int>(s), 0), m_nx - 2));
+  int j(std::min(std::max(static_cast<int>(r), 0), m_ny - 2));
+  double t(s - i), w(r - j);
+
+  //Hermite basis functions
+  double hx0((1. + 2. * t) * (1. - t) * (1. - t)), hx1(t * t * (3. - 2. * t));
+  double gx0(t * (1. - t) * (1. - t)), gx1(t * t * (t - 1.));
+  double hy0((1. + 2. * w) * (1. - w) * (1. - w)), hy1(w * w * (3. - 2. * w));
+  double gy0(w * (1. - w) * (1. - w)), gy1(w * w * (w - 1.));
+
+  const double* n00(&m_nodes[4 * (j * m_nx + i)]);
+  const double* n10(n00 + 4);
+  const double* n01(n00 + 4 * m_nx);
+  const double* n11(n01 + 4);
+  return hy0 * (hx0 * n00[0] + gx0 * n00[1] + hx1 * n10[0] + gx1 * n10[1]) + gy0 * (hx0 * n00[2] + gx0 * n00[3] + hx1 * n10[2] + gx1 * n10[3]) +
+         hy1 * (hx0 * n01[0] + gx0 * n01[1] + hx1 * n11[0] + gx1 * n11[1]) + gy1 * (hx0 * n01[2] + gx0 * n01[3] + hx1 * n11[2] + gx1 * n11[3]);
+}
+
+//***********************************************************************
+
+double InterpolationTable::relativeError(const double& exact, const double& interpolated) const
+{
+  return std::fabs(interpolated - exact) / std::max(std::fabs(exact), m_valueScale);
+}
+
+//***********************************************************************
+
+bool InterpolationTable::verifyNodes(const std::function<double(const double&, const double&)>& function,
+                                     const int& number,
+                                     const double& tolerance) const
+{
+  int numberNodes(m_nx * m_ny);
+  for (int k = 0; k < std::min(number, numberNodes); k++) {
+    int node(static_cast<int>((static_cast<long long>(k) * (numberNodes - 1)) / std::max(number - 1, 1)));
+    int i(node % m_nx), j(node / m_nx);
+    if (!(this->relativeError(function(this->positionX(i), this->positionY(j)), m_nodes[4 * node]) <= tolerance)) return false;
+  }
+  return true;
+}
+
+//***********************************************************************
+
+void InterpolationTable::write(std::ostream& stream) const
+{
+  int logs[2] = {m_logX, m_logY};
+  double ranges[9] = {m_xMin, m_xMax, m_yMin, m_yMax, m_uMin, m_du, m_vMin, m_dv, m_valueScale};
+  stream.write(reinterpret_cast<const char*>(&m_nx), sizeof(int));
+  stream.write(reinterpret_cast<const char*>(&m_ny), sizeof(int));
+  stream.write(reinterpret_cast<const char*>(logs), sizeof(logs));
+  stream.write(reinterpret_cast<const char*>(ranges), sizeof(ranges));
+  stream.write(reinterpret_cast<const char*>(&m_error), sizeof(double));
+  stream.write(reinterpret_cast<const char*>(m_nodes.data()), m_nodes.size() * sizeof(double));
+}
+
+//***********************************************************************
+
+bool InterpolationTable::read(std::istream& stream)
+{
+  int logs[2];
+  double ranges[9];
+  stream.read(reinterpret_cast<char*>(&m_nx), sizeof(int));
+  stream.read(reinterpret_cast<char*>(&m_ny), sizeof(int));
+  stream.read(reinterpret_cast<char*>(logs), sizeof(logs));
+  stream.read(reinterpret_cast<char*>(ranges), sizeof(ranges));
+  stream.read(reinterpret_cast<char*>(&m_error), sizeof(double));
+  if (!stream || m_nx < 2 || m_ny < 2 || m_nx > (1 << 14) || m_ny > (1 << 14)) return false;
+  m_logX       = logs[0];
+  m_logY       = logs[1];
+  m_xMin       = ranges[0];
+  m_xMax       = ranges[1];
+  m_yMin       = ranges[2];
+  m_yMax       = ranges[3];
+  m_uMin       = ranges[4];
+  m_du         = ranges[5];
+  m_vMin       = ranges[6];
+  m_dv         = ranges[7];
+  m_valueScale = ranges[8];
+  m_nodes.resize(4 * m_nx * m_ny);
+  stream.read(reinterpret_cast<char*>(m_nodes.data()), m_nodes.size() * sizeof(double));
+  if (!stream) {
+    m_nodes.clear();
+    return false;
+  }
+  return true;
+}
+
+//***********************************************************************
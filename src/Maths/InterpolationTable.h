@@ -0,0 +1,135 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef INTERPOLATIONTABLE_H
+#define INTERPOLATIONTABLE_H
+
+#include <functional>
+#include <iostream>
+#include <vector>
+
+//! \class     InterpolationTable
+//! \brief     Table of a function of two variables with monotone bicubic interpolation
+//! \details   Nodes are uniformly spaced in each direction, in linear or logarithmic scale. Each node stores the value of the
+//!            function and its derivatives (\f$ f, \; f_x, \; f_y, \; f_{xy} \f$) contiguously, the interpolation in a cell
+//!            reading its four nodes only.
+//!            Derivatives are fourth-order finite differences filtered for monotonicity (Hyman) so that the interpolant does
+//!            not overshoot along the grid lines.
+//!            The number of nodes is refined by direction until the relative error at the middles of the grid
+//!            edges and cells is lower than the required tolerance.
+class InterpolationTable
+{
+  public:
+    InterpolationTable();
+    ~InterpolationTable();
+
+    //! \brief     Sample a function and refine the table until the required tolerance is reached
+    //! \param     function       function of the two variables to tabulate
+    //! \param     xMin           minimum of the first variable
+    //! \param     xMax           maximum of the first variable
+    //! \param     yMin           minimum of the second variable
+    //! \param     yMax           maximum of the second variable
+    //! \param     logX           logarithmic spacing of the nodes in the first direction (positive range only)
+    //! \param     logY           logarithmic spacing of the nodes in the second direction (positive range only)
+    //! \param     points         initial number of nodes in each direction
+    //! \param     maxPoints      maximum number of nodes in each direction
+    //! \param     tolerance      maximum relative error of the interpolation
+    //! \return    true if the tolerance is reached, false if the function is not finite on the range or if the maximum number of nodes is reached
+    bool build(const std::function<double(const double&, const double&)>& function,
+               const double& xMin,
+               const double& xMax,
+               const double& yMin,
+               const double& yMax,
+               const bool& logX,
+               const bool& logY,
+               const int& points,
+               const int& maxPoints,
+               const double& tolerance);
+
+    //! \brief     Return true if the point is in the range of the table
+    bool contains(const double& x, const double& y) const { return x >= m_xMin && x <= m_xMax && y >= m_yMin && y <= m_yMax; };
+    //! \brief     Interpolate the function, the point must be in the range of the table (see contains())
+    double interpolate(const double& x, const double& y) const;
+
+    //! \brief     Relative error of the interpolation
+    //! \param     exact          exact value
+    //! \param     interpolated   interpolated value
+    double relativeError(const double& exact, const double& interpolated) const;
+
+    //! \brief     Compare the values stored at a sample of nodes with the function
+    //! \param     function       tabulated function
+    //! \param     number         number of nodes compared
+    //! \param     tolerance      maximum relative difference
+    bool verifyNodes(const std::function<double(const double&, const double&)>& function, const int& number, const double& tolerance) const;
+
+    //! \brief     Position of a node (integer s) or of a point between nodes in the first direction
+    double positionX(const double& s) const;
+    //! \brief     Position of a node (integer s) or of a point between nodes in the second direction
+    double positionY(const double& s) const;
+
+    //! \brief     Write the table in a binary stream
+    void write(std::ostream& stream) const;
+    //! \brief     Read a table written by write()
+    //! \return    false if the stream is not complete
+    bool read(std::istream& stream);
+
+    bool isBuilt() const { return !m_nodes.empty(); };
+    const int& getNumberPointsX() const { return m_nx; };
+    const int& getNumberPointsY() const { return m_ny; };
+    const double& getError() const { return m_error; };
+    const double& getXMin() const { return m_xMin; };
+    const double& getXMax() const { return m_xMax; };
+    const double& getYMin() const { return m_yMin; };
+    const double& getYMax() const { return m_yMax; };
+
+  private:
+    //! \brief     Sample the function on the nodes and compute the derivatives
+    //! \return    false if a sampled value is not finite
+    bool sample(const std::function<double(const double&, const double&)>& function);
+    //! \brief     Compute the monotone derivatives (in number of cells) of a series of values
+    //! \param     number         number of values
+    //! \param     values         first value
+    //! \param     valueStride    stride between two values
+    //! \param     slopes         first derivative
+    //! \param     slopeStride    stride between two derivatives
+    static void monotoneSlopes(const int& number, const double* values, const int& valueStride, double* slopes, const int& slopeStride);
+    int m_nx;                   //!< Number of nodes in the first direction
+    int m_ny;                   //!< Number of nodes in the second direction
+    double m_xMin, m_xMax;      //!< Range of the first variable
+    double m_yMin, m_yMax;      //!< Range of the second variable
+    bool m_logX, m_logY;        //!< Logarithmic spacing of the nodes
+    double m_uMin, m_du;        //!< First transformed variable of the first node and spacing
+    double m_vMin, m_dv;        //!< Second transformed variable of the first node and spacing
+    double m_valueScale;        //!< Lower bound of the values used in the relative errors
+    double m_error;             //!< Maximum relative error measured at the last build
+    std::vector<double> m_nodes; //!< Nodes data (f, fx, fy, fxy), derivatives in number of cells
+};
+
+#endif // INTERPOLATIONTABLE_H
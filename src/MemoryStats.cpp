@@ -0,0 +1,142 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MemoryStats.h"
+#include "Parallel/Parallel.h"
+
+std::atomic<long long> MemoryStats::bytes[NUMBERMEMORYCATEGORIES];
+std::atomic<long long> MemoryStats::objects[NUMBERMEMORYCATEGORIES];
+std::atomic<long long> MemoryStats::totalBytes(0);
+std::atomic<long long> MemoryStats::peakBytes(0);
+thread_local MemoryCategory MemoryStats::redirection(NUMBERMEMORYCATEGORIES);
+
+//***********************************************************************
+
+void MemoryStats::add(const MemoryCategory& category, const std::size_t& numberBytes, const long long& numberObjects)
+{
+  bytes[category].fetch_add(numberBytes, std::memory_order_relaxed);
+  objects[category].fetch_add(numberObjects, std::memory_order_relaxed);
+  long long total(totalBytes.fetch_add(numberBytes, std::memory_order_relaxed) + numberBytes);
+  long long peak(peakBytes.load(std::memory_order_relaxed));
+  while (total > peak && !peakBytes.compare_exchange_weak(peak, total, std::memory_order_relaxed)) {}
+}
+
+//***********************************************************************
+
+void MemoryStats::remove(const MemoryCategory& category, const std::size_t& numberBytes, const long long& numberObjects)
+{
+  bytes[category].fetch_sub(numberBytes, std::memory_order_relaxed);
+  objects[category].fetch_sub(numberObjects, std::memory_order_relaxed);
+  totalBytes.fetch_sub(numberBytes, std::memory_order_relaxed);
+}
+
+//***********************************************************************
+
+void* MemoryStats::allocate(const MemoryCategory& category, const std::size_t& numberBytes)
+{
+  void* pointer(::operator new(numberBytes));
+  add(category, numberBytes);
+  return pointer;
+}
+
+//***********************************************************************
+
+void MemoryStats::deallocate(const MemoryCategory& category, void* pointer, const std::size_t& numberBytes)
+{
+  if (pointer == nullptr) return;
+  remove(category, numberBytes);
+  ::operator delete(pointer);
+}
+
+//***********************************************************************
+
+std::string MemoryStats::getCategoryName(const MemoryCategory& category)
+{
+  switch (category) {
+  case MEMCELLS:
+    return "cells";
+    break;
+  case MEMGHOSTCELLS:
+    return "ghostCells";
+    break;
+  case MEMCELLINTERFACES:
+    return "cellInterfaces";
+    break;
+  case MEMPHASES:
+    return "phases";
+    break;
+  case MEMMIXTURES:
+    return "mixtures";
+    break;
+  case MEMFLUXES:
+    return "fluxes";
+    break;
+  case MEMSLOPES:
+    return "slopes";
+    break;
+  case MEMCOMMBUFFERS:
+    return "communicationBuffers";
+    break;
+  case MEMOUTPUTSTAGING:
+    return "outputStaging";
+    break;
+  default:
+    return "unknown";
+    break;
+  }
+}
+
+//***********************************************************************
+
+void MemoryStats::reduce(std::vector<double>& report)
+{
+  //1) Counters summed over the CPUs
+  //--------------------------------
+  const int numberSums(2 * NUMBERMEMORYCATEGORIES + 2);
+  double localSums[numberSums], sums[numberSums];
+  for (int c = 0; c < NUMBERMEMORYCATEGORIES; c++) {
+    localSums[2 * c]     = static_cast<double>(getBytes(static_cast<MemoryCategory>(c)));
+    localSums[2 * c + 1] = static_cast<double>(getObjects(static_cast<MemoryCategory>(c)));
+  }
+  localSums[2 * NUMBERMEMORYCATEGORIES]     = static_cast<double>(getTotalBytes());
+  localSums[2 * NUMBERMEMORYCATEGORIES + 1] = static_cast<double>(getPeakBytes());
+  MPI_Allreduce(localSums, sums, numberSums, MPI_DOUBLE, MPI_SUM, computingComm);
+
+  //2) Most loaded CPU
+  //------------------
+  double localMax[2] = {localSums[2 * NUMBERMEMORYCATEGORIES], localSums[2 * NUMBERMEMORYCATEGORIES + 1]}, maxs[2];
+  MPI_Allreduce(localMax, maxs, 2, MPI_DOUBLE, MPI_MAX, computingComm);
+
+  report.assign(sums, sums + 2 * NUMBERMEMORYCATEGORIES + 1);
+  report.push_back(maxs[0]);
+  report.push_back(maxs[1]);
+  report.push_back(sums[2 * NUMBERMEMORYCATEGORIES + 1]);
+}
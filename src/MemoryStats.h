@@ -0,0 +1,150 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef MEMORYSTATS_H
+#define MEMORYSTATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <vector>
+
+//! \brief     Enumeration for the categories of memory tracked by MemoryStats
+enum MemoryCategory
+{
+  MEMCELLS               = 0, //!< Computational cells (Cell, CellO2, CellO2Cartesian, CellO2NS)
+  MEMGHOSTCELLS          = 1, //!< Ghost cells of the parallel computations (CellGhost, CellO2GhostCartesian, CellO2GhostNS)
+  MEMCELLINTERFACES      = 2, //!< Cell interfaces and boundaries
+  MEMPHASES              = 3, //!< Phase objects of the model
+  MEMMIXTURES            = 4, //!< Mixture objects of the model
+  MEMFLUXES              = 5, //!< Flux objects of the model
+  MEMSLOPES              = 6, //!< Second-order slopes stored on the Cartesian cell interfaces
+  MEMCOMMBUFFERS         = 7, //!< Send/receive buffers of the parallel communications (all levels)
+  MEMOUTPUTSTAGING       = 8, //!< Output files staged in memory and waiting to be written
+  NUMBERMEMORYCATEGORIES = 9
+};
+
+//! \class     MemoryStats
+//! \brief     Accounting of the memory (bytes and number of objects) held by the main structures of the solver
+//! \details   Counters are process-wide and thread-safe (staged output files are released by the writer thread).
+//!            Objects are accounted through MemoryTracked, buffers through allocateArray/releaseArray, other
+//!            structures through explicit add/remove calls. Allocator overheads are not included.
+class MemoryStats
+{
+  public:
+    static void add(const MemoryCategory& category, const std::size_t& numberBytes, const long long& numberObjects = 1);
+    static void remove(const MemoryCategory& category, const std::size_t& numberBytes, const long long& numberObjects = 1);
+
+    //! \brief     Allocation/deallocation functions of the MemoryTracked objects
+    static void* allocate(const MemoryCategory& category, const std::size_t& numberBytes);
+    static void deallocate(const MemoryCategory& category, void* pointer, const std::size_t& numberBytes);
+
+    //! \brief     Accounted replacement of new T[number] for buffers of trivial types
+    //! \details   The number of elements is stored in front of the array so that releaseArray knows the size.
+    template <class T> static T* allocateArray(const MemoryCategory& category, const std::size_t& number);
+    //! \brief     Accounted replacement of destroy_array() for buffers obtained by allocateArray
+    template <class T> static void releaseArray(const MemoryCategory& category, T*& array);
+
+    //! \brief     Category effectively accounted: the one of the active Redirection if any, the given one otherwise
+    static MemoryCategory redirect(const MemoryCategory& category)
+    {
+      return (redirection == NUMBERMEMORYCATEGORIES) ? category : redirection;
+    };
+
+    static long long getBytes(const MemoryCategory& category) { return bytes[category].load(std::memory_order_relaxed); };
+    static long long getObjects(const MemoryCategory& category) { return objects[category].load(std::memory_order_relaxed); };
+    static long long getTotalBytes() { return totalBytes.load(std::memory_order_relaxed); };
+    //! \brief     Highest value reached by the total of the tracked bytes since the start of the process
+    static long long getPeakBytes() { return peakBytes.load(std::memory_order_relaxed); };
+    static std::string getCategoryName(const MemoryCategory& category);
+
+    //! \brief     Sum the counters over the computing CPUs (collective on computingComm)
+    //! \param     report   Filled on every CPU with, for each category, the total bytes and number of objects, then the total
+    //!                     tracked bytes, its maximum over the CPUs, the maximum and the sum over the CPUs of the peak bytes
+    static void reduce(std::vector<double>& report);
+
+    //! \class     Redirection
+    //! \brief     Accounts the MemoryTracked objects allocated or deallocated by the current thread in another category
+    //!            during its lifetime (e.g. Phase objects used as slopes)
+    class Redirection
+    {
+      public:
+        Redirection(const MemoryCategory& category) : m_previous(redirection) { redirection = category; };
+        ~Redirection() { redirection = m_previous; };
+
+      private:
+        MemoryCategory m_previous;
+    };
+
+  private:
+    static std::atomic<long long> bytes[NUMBERMEMORYCATEGORIES];
+    static std::atomic<long long> objects[NUMBERMEMORYCATEGORIES];
+    static std::atomic<long long> totalBytes;
+    static std::atomic<long long> peakBytes;
+    static thread_local MemoryCategory redirection;
+
+    static const std::size_t arrayHeader = alignof(std::max_align_t); //!< Room kept in front of the arrays for their size
+};
+
+//! \class     MemoryTracked
+//! \brief     Base class accounting the dynamic allocations of the derived objects in a category of MemoryStats
+//! \details   The sized operator delete receives the size of the dynamic type through the virtual destructor of the
+//!            derived classes. A derived class accounted in another category redefines both operators.
+template <MemoryCategory Category> class MemoryTracked
+{
+  public:
+    static void* operator new(std::size_t size) { return MemoryStats::allocate(MemoryStats::redirect(Category), size); }
+    static void operator delete(void* pointer, std::size_t size) { MemoryStats::deallocate(MemoryStats::redirect(Category), pointer, size); }
+};
+
+//***********************************************************************
+
+template <class T> T* MemoryStats::allocateArray(const MemoryCategory& category, const std::size_t& number)
+{
+  char* block                           = static_cast<char*>(::operator new(arrayHeader + number * sizeof(T)));
+  *reinterpret_cast<std::size_t*>(block) = number;
+  add(category, number * sizeof(T));
+  return reinterpret_cast<T*>(block + arrayHeader);
+}
+
+//***********************************************************************
+
+template <class T> void MemoryStats::releaseArray(const MemoryCategory& category, T*& array)
+{
+  if (array == nullptr) return;
+  char* block = reinterpret_cast<char*>(array) - arrayHeader;
+  remove(category, *reinterpret_cast<std::size_t*>(block) * sizeof(T));
+  ::operator delete(block);
+  array = nullptr;
+}
+
+#endif // MEMORYSTATS_H
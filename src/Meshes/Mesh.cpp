@@ -53,9 +53,11 @@ void Mesh::writeResultsGnuplot(std::vector<Cell*>* cellsLvl, std::ofstream& file
 
 void Mesh::initializePersistentCommunications(const TypeMeshContainer<Cell*>& cells, std::string ordreCalcul)
 {
+  bool compact(parallel.initializeCompactExchange(cells));
   int numberVariablesPhaseToSend(0);
   for (int k = 0; k < numberPhases; k++) {
-    numberVariablesPhaseToSend += cells[0]->getPhase(k)->numberOfTransmittedVariables();
+    if (compact) { numberVariablesPhaseToSend += cells[0]->getPhase(k)->numberOfTransmittedVariablesCompact(); }
+    else { numberVariablesPhaseToSend += cells[0]->getPhase(k)->numberOfTransmittedVariables(); }
   }
   int numberVariablesMixtureToSend = cells[0]->getMixture()->numberOfTransmittedVariables();
   int m_numberPrimitiveVariables   = numberVariablesPhaseToSend + numberVariablesMixtureToSend + numberTransports;
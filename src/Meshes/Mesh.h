@@ -68,6 +68,10 @@ class Mesh
       return 0;
     };
     virtual void setImmersedBoundaries(TypeMeshContainer<CellInterface*>* /*cellInterfacesLvl*/, std::string /*ordreCalcul*/) const {};
+    //! \brief     Relative computational costs of a face and of a cell (model, relaxations, additional physics), used to balance the partitions
+    //! \param     faceCost         cost of a face
+    //! \param     cellCost         cost of a cell, apart from its faces
+    virtual void setComputationalCosts(const double& /*faceCost*/, const double& /*cellCost*/) {};
 
     //Accessors
     //---------
@@ -87,7 +91,7 @@ class Mesh
     //Printing
     //--------
     void writeResultsGnuplot(std::vector<Cell*>* cellsLvl, std::ofstream& fileStream, GeometricObject* objet = 0, bool recordPsat = false) const;
-    virtual void writeHeaderPiece(std::ofstream& /*fileStream*/, std::vector<Cell*>* /*cellsLvl*/) const
+    virtual void writeHeaderPiece(std::ostream& /*fileStream*/, std::vector<Cell*>* /*cellsLvl*/) const
     {
       Errors::errorMessage("writeHeaderPiece not available for considered mesh");
     };
@@ -140,6 +144,16 @@ class Mesh
     {
       Errors::errorMessage("refineCellAndCellInterfaces not available for requested mesh");
     };
+    //! \brief     Rebuild the arrays of cells and cell interfaces of level lvl + 1 from the cells of level lvl
+    //! \param     cellsLvl            cells of each level
+    //! \param     cellInterfacesLvl   cell interfaces of each level
+    //! \param     lvl                 level of the parent cells
+    virtual void buildLvlCellsAndLvlCellInterfacesArrays(TypeMeshContainer<Cell*>* /*cellsLvl*/,
+                                                         TypeMeshContainer<CellInterface*>* /*cellInterfacesLvl*/,
+                                                         const int& /*lvl*/)
+    {
+      Errors::errorMessage("buildLvlCellsAndLvlCellInterfacesArrays not available for requested mesh");
+    };
     //! \brief     Extracting absolute velocity for specific Moving Reference Frame computations
     //! \param     cellsLvl         data structure containing pointer to cells
     //! \param     sourceMRF        pointer to the corresponding MRF source
@@ -152,8 +166,9 @@ class Mesh
     {
       Errors::errorMessage("extractReferenceLength not available for considered mesh");
     };
-    virtual void printDomainDecomposition(std::ofstream& /*fileStream*/) {};
-    virtual void readDomainDecomposition(std::ifstream& /*fileStream*/) {};
+    virtual void printDomainDecomposition(std::ostream& /*fileStream*/) {};
+    virtual void readDomainDecomposition(std::istream& /*fileStream*/) {};
+    virtual long long getPositionCellLvl0(Cell* /*cell*/) const { return 0; }; //!< Position of a level-0 cell in the global ordering of the mesh (Morton key order for AMR)
 
     //Specific to AMR method
     //----------------------
@@ -691,14 +691,49 @@ void MeshCartesianAMR::procedureRaffinement(TypeMeshContainer<Cell*>* cellsLvl,
 
     //7) Reconstruction des arrays de cells et cell interfaces lvl + 1
     //----------------------------------------------------------------
-    cellsLvl[lvlPlus1].clear();
-    cellInterfacesLvl[lvlPlus1].clear();
-    for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
-      cellsLvl[lvl][i]->buildLvlCellsAndLvlInternalCellInterfacesArrays(cellsLvl, cellInterfacesLvl);
-    }
-    for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) {
-      cellInterfacesLvl[lvl][i]->constructionArrayExternalCellInterfacesLvl(cellInterfacesLvl);
-    }
+    this->buildLvlCellsAndLvlCellInterfacesArrays(cellsLvl, cellInterfacesLvl, lvl);
+  }
+}
+
+//***********************************************************************
+
+void MeshCartesianAMR::buildLvlCellsAndLvlCellInterfacesArrays(TypeMeshContainer<Cell*>* cellsLvl,
+                                                               TypeMeshContainer<CellInterface*>* cellInterfacesLvl,
+                                                               const int& lvl)
+{
+  //1) Gather cells and internal cell interfaces of lvl + 1 parent by parent, then external cell interfaces
+  //---------------------------------------------------------------------------------------------------------
+  cellsLvl[lvl + 1].clear();
+  cellInterfacesLvl[lvl + 1].clear();
+  for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
+    cellsLvl[lvl][i]->buildLvlCellsAndLvlInternalCellInterfacesArrays(cellsLvl, cellInterfacesLvl);
+  }
+  const unsigned int numberInternalCellInterfaces(cellInterfacesLvl[lvl + 1].size());
+  for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) {
+    cellInterfacesLvl[lvl][i]->constructionArrayExternalCellInterfacesLvl(cellInterfacesLvl);
+  }
+
+  //2) Morton order of cell interfaces
+  //----------------------------------
+  //Sort key: key of the level-lvl cell containing the left cell (its parent, or itself for a coarser neighbour).
+  //Internal cell interfaces are already sorted as their parents: only external ones are sorted before merging both ranges.
+  //Ties keep the gathering order (internal before external).
+  using key_value_type = decomposition::Key<3>::value_type;
+  using keyedCellInterface = std::pair<key_value_type, CellInterface*>;
+  const int shift(3); //Key<3>::child() shifts by 3 bits whatever the dimension
+  std::vector<keyedCellInterface> sortedCellInterfaces(cellInterfacesLvl[lvl + 1].size());
+  for (unsigned int b = 0; b < cellInterfacesLvl[lvl + 1].size(); b++) {
+    const Cell* cellLeft(cellInterfacesLvl[lvl + 1][b]->getCellLeft());
+    key_value_type key(cellLeft->getElement()->getKey().getIndex());
+    if (cellLeft->getLvl() > lvl) key >>= shift * (cellLeft->getLvl() - lvl);
+    sortedCellInterfaces[b] = std::make_pair(key, cellInterfacesLvl[lvl + 1][b]);
+  }
+  auto compareKeys = [](const keyedCellInterface& a, const keyedCellInterface& b) { return a.first < b.first; };
+  auto firstExternal = sortedCellInterfaces.begin() + numberInternalCellInterfaces;
+  std::stable_sort(firstExternal, sortedCellInterfaces.end(), compareKeys);
+  std::inplace_merge(sortedCellInterfaces.begin(), firstExternal, sortedCellInterfaces.end(), compareKeys);
+  for (unsigned int b = 0; b < sortedCellInterfaces.size(); b++) {
+    cellInterfacesLvl[lvl + 1][b] = sortedCellInterfaces[b].second;
   }
 }
 
@@ -710,7 +745,7 @@ std::string MeshCartesianAMR::whoAmI() const { return "CARTESIAN_AMR"; }
 //******************************** PRINTING ********************************
 //**************************************************************************
 
-void MeshCartesianAMR::writeHeaderPiece(std::ofstream& fileStream, TypeMeshContainer<Cell*>* cellsLvl) const
+void MeshCartesianAMR::writeHeaderPiece(std::ostream& fileStream, TypeMeshContainer<Cell*>* cellsLvl) const
 {
   int numberCells = 0, numberPointsPerCell = 4;
   for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
@@ -993,26 +1028,35 @@ void MeshCartesianAMR::refineCellAndCellInterfaces(Cell* cell, const std::vector
 
 //***********************************************************************
 
-void MeshCartesianAMR::printDomainDecomposition(std::ofstream& fileStream) { m_decomp.printDomainDecomposition(fileStream); }
+void MeshCartesianAMR::printDomainDecomposition(std::ostream& fileStream) { m_decomp.printDomainDecomposition(fileStream); }
 
 //***********************************************************************
 
-void MeshCartesianAMR::readDomainDecomposition(std::ifstream& fileStream)
+void MeshCartesianAMR::readDomainDecomposition(std::istream& fileStream)
 {
   std::array<int, 3> temp = {{m_numberCellsXGlobal, m_numberCellsYGlobal, m_numberCellsZGlobal}};
   m_decomp                = decomposition::Decomposition(temp);
   m_decomp.readDomainDecomposition(fileStream);
 }
 
+//***********************************************************************
+
+long long MeshCartesianAMR::getPositionCellLvl0(Cell* cell) const
+{
+  return static_cast<long long>(m_decomp.count_valid_keys_before(cell->getElement()->getKey()));
+}
+
 //****************************************************************************
 //****************************** Parallele ***********************************
 //****************************************************************************
 
 void MeshCartesianAMR::initializePersistentCommunications(const TypeMeshContainer<Cell*>& cells, std::string ordreCalcul)
 {
+  bool compact(parallel.initializeCompactExchange(cells));
   int numberVariablesPhaseToSend(0);
   for (int k = 0; k < numberPhases; k++) {
-    numberVariablesPhaseToSend += cells[0]->getPhase(k)->numberOfTransmittedVariables();
+    if (compact) { numberVariablesPhaseToSend += cells[0]->getPhase(k)->numberOfTransmittedVariablesCompact(); }
+    else { numberVariablesPhaseToSend += cells[0]->getPhase(k)->numberOfTransmittedVariables(); }
   }
   int numberVariablesMixtureToSend = cells[0]->getMixture()->numberOfTransmittedVariables();
   int m_numberPrimitiveVariables   = numberVariablesPhaseToSend + numberVariablesMixtureToSend + numberTransports;
@@ -1080,9 +1124,7 @@ void MeshCartesianAMR::parallelLoadBalancingAMR(TypeMeshContainer<Cell*>* cellsL
       cellsLvl[m_lvlMax][i]->prepareAddPhys();
     }
   }
-  for (unsigned int pa = 0; pa < addPhys.size(); pa++) {
-    addPhys[pa]->communicationsAddPhys(m_problemDimension, m_lvlMax);
-  }
+  parallel.communicationsAddPhys(addPhys, m_problemDimension, m_lvlMax);
 }
 
 //***********************************************************************
@@ -1140,7 +1182,7 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell*>* cells
 
   //Communicate overall loads
   double* loadPerCPU = new double[Ncpu];
-  MPI_Allgather(&localLoad, 1, MPI_DOUBLE, loadPerCPU, 1, MPI_DOUBLE, MPI_COMM_WORLD);
+  MPI_Allgather(&localLoad, 1, MPI_DOUBLE, loadPerCPU, 1, MPI_DOUBLE, computingComm);
 
   //Compute ideal load end position
   double idealLoadEndPosition(0.);
@@ -1168,11 +1210,11 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell*>* cells
   //Communicate what I wish to send/receive to/from neighbours
   double idealLoadShiftStart(0.);
   if (rankCpu != Ncpu - 1) {
-    MPI_Isend(&idealLoadShiftEnd, 1, MPI_DOUBLE, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
+    MPI_Isend(&idealLoadShiftEnd, 1, MPI_DOUBLE, rankCpu + 1, rankCpu + 1, computingComm, &req_neighborP1);
     MPI_Wait(&req_neighborP1, &status);
   }
   if (rankCpu != 0) {
-    MPI_Irecv(&idealLoadShiftStart, 1, MPI_DOUBLE, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
+    MPI_Irecv(&idealLoadShiftStart, 1, MPI_DOUBLE, rankCpu - 1, rankCpu, computingComm, &req_neighborM1);
     MPI_Wait(&req_neighborM1, &status);
   }
 
@@ -1199,12 +1241,12 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell*>* cells
         if (static_cast<int>(std::round(possibleLoadShiftStart)) >= static_cast<int>(std::round(idealLoadShiftStart))) break;
       }
       if (numberOfCellsToSendStart != 0) --numberOfCellsToSendStart;
-      MPI_Isend(&numberOfCellsToSendStart, 1, MPI_INT, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
+      MPI_Isend(&numberOfCellsToSendStart, 1, MPI_INT, rankCpu - 1, rankCpu, computingComm, &req_neighborM1);
       MPI_Wait(&req_neighborM1, &status);
     }
     else {
       //Receive possible load shift start
-      MPI_Irecv(&numberOfCellsToReceiveStart, 1, MPI_INT, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
+      MPI_Irecv(&numberOfCellsToReceiveStart, 1, MPI_INT, rankCpu - 1, rankCpu, computingComm, &req_neighborM1);
       MPI_Wait(&req_neighborM1, &status);
     }
   }
@@ -1225,12 +1267,12 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell*>* cells
           break;
       }
       if (numberOfCellsToSendEnd != 0) --numberOfCellsToSendEnd;
-      MPI_Isend(&numberOfCellsToSendEnd, 1, MPI_INT, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
+      MPI_Isend(&numberOfCellsToSendEnd, 1, MPI_INT, rankCpu + 1, rankCpu + 1, computingComm, &req_neighborP1);
       MPI_Wait(&req_neighborP1, &status);
     }
     else {
       //Receive possible load shift end
-      MPI_Irecv(&numberOfCellsToReceiveEnd, 1, MPI_INT, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
+      MPI_Irecv(&numberOfCellsToReceiveEnd, 1, MPI_INT, rankCpu + 1, rankCpu + 1, computingComm, &req_neighborP1);
       MPI_Wait(&req_neighborP1, &status);
     }
   }
@@ -1250,7 +1292,7 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell*>* cells
   if (localLoad > 1.e-8) {
     relativePossibleLoadShiftLocal /= localLoad;
   }
-  MPI_Allreduce(&relativePossibleLoadShiftLocal, &relativePossibleLoadShiftMax, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allreduce(&relativePossibleLoadShiftLocal, &relativePossibleLoadShiftMax, 1, MPI_DOUBLE, MPI_MAX, computingComm);
 
   if (init) {
     if (relativePossibleLoadShiftMax > 1.e-10) {
@@ -1281,13 +1323,13 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell*>* cells
       }
       //} //For levelwise balancing
     }
-    MPI_Isend(&indicesSendStart[0], numberOfCellsToSendStart, MPI_UNSIGNED_LONG_LONG, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
+    MPI_Isend(&indicesSendStart[0], numberOfCellsToSendStart, MPI_UNSIGNED_LONG_LONG, rankCpu - 1, rankCpu, computingComm, &req_neighborM1);
     MPI_Wait(&req_neighborM1, &status);
   }
 
   std::vector<typename decomposition::Key<3>::value_type> indicesReceiveEnd(numberOfCellsToReceiveEnd);
   if (numberOfCellsToReceiveEnd > 0) {
-    MPI_Irecv(&indicesReceiveEnd[0], numberOfCellsToReceiveEnd, MPI_UNSIGNED_LONG_LONG, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
+    MPI_Irecv(&indicesReceiveEnd[0], numberOfCellsToReceiveEnd, MPI_UNSIGNED_LONG_LONG, rankCpu + 1, rankCpu + 1, computingComm, &req_neighborP1);
     MPI_Wait(&req_neighborP1, &status);
   }
 
@@ -1303,13 +1345,13 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell*>* cells
       }
       //} //For levelwise balancing
     }
-    MPI_Isend(&indicesSendEnd[0], numberOfCellsToSendEnd, MPI_UNSIGNED_LONG_LONG, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
+    MPI_Isend(&indicesSendEnd[0], numberOfCellsToSendEnd, MPI_UNSIGNED_LONG_LONG, rankCpu + 1, rankCpu + 1, computingComm, &req_neighborP1);
     MPI_Wait(&req_neighborP1, &status);
   }
 
   std::vector<typename decomposition::Key<3>::value_type> indicesReceiveStart(numberOfCellsToReceiveStart);
   if (numberOfCellsToReceiveStart > 0) {
-    MPI_Irecv(&indicesReceiveStart[0], numberOfCellsToReceiveStart, MPI_UNSIGNED_LONG_LONG, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
+    MPI_Irecv(&indicesReceiveStart[0], numberOfCellsToReceiveStart, MPI_UNSIGNED_LONG_LONG, rankCpu - 1, rankCpu, computingComm, &req_neighborM1);
     MPI_Wait(&req_neighborM1, &status);
   }
 
@@ -1336,9 +1378,6 @@ void MeshCartesianAMR::balance(TypeMeshContainer<Cell*>* cellsLvl,
                                std::vector<GeometricalDomain*>& solidDomains)
 {
   int counter(0), counterSplit(0);
-  MPI_Request req_neighborP1;
-  MPI_Request req_neighborM1;
-  MPI_Status status;
 
   std::sort(indicesSendStartGlobal.begin(), indicesSendStartGlobal.end());
   std::sort(indicesSendEndGlobal.begin(), indicesSendEndGlobal.end());
@@ -1398,43 +1437,26 @@ void MeshCartesianAMR::balance(TypeMeshContainer<Cell*>* cellsLvl,
   bufferReceiveCells.insert(bufferReceiveCells.end(), bufferReceiveCellsStart.begin(), bufferReceiveCellsStart.end());
   bufferReceiveCells.insert(bufferReceiveCells.end(), bufferReceiveCellsEnd.begin(), bufferReceiveCellsEnd.end());
 
-  //2) Erase the pointers to the corresponding base cells from cellsLvl (cells are not deleted yet)
-  //-----------------------------------------------------------------------------------------------
+  //2) Extract the pointers to the corresponding base cells from cellsLvl (cells are not deleted yet)
+  //-------------------------------------------------------------------------------------------------
+  //cellsLvl[0] and both send lists are sorted by key: a single compaction pass extracts the sent cells and keeps the order of the others
   TypeMeshContainer<Cell*> bufferSendCellsStart(numberOfCellsToSendStartGlobal);
   TypeMeshContainer<Cell*> bufferSendCellsEnd(numberOfCellsToSendEndGlobal);
   TypeMeshContainer<Cell*> bufferSendCells;
-  if (indicesSendStartGlobal.size() != 0) {
-    counter = 0;
-    auto it = cellsLvl[0].begin();
-    while (it != cellsLvl[0].end()) {
-      if (indicesSendStartGlobal[counter] == (*it)->getElement()->getKey().getIndex()) {
-        bufferSendCellsStart[counter] = *it;
-        ++counter;
-        it = cellsLvl[0].erase(it);
-        if ((unsigned int)counter == numberOfCellsToSendStartGlobal) break;
-      }
-      else {
-        ++it;
-      }
+  unsigned int counterSendStart(0), counterSendEnd(0), numberKeptCells(0);
+  for (unsigned int i = 0; i < cellsLvl[0].size(); ++i) {
+    const auto index = cellsLvl[0][i]->getElement()->getKey().getIndex();
+    if (counterSendStart < numberOfCellsToSendStartGlobal && indicesSendStartGlobal[counterSendStart] == index) {
+      bufferSendCellsStart[counterSendStart++] = cellsLvl[0][i];
     }
-  }
-
-  if (indicesSendEndGlobal.size() != 0) {
-    counter  = 0;
-    auto rit = cellsLvl[0].rbegin();
-    while (rit != cellsLvl[0].rend()) {
-      if (indicesSendEndGlobal[numberOfCellsToSendEndGlobal - 1 - counter] == (*rit)->getElement()->getKey().getIndex()) {
-        bufferSendCellsEnd[numberOfCellsToSendEndGlobal - 1 - counter] = *rit;
-        ++counter;
-        auto it = cellsLvl[0].erase(--rit.base());
-        rit     = std::reverse_iterator<std::vector<Cell*>::iterator>(it);
-        if ((unsigned int)counter == numberOfCellsToSendEndGlobal) break;
-      }
-      else {
-        ++rit;
-      }
+    else if (counterSendEnd < numberOfCellsToSendEndGlobal && indicesSendEndGlobal[counterSendEnd] == index) {
+      bufferSendCellsEnd[counterSendEnd++] = cellsLvl[0][i];
+    }
+    else {
+      cellsLvl[0][numberKeptCells++] = cellsLvl[0][i];
     }
   }
+  cellsLvl[0].resize(numberKeptCells);
 
   bufferSendCells.insert(bufferSendCells.end(), bufferSendCellsStart.begin(), bufferSendCellsStart.end());
   bufferSendCells.insert(bufferSendCells.end(), bufferSendCellsEnd.begin(), bufferSendCellsEnd.end());
@@ -1509,95 +1531,79 @@ void MeshCartesianAMR::balance(TypeMeshContainer<Cell*>* cellsLvl,
 
   //7) Send/Receive physical values of cells lvl >= 0 and create new cells and new internal cell interfaces of lvl > 0
   //------------------------------------------------------------------------------------------------------------------
-  //Count and communicate number of data (physical values and cell trees) to send/receive + fill corresponding vectors
-  int numberSendStart(0), numberSendEnd(0), numberReceiveStart(0), numberReceiveEnd(0);
-  int numberSplitSendStart(0), numberSplitSendEnd(0), numberSplitReceiveStart(0), numberSplitReceiveEnd(0);
+  //Both neighbours are exchanged concurrently with non-blocking messages (no chain of blocking pairs through the CPUs).
+  //For each direction, a message with the number of data (physical values, cell trees) is followed by the two data messages,
+  //on the same tag: MPI non-overtaking order keeps them matched.
+  //Fill buffer vectors to send
   std::vector<double> dataToSendStart, dataToSendEnd;
   std::vector<int> dataSplitToSendStart, dataSplitToSendEnd;
-  if (numberOfCellsToSendStartGlobal > 0) {
-    //Count and fill buffer vector send
-    for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
-      for (unsigned int i = 0; i < bufferSendCellsStart.size(); i++) {
-        bufferSendCellsStart[i]->fillDataToSend(dataToSendStart, dataSplitToSendStart, lvl);
-      }
+  for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
+    for (unsigned int i = 0; i < bufferSendCellsStart.size(); i++) {
+      bufferSendCellsStart[i]->fillDataToSend(dataToSendStart, dataSplitToSendStart, lvl);
+    }
+    for (unsigned int i = 0; i < bufferSendCellsEnd.size(); i++) {
+      bufferSendCellsEnd[i]->fillDataToSend(dataToSendEnd, dataSplitToSendEnd, lvl);
     }
-    numberSendStart      = dataToSendStart.size();
-    numberSplitSendStart = dataSplitToSendStart.size();
-    MPI_Isend(&numberSendStart, 1, MPI_INT, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
-    MPI_Wait(&req_neighborM1, &status);
-    MPI_Isend(&numberSplitSendStart, 1, MPI_INT, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
-    MPI_Wait(&req_neighborM1, &status);
   }
-  if (numberOfCellsToReceiveEndGlobal > 0) {
-    MPI_Irecv(&numberReceiveEnd, 1, MPI_INT, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
-    MPI_Wait(&req_neighborP1, &status);
-    MPI_Irecv(&numberSplitReceiveEnd, 1, MPI_INT, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
-    MPI_Wait(&req_neighborP1, &status);
+  int numberSendStart[2] = {static_cast<int>(dataToSendStart.size()), static_cast<int>(dataSplitToSendStart.size())};
+  int numberSendEnd[2]   = {static_cast<int>(dataToSendEnd.size()), static_cast<int>(dataSplitToSendEnd.size())};
+  int numberReceiveStart[2] = {0, 0}, numberReceiveEnd[2] = {0, 0};
+
+  //Communicate number of data to send/receive
+  MPI_Request requests[4];
+  int numberRequests(0);
+  if (numberOfCellsToSendStartGlobal > 0) {
+    MPI_Isend(numberSendStart, 2, MPI_INT, rankCpu - 1, rankCpu, computingComm, &requests[numberRequests++]);
   }
   if (numberOfCellsToSendEndGlobal > 0) {
-    //Count and fill buffer vector send
-    for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
-      for (unsigned int i = 0; i < bufferSendCellsEnd.size(); i++) {
-        bufferSendCellsEnd[i]->fillDataToSend(dataToSendEnd, dataSplitToSendEnd, lvl);
-      }
-    }
-    numberSendEnd      = dataToSendEnd.size();
-    numberSplitSendEnd = dataSplitToSendEnd.size();
-    MPI_Isend(&numberSendEnd, 1, MPI_INT, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
-    MPI_Wait(&req_neighborP1, &status);
-    MPI_Isend(&numberSplitSendEnd, 1, MPI_INT, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
-    MPI_Wait(&req_neighborP1, &status);
+    MPI_Isend(numberSendEnd, 2, MPI_INT, rankCpu + 1, rankCpu + 1, computingComm, &requests[numberRequests++]);
   }
   if (numberOfCellsToReceiveStartGlobal > 0) {
-    MPI_Irecv(&numberReceiveStart, 1, MPI_INT, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
-    MPI_Wait(&req_neighborM1, &status);
-    MPI_Irecv(&numberSplitReceiveStart, 1, MPI_INT, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
-    MPI_Wait(&req_neighborM1, &status);
+    MPI_Irecv(numberReceiveStart, 2, MPI_INT, rankCpu - 1, rankCpu, computingComm, &requests[numberRequests++]);
   }
+  if (numberOfCellsToReceiveEndGlobal > 0) {
+    MPI_Irecv(numberReceiveEnd, 2, MPI_INT, rankCpu + 1, rankCpu + 1, computingComm, &requests[numberRequests++]);
+  }
+  MPI_Waitall(numberRequests, requests, MPI_STATUSES_IGNORE);
 
   //Send/Receive data
-  std::vector<double> dataToReceiveStart(numberReceiveStart), dataToReceiveEnd(numberReceiveEnd);
-  std::vector<int> dataSplitToReceiveStart(numberSplitReceiveStart), dataSplitToReceiveEnd(numberSplitReceiveEnd);
+  std::vector<double> dataToReceiveStart(numberReceiveStart[0]), dataToReceiveEnd(numberReceiveEnd[0]);
+  std::vector<int> dataSplitToReceiveStart(numberReceiveStart[1]), dataSplitToReceiveEnd(numberReceiveEnd[1]);
+  MPI_Request requestsData[8];
+  numberRequests = 0;
   if (numberOfCellsToSendStartGlobal > 0) {
-    MPI_Isend(&dataToSendStart[0], numberSendStart, MPI_DOUBLE, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
-    MPI_Wait(&req_neighborM1, &status);
-    MPI_Isend(&dataSplitToSendStart[0], numberSplitSendStart, MPI_INT, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
-    MPI_Wait(&req_neighborM1, &status);
-  }
-  if (numberOfCellsToReceiveEndGlobal > 0) {
-    MPI_Irecv(&dataToReceiveEnd[0], numberReceiveEnd, MPI_DOUBLE, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
-    MPI_Wait(&req_neighborP1, &status);
-    MPI_Irecv(&dataSplitToReceiveEnd[0], numberSplitReceiveEnd, MPI_INT, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
-    MPI_Wait(&req_neighborP1, &status);
-    //Get buffer vector receive + Refine cells and internal cell interfaces
-    counter      = 0;
-    counterSplit = 0;
-    for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
-      for (unsigned int i = 0; i < bufferReceiveCellsEnd.size(); i++) {
-        bufferReceiveCellsEnd[i]->getDataToReceiveAndRefine(
-          dataToReceiveEnd, dataSplitToReceiveEnd, lvl, eos, counter, counterSplit, m_numberCellsY, m_numberCellsZ, addPhys);
-      }
-    }
+    MPI_Isend(dataToSendStart.data(), numberSendStart[0], MPI_DOUBLE, rankCpu - 1, rankCpu, computingComm, &requestsData[numberRequests++]);
+    MPI_Isend(dataSplitToSendStart.data(), numberSendStart[1], MPI_INT, rankCpu - 1, rankCpu, computingComm, &requestsData[numberRequests++]);
   }
   if (numberOfCellsToSendEndGlobal > 0) {
-    MPI_Isend(&dataToSendEnd[0], numberSendEnd, MPI_DOUBLE, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
-    MPI_Wait(&req_neighborP1, &status);
-    MPI_Isend(&dataSplitToSendEnd[0], numberSplitSendEnd, MPI_INT, rankCpu + 1, rankCpu + 1, MPI_COMM_WORLD, &req_neighborP1);
-    MPI_Wait(&req_neighborP1, &status);
+    MPI_Isend(dataToSendEnd.data(), numberSendEnd[0], MPI_DOUBLE, rankCpu + 1, rankCpu + 1, computingComm, &requestsData[numberRequests++]);
+    MPI_Isend(dataSplitToSendEnd.data(), numberSendEnd[1], MPI_INT, rankCpu + 1, rankCpu + 1, computingComm, &requestsData[numberRequests++]);
   }
   if (numberOfCellsToReceiveStartGlobal > 0) {
-    MPI_Irecv(&dataToReceiveStart[0], numberReceiveStart, MPI_DOUBLE, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
-    MPI_Wait(&req_neighborM1, &status);
-    MPI_Irecv(&dataSplitToReceiveStart[0], numberSplitReceiveStart, MPI_INT, rankCpu - 1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
-    MPI_Wait(&req_neighborM1, &status);
-    //Get buffer vector receive + Refine cells and internal cell interfaces
-    counter      = 0;
-    counterSplit = 0;
-    for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
-      for (unsigned int i = 0; i < bufferReceiveCellsStart.size(); i++) {
-        bufferReceiveCellsStart[i]->getDataToReceiveAndRefine(
-          dataToReceiveStart, dataSplitToReceiveStart, lvl, eos, counter, counterSplit, m_numberCellsY, m_numberCellsZ, addPhys);
-      }
+    MPI_Irecv(dataToReceiveStart.data(), numberReceiveStart[0], MPI_DOUBLE, rankCpu - 1, rankCpu, computingComm, &requestsData[numberRequests++]);
+    MPI_Irecv(dataSplitToReceiveStart.data(), numberReceiveStart[1], MPI_INT, rankCpu - 1, rankCpu, computingComm, &requestsData[numberRequests++]);
+  }
+  if (numberOfCellsToReceiveEndGlobal > 0) {
+    MPI_Irecv(dataToReceiveEnd.data(), numberReceiveEnd[0], MPI_DOUBLE, rankCpu + 1, rankCpu + 1, computingComm, &requestsData[numberRequests++]);
+    MPI_Irecv(dataSplitToReceiveEnd.data(), numberReceiveEnd[1], MPI_INT, rankCpu + 1, rankCpu + 1, computingComm, &requestsData[numberRequests++]);
+  }
+  MPI_Waitall(numberRequests, requestsData, MPI_STATUSES_IGNORE);
+
+  //Get buffer vectors received + Refine cells and internal cell interfaces
+  counter      = 0;
+  counterSplit = 0;
+  for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
+    for (unsigned int i = 0; i < bufferReceiveCellsEnd.size(); i++) {
+      bufferReceiveCellsEnd[i]->getDataToReceiveAndRefine(
+        dataToReceiveEnd, dataSplitToReceiveEnd, lvl, eos, counter, counterSplit, m_numberCellsY, m_numberCellsZ, addPhys);
+    }
+  }
+  counter      = 0;
+  counterSplit = 0;
+  for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
+    for (unsigned int i = 0; i < bufferReceiveCellsStart.size(); i++) {
+      bufferReceiveCellsStart[i]->getDataToReceiveAndRefine(
+        dataToReceiveStart, dataSplitToReceiveStart, lvl, eos, counter, counterSplit, m_numberCellsY, m_numberCellsZ, addPhys);
     }
   }
 
@@ -1657,14 +1663,7 @@ void MeshCartesianAMR::balance(TypeMeshContainer<Cell*>* cellsLvl,
     parallel.updatePersistentCommunicationsLvlAMR(lvl + 1, m_problemDimension);
 
     //Reconstruction of the arrays of cells and cell interfaces of lvl + 1
-    cellsLvl[lvl + 1].clear();
-    cellInterfacesLvl[lvl + 1].clear();
-    for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
-      cellsLvl[lvl][i]->buildLvlCellsAndLvlInternalCellInterfacesArrays(cellsLvl, cellInterfacesLvl);
-    }
-    for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) {
-      cellInterfacesLvl[lvl][i]->constructionArrayExternalCellInterfacesLvl(cellInterfacesLvl);
-    }
+    this->buildLvlCellsAndLvlCellInterfacesArrays(cellsLvl, cellInterfacesLvl, lvl);
   }
   parallel.communicationsPrimitives(eos, m_lvlMax);
   nbCellsTotalAMR = 0;
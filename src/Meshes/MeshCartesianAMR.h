@@ -91,7 +91,7 @@ class MeshCartesianAMR : public MeshCartesian
     std::string whoAmI() const override;
 
     //Printing / Reading
-    void writeHeaderPiece(std::ofstream& fileStream, TypeMeshContainer<Cell*>* cellsLvl) const override;
+    void writeHeaderPiece(std::ostream& fileStream, TypeMeshContainer<Cell*>* cellsLvl) const override;
     void getNodes(std::vector<double>& dataset, std::vector<Cell*>* cellsLvl) const override;
     void getConnectivity(std::vector<double>& dataset, std::vector<Cell*>* cellsLvl) const override;
     void getOffsets(std::vector<double>& dataset, std::vector<Cell*>* cellsLvl) const override;
@@ -99,8 +99,19 @@ class MeshCartesianAMR : public MeshCartesian
     void getData(TypeMeshContainer<Cell*>* cellsLvl, std::vector<double>& dataset, const int var, int phase) const override;
     void setDataSet(std::vector<double>& dataset, TypeMeshContainer<Cell*>* cellsLvl, const int var, int phase) const override;
     void refineCellAndCellInterfaces(Cell* cell, const std::vector<AddPhys*>& addPhys, int& nbCellsTotalAMR) override;
-    void printDomainDecomposition(std::ofstream& fileStream) override;
-    void readDomainDecomposition(std::ifstream& fileStream) override;
+    //! \brief     Rebuild the arrays of level lvl + 1 in Morton order
+    //! \details   Cells of level lvl + 1 inherit the Morton order of level lvl (children are created in Morton child order).
+    //!            Cell interfaces are gathered as internal then external ones, they are reordered by the key of the level-lvl
+    //!            cell on their left so that flux loops sweep the cells of level lvl + 1 once, parent by parent.
+    //! \param     cellsLvl            cells of each level
+    //! \param     cellInterfacesLvl   cell interfaces of each level
+    //! \param     lvl                 level of the parent cells
+    void buildLvlCellsAndLvlCellInterfacesArrays(TypeMeshContainer<Cell*>* cellsLvl,
+                                                 TypeMeshContainer<CellInterface*>* cellInterfacesLvl,
+                                                 const int& lvl) override;
+    void printDomainDecomposition(std::ostream& fileStream) override;
+    void readDomainDecomposition(std::istream& fileStream) override;
+    long long getPositionCellLvl0(Cell* cell) const override;
 
     //Accesseurs
     int getLvlMax() const override { return m_lvlMax; };
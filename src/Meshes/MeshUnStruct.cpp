@@ -30,6 +30,8 @@
 
 #include "MeshUnStruct.h"
 #include "../Errors.h"
+#include <algorithm>
+#include <cstring>
 
 using namespace tinyxml2;
 
@@ -47,6 +49,13 @@ MeshUnStruct::MeshUnStruct(const std::string& meshFile, const std::string& meshE
   m_numberCommunicatingElements(0),
   m_elements(nullptr),
   m_faces(nullptr),
+  m_renumbering(false),
+  m_partitioner("GMSH"),
+  m_faceCost(1.),
+  m_cellCost(0.),
+  m_meshCache(false),
+  m_numberInnerFaces(0),
+  m_numberBoundFaces(0),
   m_numberFacesParallel(0),
   m_numberGhostCells(0),
   m_numberElements0D(0),
@@ -58,6 +67,7 @@ MeshUnStruct::MeshUnStruct(const std::string& meshFile, const std::string& meshE
   m_numberQuadrangles(0),
   m_numberTetrahedrons(0),
   m_numberPyramids(0),
+  m_numberPrisms(0),
   m_numberPoints(0),
   m_numberHexahedrons(0),
   m_totalSurface(0.),
@@ -148,10 +158,13 @@ int MeshUnStruct::initializeGeometrie(TypeMeshContainer<Cell*>& cells,
         if (rankCpu == 0) {
           this->preProcessMeshFileForParallel();
         }
-        MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Barrier(computingComm);
       }
       this->initGeometryParallel(cells, cellsGhost, cellInterfaces, ordreCalcul);
     }
+    if (m_renumbering) {
+      this->renumberCellsAndCellInterfaces(cells, cellsGhost, cellInterfaces);
+    }
     return m_problemDimension;
   }
   catch (ErrorECOGEN&) {
@@ -161,6 +174,417 @@ int MeshUnStruct::initializeGeometrie(TypeMeshContainer<Cell*>& cells,
 
 //***********************************************************************
 
+void MeshUnStruct::renumberCellsAndCellInterfaces(TypeMeshContainer<Cell*>& cells,
+                                                  TypeMeshContainer<Cell*>& cellsGhost,
+                                                  TypeMeshContainer<CellInterface*>& cellInterfaces)
+{
+  clock_t tTemp(clock());
+  if (rankCpu == 0) {
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << " E) RENUMBERING CELLS AND CELL INTERFACES (MORTON ORDER) ..." << std::endl;
+  }
+
+  // 1) Bounding box of element centers (inner and ghost cells)
+  // ----------------------------------------------------------
+  Coord posMin(1.e30, 1.e30, 1.e30), posMax(-1.e30, -1.e30, -1.e30);
+  for (int c = 0; c < 2; c++) {
+    TypeMeshContainer<Cell*>& cellsRef = (c == 0) ? cells : cellsGhost;
+    for (unsigned int i = 0; i < cellsRef.size(); i++) {
+      const Coord& pos(cellsRef[i]->getPosition());
+      posMin.setXYZ(std::min(posMin.getX(), pos.getX()), std::min(posMin.getY(), pos.getY()), std::min(posMin.getZ(), pos.getZ()));
+      posMax.setXYZ(std::max(posMax.getX(), pos.getX()), std::max(posMax.getY(), pos.getY()), std::max(posMax.getZ(), pos.getZ()));
+    }
+  }
+
+  // 2) Cells sorted by Morton key (16 bits per direction)
+  // -----------------------------------------------------
+  const double nbSubdivisions(65535.); // 2^16 - 1, range where decomposition::Key<3> bit splitting is exact
+  double length(std::max(posMax.getX() - posMin.getX(), std::max(posMax.getY() - posMin.getY(), posMax.getZ() - posMin.getZ())));
+  if (length <= 0.) length = 1.;
+  typedef std::pair<decomposition::Key<3>::value_type, Cell*> KeyCell;
+  for (int c = 0; c < 2; c++) {
+    TypeMeshContainer<Cell*>& cellsRef = (c == 0) ? cells : cellsGhost;
+    int offset((c == 0) ? 0 : m_numberCellsCalcul);
+    std::vector<KeyCell> keys(cellsRef.size());
+    for (unsigned int i = 0; i < cellsRef.size(); i++) {
+      Coord pos(cellsRef[i]->getPosition() - posMin);
+      decomposition::Key<3> key(static_cast<int>(pos.getX() / length * nbSubdivisions),
+                                static_cast<int>(pos.getY() / length * nbSubdivisions),
+                                static_cast<int>(pos.getZ() / length * nbSubdivisions));
+      keys[i] = KeyCell(key.getIndex(), cellsRef[i]);
+    }
+    std::stable_sort(keys.begin(), keys.end(), [](const KeyCell& a, const KeyCell& b) { return a.first < b.first; });
+    for (unsigned int i = 0; i < cellsRef.size(); i++) {
+      cellsRef[i] = keys[i].second;
+      cellsRef[i]->setElement(cellsRef[i]->getElement(), offset + i); // Update element -> cell mapping used by outputs
+    }
+  }
+
+  // 3) Cell interfaces sorted by (lowest, highest) neighboring cell indices
+  // -----------------------------------------------------------------------
+  // m_faces is permuted identically to keep cellInterfaces[i] and m_faces[i] linked.
+  std::vector<std::pair<std::pair<int, int>, int>> faceKeys(cellInterfaces.size());
+  for (unsigned int i = 0; i < cellInterfaces.size(); i++) {
+    int numCellL(cellInterfaces[i]->getCellLeft()->getElement()->getNumCellAssociee());
+    int numCellR(numCellL); // Boundary conditions have no right cell
+    if (cellInterfaces[i]->getCellRight() != nullptr) numCellR = cellInterfaces[i]->getCellRight()->getElement()->getNumCellAssociee();
+    faceKeys[i] = std::make_pair(std::make_pair(std::min(numCellL, numCellR), std::max(numCellL, numCellR)), i);
+  }
+  std::stable_sort(faceKeys.begin(), faceKeys.end());
+  TypeMeshContainer<CellInterface*> cellInterfacesSorted(cellInterfaces.size());
+  FaceNS** facesSorted = new FaceNS*[m_numberFacesTotal];
+  for (unsigned int i = 0; i < cellInterfaces.size(); i++) {
+    cellInterfacesSorted[i] = cellInterfaces[faceKeys[i].second];
+    facesSorted[i]          = m_faces[faceKeys[i].second];
+  }
+  cellInterfaces.swap(cellInterfacesSorted);
+  delete[] m_faces;
+  m_faces = facesSorted;
+
+  MPI_Barrier(computingComm);
+  if (rankCpu == 0) {
+    tTemp = clock() - tTemp;
+    std::cout << "    OK in " << static_cast<double>(tTemp) / CLOCKS_PER_SEC << " seconds" << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+  }
+}
+
+//***********************************************************************
+
+ElementNS* MeshUnStruct::createElement(const int& typeGmsh)
+{
+  ElementNS* element(MeshUnStruct::allocateElement(typeGmsh));
+  if (element == nullptr) {
+    Errors::errorMessage("Element type of file .msh inknown for ECOGEN");
+  }
+  else {
+    this->countElement(typeGmsh);
+  }
+  return element;
+}
+
+//***********************************************************************
+
+ElementNS* MeshUnStruct::allocateElement(const int& typeGmsh)
+{
+  switch (typeGmsh) {
+  case 1: // Segment (two points)
+    return new ElementSegment;
+  case 2: // Triangle (three points)
+    return new ElementTriangle;
+  case 3: // Quadrangle (four points)
+    return new ElementQuadrangle;
+  case 4: // Tetrahedron (four points)
+    return new ElementTetrahedron;
+  case 7: // Quadrangular pyramid (five points) // This element seems to not work with Gmsh, volumes of elements seem to cause this issue
+    return new ElementPyramid;
+  case 15: // Point (a vertex)
+    return new ElementPoint;
+  case 5: // Hexahedron (eight points)
+    return new ElementHexahedron;
+  case 6: // Prism (six points)
+    return new ElementPrism;
+  default:
+    return nullptr;
+  }
+}
+
+//***********************************************************************
+
+void MeshUnStruct::countElement(const int& typeGmsh)
+{
+  switch (typeGmsh) {
+  case 1:
+    m_numberSegments++;
+    break;
+  case 2:
+    m_numberTriangles++;
+    break;
+  case 3:
+    m_numberQuadrangles++;
+    break;
+  case 4:
+    m_numberTetrahedrons++;
+    break;
+  case 7:
+    m_numberPyramids++;
+    break;
+  case 15:
+    m_numberPoints++;
+    break;
+  case 5:
+    m_numberHexahedrons++;
+    break;
+  case 6:
+    m_numberPrisms++;
+    break;
+  default:
+    break;
+  }
+}
+
+//***********************************************************************
+
+// Binary mesh cache layout (native endianness):
+//   header   : "ECOGENMC" | version (int) | reader options (int) | hash of the mesh file (unsigned long long)
+//   nodes    : number of nodes (int) | coordinates (3 double per node)
+//   counters : number of elements, faces, communicating faces, inner nodes (int)
+//   elements : index, Gmsh type, physical and geometrical entities, CPU, number of other CPUs (6 int per element)
+//              | other CPUs (int) | nodes (int)
+//   faces    : number of nodes, left element, right element (-1 if none), boundary flag, communication flag (5 int per face)
+//              | nodes (int) | position, surface, normal, tangent, binormal (13 double per face)
+
+static const char meshCacheMagic[8] = {'E', 'C', 'O', 'G', 'E', 'N', 'M', 'C'};
+static const int meshCacheVersion(2);
+
+//***********************************************************************
+
+unsigned long long MeshUnStruct::hashFile(const std::string& file)
+{
+  std::ifstream fileStream(file.c_str(), std::ios::in | std::ios::binary);
+  if (!fileStream) {
+    throw ErrorMeshNS("mesh file not found : " + file, __FILE__, __LINE__);
+  }
+  unsigned long long hash(14695981039346656037ULL);
+  std::vector<char> buffer(1 << 20);
+  while (fileStream) {
+    fileStream.read(&buffer[0], buffer.size());
+    std::streamsize numberRead(fileStream.gcount());
+    for (std::streamsize i = 0; i < numberRead; i++) {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+//***********************************************************************
+
+bool MeshUnStruct::checkMeshCache() const
+{
+  std::ifstream fileStream((m_meshFile + ".cache").c_str(), std::ios::in | std::ios::binary);
+  if (!fileStream) return false;
+  char magic[8];
+  int version(0), readerOptions(0);
+  unsigned long long hash(0);
+  fileStream.read(magic, 8);
+  fileStream.read(reinterpret_cast<char*>(&version), sizeof(int));
+  fileStream.read(reinterpret_cast<char*>(&readerOptions), sizeof(int));
+  fileStream.read(reinterpret_cast<char*>(&hash), sizeof(unsigned long long));
+  if (!fileStream || std::memcmp(magic, meshCacheMagic, 8) != 0 || version != meshCacheVersion) return false;
+  if (readerOptions != this->getMeshCacheReaderOptions()) return false;
+  return hash == MeshUnStruct::hashFile(m_meshFile);
+}
+
+//***********************************************************************
+
+void MeshUnStruct::readMeshCache()
+{
+  if (rankCpu == 0) {
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << " C) READING MESH CACHE " + m_meshFile + ".cache IN PROGRESS ..." << std::endl;
+  }
+  clock_t tTemp(clock());
+  std::ifstream fileStream((m_meshFile + ".cache").c_str(), std::ios::in | std::ios::binary);
+  if (!fileStream) {
+    throw ErrorMeshNS("mesh cache not found : " + m_meshFile + ".cache", __FILE__, __LINE__);
+  }
+  fileStream.seekg(8 + 2 * sizeof(int) + sizeof(unsigned long long)); // Header already checked
+
+  // 1) Nodes
+  // --------
+  fileStream.read(reinterpret_cast<char*>(&m_numberNodes), sizeof(int));
+  std::vector<double> coordinates(3 * m_numberNodes);
+  fileStream.read(reinterpret_cast<char*>(coordinates.data()), coordinates.size() * sizeof(double));
+  m_nodes = new Coord[m_numberNodes];
+  for (int i = 0; i < m_numberNodes; i++) {
+    m_nodes[i].setXYZ(coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2]);
+  }
+
+  // 2) Elements
+  // -----------
+  int counters[4];
+  fileStream.read(reinterpret_cast<char*>(counters), 4 * sizeof(int));
+  m_numberElements      = counters[0];
+  m_numberFacesTotal    = counters[1];
+  m_numberFacesParallel = counters[2];
+  m_numberInnerNodes    = counters[3];
+  std::vector<int> elementsInfo(6 * m_numberElements);
+  fileStream.read(reinterpret_cast<char*>(elementsInfo.data()), elementsInfo.size() * sizeof(int));
+  int numberOtherCPUs(0);
+  for (int i = 0; i < m_numberElements; i++) {
+    numberOtherCPUs += elementsInfo[6 * i + 5];
+  }
+  std::vector<int> otherCPUs(numberOtherCPUs);
+  fileStream.read(reinterpret_cast<char*>(otherCPUs.data()), otherCPUs.size() * sizeof(int));
+  m_elements = new ElementNS*[m_numberElements];
+  m_numberElements0D = 0;
+  m_numberElements1D = 0;
+  m_numberElements2D = 0;
+  m_numberElements3D = 0;
+  std::vector<int> numNodes, tagsCPU;
+  std::vector<Coord> nodes;
+  int indexOtherCPU(0);
+  for (int i = 0; i < m_numberElements; i++) {
+    const int* info(&elementsInfo[6 * i]);
+    m_elements[i] = this->createElement(info[1]);
+    if (m_elements[i] == nullptr) throw ErrorMeshNS("mesh cache corrupted : " + m_meshFile + ".cache", __FILE__, __LINE__);
+    int numberNodes(m_elements[i]->getNumberNodes());
+    numNodes.resize(numberNodes);
+    nodes.resize(numberNodes);
+    fileStream.read(reinterpret_cast<char*>(numNodes.data()), numberNodes * sizeof(int));
+    for (int n = 0; n < numberNodes; n++) {
+      nodes[n] = m_nodes[numNodes[n]];
+    }
+    int indexElement(info[0]);
+    m_elements[i]->construitElement(numNodes.data(), nodes.data(), info[2], info[3], indexElement);
+    // Partition tags with the Gmsh convention
+    tagsCPU.assign(1, info[4] + 1);
+    for (int p = 0; p < info[5]; p++) {
+      tagsCPU.push_back(-otherCPUs[indexOtherCPU++] - 1);
+    }
+    m_elements[i]->setAppartenanceCPU(tagsCPU.data(), tagsCPU.size());
+    // Counting, ghost elements being those of other CPUs
+    if (Ncpu > 1 && m_elements[i]->getCPU() != rankCpu) {
+      m_numberGhostElements++;
+    }
+    else if (info[1] == 15) {
+      m_numberElements0D++;
+    }
+    else if (info[1] == 1) {
+      m_numberElements1D++;
+    }
+    else if (info[1] <= 3) {
+      m_numberElements2D++;
+      m_totalSurface += m_elements[i]->getVolume();
+    }
+    else {
+      m_numberElements3D++;
+      m_totalVolume += m_elements[i]->getVolume();
+    }
+  }
+  m_numberInnerElements = m_numberElements - m_numberGhostElements;
+
+  // 3) Faces
+  // --------
+  std::vector<int> facesInfo(5 * m_numberFacesTotal);
+  fileStream.read(reinterpret_cast<char*>(facesInfo.data()), facesInfo.size() * sizeof(int));
+  std::vector<double> facesGeometry(13 * m_numberFacesTotal);
+  m_faces = new FaceNS*[m_numberFacesTotal];
+  for (int i = 0; i < m_numberFacesTotal; i++) {
+    const int* info(&facesInfo[5 * i]);
+    numNodes.resize(info[0]);
+    fileStream.read(reinterpret_cast<char*>(numNodes.data()), info[0] * sizeof(int));
+    switch (info[0]) {
+    case 1: m_faces[i] = new FacePoint(numNodes[0]); break;
+    case 2: m_faces[i] = new FaceSegment(numNodes[0], numNodes[1], 0); break;
+    case 3: m_faces[i] = new FaceTriangle(numNodes[0], numNodes[1], numNodes[2], 0); break;
+    case 4: m_faces[i] = new FaceQuadrangle(numNodes[0], numNodes[1], numNodes[2], numNodes[3], 0); break;
+    default: throw ErrorMeshNS("mesh cache corrupted : " + m_meshFile + ".cache", __FILE__, __LINE__);
+    }
+  }
+  fileStream.read(reinterpret_cast<char*>(facesGeometry.data()), facesGeometry.size() * sizeof(double));
+  if (!fileStream) {
+    throw ErrorMeshNS("mesh cache corrupted : " + m_meshFile + ".cache", __FILE__, __LINE__);
+  }
+  for (int i = 0; i < m_numberFacesTotal; i++) {
+    const int* info(&facesInfo[5 * i]);
+    const double* g(&facesGeometry[13 * i]);
+    m_faces[i]->restoreFace(Coord(g[0], g[1], g[2]), g[3], Coord(g[4], g[5], g[6]), Coord(g[7], g[8], g[9]), Coord(g[10], g[11], g[12]),
+                            (info[1] < 0) ? nullptr : m_elements[info[1]], (info[2] < 0) ? nullptr : m_elements[info[2]], info[3] != 0,
+                            info[4] != 0);
+  }
+  fileStream.close();
+
+  if (rankCpu == 0) {
+    tTemp = clock() - tTemp;
+    std::cout << "    OK in " << static_cast<double>(tTemp) / CLOCKS_PER_SEC << " seconds" << std::endl;
+  }
+}
+
+//***********************************************************************
+
+void MeshUnStruct::writeMeshCache() const
+{
+  // Faces refer to elements by their position in m_elements, which must be their index
+  for (int i = 0; i < m_numberElements; i++) {
+    if (m_elements[i]->getIndex() != i) {
+      std::cout << "WARNING: mesh cache not written, element numbering of " << m_meshFile << " is not contiguous" << std::endl;
+      return;
+    }
+  }
+  std::ofstream fileStream((m_meshFile + ".cache").c_str(), std::ios::out | std::ios::binary);
+  if (!fileStream) {
+    std::cout << "WARNING: mesh cache not written, unable to open " << m_meshFile << ".cache" << std::endl;
+    return;
+  }
+
+  // Header and nodes
+  unsigned long long hash(MeshUnStruct::hashFile(m_meshFile));
+  const int readerOptions(this->getMeshCacheReaderOptions());
+  fileStream.write(meshCacheMagic, 8);
+  fileStream.write(reinterpret_cast<const char*>(&meshCacheVersion), sizeof(int));
+  fileStream.write(reinterpret_cast<const char*>(&readerOptions), sizeof(int));
+  fileStream.write(reinterpret_cast<const char*>(&hash), sizeof(unsigned long long));
+  fileStream.write(reinterpret_cast<const char*>(&m_numberNodes), sizeof(int));
+  std::vector<double> coordinates(3 * m_numberNodes);
+  for (int i = 0; i < m_numberNodes; i++) {
+    coordinates[3 * i]     = m_nodes[i].getX();
+    coordinates[3 * i + 1] = m_nodes[i].getY();
+    coordinates[3 * i + 2] = m_nodes[i].getZ();
+  }
+  fileStream.write(reinterpret_cast<const char*>(coordinates.data()), coordinates.size() * sizeof(double));
+  int counters[4] = {m_numberElements, m_numberFacesTotal, m_numberFacesParallel, m_numberInnerNodes};
+  fileStream.write(reinterpret_cast<const char*>(counters), 4 * sizeof(int));
+
+  // Elements
+  std::vector<int> elementsInfo(6 * m_numberElements), otherCPUs, numNodes;
+  for (int i = 0; i < m_numberElements; i++) {
+    elementsInfo[6 * i]     = m_elements[i]->getIndex();
+    elementsInfo[6 * i + 1] = m_elements[i]->getTypeGmsh();
+    elementsInfo[6 * i + 2] = m_elements[i]->getAppartenancePhysique();
+    elementsInfo[6 * i + 3] = m_elements[i]->getAppartenanceGeometrique();
+    elementsInfo[6 * i + 4] = m_elements[i]->getCPU();
+    elementsInfo[6 * i + 5] = m_elements[i]->getNumberOthersCPU();
+    for (int p = 0; p < m_elements[i]->getNumberOthersCPU(); p++) {
+      otherCPUs.push_back(m_elements[i]->getAutreCPU(p));
+    }
+    for (int n = 0; n < m_elements[i]->getNumberNodes(); n++) {
+      numNodes.push_back(m_elements[i]->getNumNode(n));
+    }
+  }
+  fileStream.write(reinterpret_cast<const char*>(elementsInfo.data()), elementsInfo.size() * sizeof(int));
+  fileStream.write(reinterpret_cast<const char*>(otherCPUs.data()), otherCPUs.size() * sizeof(int));
+  fileStream.write(reinterpret_cast<const char*>(numNodes.data()), numNodes.size() * sizeof(int));
+
+  // Faces
+  std::vector<int> facesInfo(5 * m_numberFacesTotal);
+  std::vector<double> facesGeometry(13 * m_numberFacesTotal);
+  numNodes.clear();
+  for (int i = 0; i < m_numberFacesTotal; i++) {
+    const FaceNS* face(m_faces[i]);
+    facesInfo[5 * i]     = face->getNumberNodes();
+    facesInfo[5 * i + 1] = (face->getElementGauche() == nullptr) ? -1 : face->getElementGauche()->getIndex();
+    facesInfo[5 * i + 2] = (face->getElementDroite() == nullptr) ? -1 : face->getElementDroite()->getIndex();
+    facesInfo[5 * i + 3] = face->getEstLimite();
+    facesInfo[5 * i + 4] = face->getEstComm();
+    for (int n = 0; n < face->getNumberNodes(); n++) {
+      numNodes.push_back(face->getNumNode(n));
+    }
+    const double geometry[13] = {face->getPos().getX(),      face->getPos().getY(),      face->getPos().getZ(),     face->getSurface(),
+                                 face->getNormal().getX(),   face->getNormal().getY(),   face->getNormal().getZ(),  face->getTangent().getX(),
+                                 face->getTangent().getY(),  face->getTangent().getZ(),  face->getBinormal().getX(), face->getBinormal().getY(),
+                                 face->getBinormal().getZ()};
+    std::copy(geometry, geometry + 13, facesGeometry.begin() + 13 * i);
+  }
+  fileStream.write(reinterpret_cast<const char*>(facesInfo.data()), facesInfo.size() * sizeof(int));
+  fileStream.write(reinterpret_cast<const char*>(numNodes.data()), numNodes.size() * sizeof(int));
+  fileStream.write(reinterpret_cast<const char*>(facesGeometry.data()), facesGeometry.size() * sizeof(double));
+  fileStream.close();
+}
+
+//***********************************************************************
+
 void MeshUnStruct::writeMeshInfoData() const
 {
   std::cout << "  --------------------------" << std::endl;
@@ -206,6 +630,9 @@ void MeshUnStruct::writeMeshInfoData() const
     if (m_numberPyramids != 0) {
       std::cout << "      - number of pyramids: " << m_numberPyramids << std::endl;
     }
+    if (m_numberPrisms != 0) {
+      std::cout << "      - number of prisms: " << m_numberPrisms << std::endl;
+    }
     if (m_numberHexahedrons != 0) {
       std::cout << "      - number of hexahedrons: " << m_numberHexahedrons << std::endl;
     }
@@ -231,7 +658,7 @@ void MeshUnStruct::writeMeshInfoData() const
 //******************************** WRITING *********************************
 //**************************************************************************
 
-void MeshUnStruct::writeHeaderPiece(std::ofstream& fileStream, TypeMeshContainer<Cell*>* /*cellsLvl*/) const
+void MeshUnStruct::writeHeaderPiece(std::ostream& fileStream, TypeMeshContainer<Cell*>* /*cellsLvl*/) const
 {
   fileStream << "    <Piece NumberOfPoints=\"" << m_numberNodes << "\" NumberOfCells=\"" << m_numberCellsCalcul - m_numberGhostCells << "\">"
              << std::endl;
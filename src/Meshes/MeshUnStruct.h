@@ -76,10 +76,42 @@ class MeshUnStruct : public Mesh
     void initCpuMeshSequential(TypeMeshContainer<Cell*>& cells, std::string& computeOrder) override        = 0;
     void initCpuMeshParallel(TypeMeshContainer<Cell*>& cells, std::string& computeOrder, int cpu) override = 0;
 
+    //! \brief     Renumber cells, ghost cells and cell interfaces along a space-filling curve
+    //! \details   Cells (and ghost cells) are sorted following the Morton (z-order) key of their element center, cell interfaces
+    //!            are then sorted by their neighboring cell indices. Geometrical elements keep their original order so that
+    //!            outputs still follow the mesh file element numbering. Parallel send/receive lists store cell pointers and
+    //!            therefore remain consistent between CPUs.
+    //! \param     cells            vector of computational cells
+    //! \param     cellsGhost       vector of ghost cells (parallel computation)
+    //! \param     cellInterfaces   vector of cell interfaces
+    void renumberCellsAndCellInterfaces(TypeMeshContainer<Cell*>& cells,
+                                        TypeMeshContainer<Cell*>& cellsGhost,
+                                        TypeMeshContainer<CellInterface*>& cellInterfaces);
+    void setRenumbering(const bool& renumbering) { m_renumbering = renumbering; };
+    void setPartitioner(const std::string& partitioner) { m_partitioner = partitioner; };
+    void setComputationalCosts(const double& faceCost, const double& cellCost) override
+    {
+      m_faceCost = faceCost;
+      m_cellCost = cellCost;
+    };
+
+    // Binary mesh cache
+    //! \brief     Check if a binary mesh cache matching the current mesh file (same content hash, cache version and reader options) exists
+    bool checkMeshCache() const;
+    //! \brief     Reader options changing the data stored in the binary mesh cache, as bit flags (none by default)
+    virtual int getMeshCacheReaderOptions() const { return 0; };
+    //! \brief     Read nodes, elements and built faces from the binary mesh cache in place of mesh file parsing and faces building
+    void readMeshCache();
+    //! \brief     Write nodes, elements and built faces in a binary mesh cache (file m_meshFile + ".cache") for next runs
+    void writeMeshCache() const;
+    void setMeshCache(const bool& meshCache) { m_meshCache = meshCache; };
+    //! \brief     64 bits FNV-1a hash of the content of a file
+    static unsigned long long hashFile(const std::string& file);
+
     // Printing / Reading
     //! \brief    write monocpu mesh information
     void writeMeshInfoData() const;
-    void writeHeaderPiece(std::ofstream& fileStream, TypeMeshContainer<Cell*>* /*cellsLvl*/) const override;
+    void writeHeaderPiece(std::ostream& fileStream, TypeMeshContainer<Cell*>* /*cellsLvl*/) const override;
     void getNodes(std::vector<double>& dataset, std::vector<Cell*>* /*cellsLvl*/) const override;
     void getConnectivity(std::vector<double>& dataset, std::vector<Cell*>* /*cellsLvl*/) const override;
     void getOffsets(std::vector<double>& dataset, std::vector<Cell*>* /*cellsLvl*/) const override;
@@ -90,6 +122,14 @@ class MeshUnStruct : public Mesh
     void extractReferenceLength(std::vector<Cell*>* cellsLvl, std::vector<double>& dataset) const override;
 
   protected:
+    //! \brief     Allocate an element of the given Gmsh type and update element type counters
+    ElementNS* createElement(const int& typeGmsh);
+    //! \brief     Allocate an element of the given Gmsh type without updating the counters (safe for concurrent threads)
+    //! \return    nullptr if the type is not handled
+    static ElementNS* allocateElement(const int& typeGmsh);
+    //! \brief     Update element type counters for an element of the given Gmsh type
+    void countElement(const int& typeGmsh);
+
     std::string m_meshFile; //!< Name of the mesh file read
     std::string m_nameMesh; //!< Name of the mesh file without extension
 
@@ -102,6 +142,11 @@ class MeshUnStruct : public Mesh
     ElementNS** m_elements;            //!< Array of internal geometric elements
     FaceNS** m_faces;                  //!< Array of geometrical faces
     std::vector<BoundCond*> m_bound;   //!< Array of boundary conditions
+    bool m_renumbering;                //!< Space-filling-curve renumbering of cells and cell interfaces after geometry building
+    std::string m_partitioner;         //!< Partitioner of the parallel pre-treatment: "GMSH" (partition tags of the mesh file) or "SFC" (built-in)
+    double m_faceCost;                 //!< Relative cost of a face for the weights of the built-in partitioner
+    double m_cellCost;                 //!< Relative cost of a cell, apart from its faces, for the weights of the built-in partitioner
+    bool m_meshCache;                  //!< Use (read or write) the binary mesh cache
 
     int m_numberInnerFaces;    //!< Number of faces between two cells of compute
     int m_numberBoundFaces;    //!< Number of faces between a compute cell and a boundary
@@ -118,6 +163,7 @@ class MeshUnStruct : public Mesh
     int m_numberQuadrangles;
     int m_numberTetrahedrons;
     int m_numberPyramids;
+    int m_numberPrisms;
     int m_numberPoints;
     int m_numberHexahedrons;
 
@@ -0,0 +1,349 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#include "AsciiMeshReader.h"
+#include "../../../Errors.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <thread>
+
+// Maximal length of a number in the mesh file (kept contiguous in the buffer for parsing)
+static const std::size_t maxNumberLength(128);
+// Exact powers of ten in double precision
+static const double powersOfTen[23] = {1.e0,  1.e1,  1.e2,  1.e3,  1.e4,  1.e5,  1.e6,  1.e7,  1.e8,  1.e9,  1.e10, 1.e11,
+                                       1.e12, 1.e13, 1.e14, 1.e15, 1.e16, 1.e17, 1.e18, 1.e19, 1.e20, 1.e21, 1.e22};
+// Minimal number of records per thread for parseLines to split a section (thread start-up is not worth it below)
+static const int minimalRecordsPerThread(1 << 14);
+// Number of records loaded per thread at each batch of parseLines (about 15 MB of text per thread for tetrahedrons)
+static const int batchRecordsPerThread(1 << 18);
+
+//***********************************************************************
+
+AsciiMeshReader::AsciiMeshReader(const std::string& file, const std::size_t& blockSize) :
+  m_file(file),
+  m_fileStream(file.c_str(), std::ios::in | std::ios::binary),
+  m_buffer(blockSize + 1),
+  m_data(&m_buffer[0]),
+  m_blockSize(blockSize),
+  m_position(0),
+  m_size(0),
+  m_isOpen(false),
+  m_fileEnded(false),
+  m_eof(false)
+{
+  m_isOpen    = static_cast<bool>(m_fileStream);
+  m_fileEnded = !m_isOpen;
+  m_buffer[0] = '\0';
+}
+
+//***********************************************************************
+
+AsciiMeshReader::AsciiMeshReader(const std::string& file, const char* begin, const char* end) :
+  m_file(file),
+  m_data(begin),
+  m_blockSize(0),
+  m_position(0),
+  m_size(static_cast<std::size_t>(end - begin)),
+  m_isOpen(true),
+  m_fileEnded(true),
+  m_eof(false)
+{}
+
+//***********************************************************************
+
+AsciiMeshReader::~AsciiMeshReader() {}
+
+//***********************************************************************
+
+bool AsciiMeshReader::fill(const std::size_t& numberCharacters)
+{
+  if (m_size - m_position >= numberCharacters || m_fileEnded) return m_position < m_size;
+  // Keep remaining characters at the beginning of the buffer then read the following block
+  std::size_t remaining(m_size - m_position);
+  std::memmove(&m_buffer[0], &m_data[m_position], remaining);
+  m_position = 0;
+  m_fileStream.read(&m_buffer[remaining], m_blockSize - remaining);
+  m_size = remaining + static_cast<std::size_t>(m_fileStream.gcount());
+  if (!m_fileStream) m_fileEnded = true;
+  m_buffer[m_size] = '\0';
+  return m_position < m_size;
+}
+
+//***********************************************************************
+
+bool AsciiMeshReader::skipWhiteSpaces()
+{
+  while (true) {
+    if (m_position == m_size && !this->fill(1)) {
+      m_eof = true;
+      return false;
+    }
+    char c(m_data[m_position]);
+    if (c != ' ' && c != '\n' && c != '\r' && c != '\t' && c != '\v' && c != '\f') return true;
+    m_position++;
+  }
+}
+
+//***********************************************************************
+
+void AsciiMeshReader::throwEndOfFile() const { throw ErrorMeshNS("unexpected end of mesh file : " + m_file, __FILE__, __LINE__); }
+
+//***********************************************************************
+
+AsciiMeshReader& AsciiMeshReader::operator>>(std::string& token)
+{
+  if (!this->skipWhiteSpaces()) return *this;
+  token.clear();
+  while (true) {
+    if (m_position == m_size && !this->fill(1)) {
+      m_eof = true;
+      return *this;
+    }
+    char c(m_data[m_position]);
+    if (c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f') return *this;
+    token += c;
+    m_position++;
+  }
+}
+
+//***********************************************************************
+
+AsciiMeshReader& AsciiMeshReader::operator>>(int& value)
+{
+  if (!this->skipWhiteSpaces()) this->throwEndOfFile();
+  this->fill(maxNumberLength);
+  const char* c(&m_data[m_position]);
+  bool negative(*c == '-');
+  if (*c == '-' || *c == '+') c++;
+  if (*c < '0' || *c > '9') throw ErrorMeshNS("invalid integer in mesh file : " + m_file, __FILE__, __LINE__);
+  long long result(0);
+  while (*c >= '0' && *c <= '9') {
+    result = 10 * result + (*c - '0');
+    c++;
+  }
+  value      = static_cast<int>(negative ? -result : result);
+  m_position = static_cast<std::size_t>(c - m_data);
+  if (m_position == m_size && m_fileEnded) m_eof = true;
+  return *this;
+}
+
+//***********************************************************************
+
+AsciiMeshReader& AsciiMeshReader::operator>>(double& value)
+{
+  if (!this->skipWhiteSpaces()) this->throwEndOfFile();
+  this->fill(maxNumberLength);
+  const char* start(&m_data[m_position]);
+  const char* c(start);
+
+  // Fast path: mantissa exactly representable (<= 2^53) and exponent within exact powers of ten give a correctly rounded result
+  bool negative(*c == '-');
+  if (*c == '-' || *c == '+') c++;
+  unsigned long long mantissa(0);
+  int numberDigits(0), exponent(0);
+  bool isDigit(false);
+  while (*c >= '0' && *c <= '9') {
+    if (mantissa != 0 || *c != '0') numberDigits++;
+    mantissa = 10 * mantissa + (*c - '0');
+    isDigit  = true;
+    c++;
+    if (numberDigits > 19) break;
+  }
+  if (*c == '.' && numberDigits <= 19) {
+    c++;
+    while (*c >= '0' && *c <= '9') {
+      if (mantissa != 0 || *c != '0') numberDigits++;
+      mantissa = 10 * mantissa + (*c - '0');
+      exponent--;
+      isDigit = true;
+      c++;
+      if (numberDigits > 19) break;
+    }
+  }
+  if ((*c == 'e' || *c == 'E') && isDigit && numberDigits <= 19) {
+    const char* e(c + 1);
+    bool negativeExponent(*e == '-');
+    if (*e == '-' || *e == '+') e++;
+    if (*e >= '0' && *e <= '9') {
+      int exponentRead(0);
+      while (*e >= '0' && *e <= '9' && exponentRead < 10000) {
+        exponentRead = 10 * exponentRead + (*e - '0');
+        e++;
+      }
+      exponent += negativeExponent ? -exponentRead : exponentRead;
+      c = e;
+    }
+  }
+  bool endOfNumber(*c == '\0' || *c == ' ' || *c == '\n' || *c == '\r' || *c == '\t' || *c == '\v' || *c == '\f');
+  if (isDigit && numberDigits <= 19 && mantissa <= (1ULL << 53) && endOfNumber && exponent >= -22 && exponent <= 22) {
+    double result(static_cast<double>(mantissa));
+    result = (exponent < 0) ? result / powersOfTen[-exponent] : result * powersOfTen[exponent];
+    value  = negative ? -result : result;
+  }
+  // General case
+  else {
+    char* end(nullptr);
+    value = std::strtod(start, &end);
+    if (end == start) throw ErrorMeshNS("invalid real number in mesh file : " + m_file, __FILE__, __LINE__);
+    c = end;
+  }
+  m_position = static_cast<std::size_t>(c - m_data);
+  if (m_position == m_size && m_fileEnded) m_eof = true;
+  return *this;
+}
+
+//***********************************************************************
+
+void AsciiMeshReader::ignore(const int& numberCharacters, const char& delimiter)
+{
+  for (int i = 0; i < numberCharacters; i++) {
+    if (m_position == m_size && !this->fill(1)) {
+      m_eof = true;
+      return;
+    }
+    if (m_data[m_position++] == delimiter) return;
+  }
+}
+
+//***********************************************************************
+
+void AsciiMeshReader::getline(std::string& line)
+{
+  line.clear();
+  while (true) {
+    if (m_position == m_size && !this->fill(1)) {
+      m_eof = true;
+      return;
+    }
+    char c(m_data[m_position++]);
+    if (c == '\n') return;
+    line += c;
+  }
+}
+
+//***********************************************************************
+
+bool AsciiMeshReader::readLine(std::vector<char>& text)
+{
+  if (!this->skipWhiteSpaces()) return false;
+  while (true) {
+    const char* begin(&m_data[m_position]);
+    const char* endOfLine(static_cast<const char*>(std::memchr(begin, '\n', m_size - m_position)));
+    if (endOfLine != nullptr) {
+      text.insert(text.end(), begin, endOfLine + 1);
+      m_position = static_cast<std::size_t>(endOfLine + 1 - m_data);
+      return true;
+    }
+    text.insert(text.end(), begin, m_data + m_size);
+    m_position = m_size;
+    if (!this->fill(1)) { // Last line of the file without end of line character
+      text.push_back('\n');
+      m_eof = true;
+      return true;
+    }
+  }
+}
+
+//***********************************************************************
+
+void AsciiMeshReader::parseLines(const int& numberLines,
+                                 const int& numberThreads,
+                                 const std::function<void(AsciiMeshReader&, const int&, const int&)>& parseRecords)
+{
+  int numberChunks(std::min(numberThreads, numberLines / minimalRecordsPerThread));
+  if (numberChunks <= 1) {
+    parseRecords(*this, 0, numberLines);
+    return;
+  }
+
+  std::vector<char> text;
+  std::vector<std::size_t> chunkBegin(numberChunks + 1);
+  std::vector<int> chunkFirstRecord(numberChunks + 1);
+  std::vector<std::exception_ptr> errors(numberChunks);
+  // Parsing of a chunk, exceptions are kept to be rethrown by the calling thread
+  auto parseChunk = [&](const int& c) {
+    try {
+      AsciiMeshReader chunk(m_file, &text[chunkBegin[c]], &text[chunkBegin[c + 1]]);
+      parseRecords(chunk, chunkFirstRecord[c], chunkFirstRecord[c + 1] - chunkFirstRecord[c]);
+      if (chunk.skipWhiteSpaces()) {
+        throw ErrorMeshNS("mesh file format is not compatible (one record per line expected), see mesh file: " + m_file, __FILE__,
+                          __LINE__);
+      }
+    }
+    catch (...) {
+      errors[c] = std::current_exception();
+    }
+  };
+
+  int recordsPerBatch(numberChunks * batchRecordsPerThread);
+  for (int firstRecord = 0; firstRecord < numberLines; firstRecord += recordsPerBatch) {
+    int numberRecords(std::min(recordsPerBatch, numberLines - firstRecord));
+    // 1) Loading the lines of the batch and cutting them in one chunk per thread
+    text.clear();
+    for (int c = 0; c <= numberChunks; c++) {
+      chunkFirstRecord[c] = firstRecord + static_cast<int>(static_cast<long long>(numberRecords) * c / numberChunks);
+    }
+    for (int c = 0; c < numberChunks; c++) {
+      chunkBegin[c] = text.size();
+      for (int record = chunkFirstRecord[c]; record < chunkFirstRecord[c + 1]; record++) {
+        if (!this->readLine(text)) this->throwEndOfFile();
+      }
+    }
+    chunkBegin[numberChunks] = text.size();
+    text.push_back('\0');
+
+    // 2) Parsing the chunks, the first one by the calling thread
+    std::vector<std::thread> threads;
+    for (int c = 1; c < numberChunks; c++) {
+      threads.push_back(std::thread(parseChunk, c));
+    }
+    parseChunk(0);
+    for (unsigned int t = 0; t < threads.size(); t++) {
+      threads[t].join();
+    }
+    for (int c = 0; c < numberChunks; c++) {
+      if (errors[c]) std::rethrow_exception(errors[c]);
+    }
+  }
+}
+
+//***********************************************************************
+
+void AsciiMeshReader::close()
+{
+  m_fileStream.close();
+  m_position  = 0;
+  m_size      = 0;
+  m_fileEnded = true;
+}
+
+//***********************************************************************
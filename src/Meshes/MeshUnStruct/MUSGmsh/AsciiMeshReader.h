@@ -0,0 +1,104 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef ASCIIMESHREADER_H
+#define ASCIIMESHREADER_H
+
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+//! \class     AsciiMeshReader
+//! \brief     Buffered reader of ASCII mesh files
+//! \details   Replaces formatted extraction of std::ifstream (operator >>) which is slow on large mesh files: the file is read
+//!            by large blocks and numbers are parsed by hand. Doubles fall back on strtod when the fast exact conversion is not
+//!            possible, so that values are the same as with std::ifstream. Unexpected end of file or invalid numbers throw
+//!            ErrorMeshNS instead of silently setting the stream in fail state. Large sections of one record per line can be
+//!            parsed by several threads (see parseLines).
+class AsciiMeshReader
+{
+  public:
+    AsciiMeshReader(const std::string& file, const std::size_t& blockSize = 1 << 24);
+    //! \brief     Reader of characters already loaded in memory (chunk of a section parsed by parseLines)
+    //! \param     file    name of the mesh file (error messages)
+    //! \param     begin   first character
+    //! \param     end     past the last character, which must be a white space or a null character
+    AsciiMeshReader(const std::string& file, const char* begin, const char* end);
+    ~AsciiMeshReader();
+
+    AsciiMeshReader& operator>>(std::string& token);
+    AsciiMeshReader& operator>>(int& value);
+    AsciiMeshReader& operator>>(double& value);
+
+    //! \brief     Skip characters until numberCharacters are skipped or delimiter is found (and skipped)
+    void ignore(const int& numberCharacters, const char& delimiter);
+    //! \brief     Read characters until end of line (end of line character is skipped, not stored)
+    void getline(std::string& line);
+    //! \brief     Parse the next numberLines records, one record per line, with up to numberThreads threads
+    //! \details   Lines are loaded by batches, each batch being cut into contiguous chunks of records, one per thread.
+    //!            parseRecords(chunk, firstRecord, numberRecords) is called on each chunk with a reader limited to it, records
+    //!            being numbered from 0 at the beginning of the section. When the section is too small to be split,
+    //!            parseRecords(*this, 0, numberLines) is called directly. The exception raised by the first faulty chunk is
+    //!            rethrown once all threads are over, as well as a chunk holding more records than lines.
+    void parseLines(const int& numberLines,
+                    const int& numberThreads,
+                    const std::function<void(AsciiMeshReader&, const int&, const int&)>& parseRecords);
+    void close();
+
+    bool operator!() const { return !m_isOpen; };
+    //! \brief     True once an extraction reached the end of the file (same meaning as std::ifstream::eof())
+    bool eof() const { return m_eof; };
+
+  private:
+    //! \brief     Make numberCharacters contiguous characters available in the buffer (less at end of file)
+    //! \return    true if at least one character is available
+    bool fill(const std::size_t& numberCharacters);
+    //! \brief     Skip white spaces
+    //! \return    false if end of file is reached
+    bool skipWhiteSpaces();
+    void throwEndOfFile() const;
+    //! \brief     Append the next non blank line (end of line character included) to text
+    //! \return    false if end of file is reached before a non blank line
+    bool readLine(std::vector<char>& text);
+
+    std::string m_file;
+    std::ifstream m_fileStream;
+    std::vector<char> m_buffer; //!< Block of the file being parsed (null terminated)
+    const char* m_data;         //!< Characters being parsed (m_buffer, or memory given at construction)
+    std::size_t m_blockSize;
+    std::size_t m_position; //!< Current position in the buffer
+    std::size_t m_size;     //!< Number of valid characters in the buffer
+    bool m_isOpen;
+    bool m_fileEnded; //!< The whole file has been loaded in the buffer
+    bool m_eof;
+};
+
+#endif // ASCIIMESHREADER_H
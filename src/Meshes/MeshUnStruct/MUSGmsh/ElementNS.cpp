@@ -43,6 +43,8 @@ ElementNS::ElementNS(const int& typeGmsh, const int& numberNodes, const int& num
   m_numberFaces(numberFaces),
   m_isFantome(false),
   m_isCommunicant(false),
+  m_CPU(0),
+  m_numberOtherCPU(0),
   m_otherCPU(0)
 {
   m_numNodes = new int[numberNodes];
@@ -133,6 +135,7 @@ void ElementNS::setAppartenanceCPU(const int* numCPU, const int& numberCPU)
 {
   m_CPU            = numCPU[0] - 1;
   m_numberOtherCPU = numberCPU - 1;
+  if (m_otherCPU != 0) delete[] m_otherCPU; // Ownership may be reassigned by the built-in partitioner
   m_otherCPU       = new int[m_numberOtherCPU];
   for (int i = 1; i < numberCPU; i++) {
     m_otherCPU[i - 1] = -numCPU[i] - 1;
@@ -129,6 +129,29 @@ void FaceNS::addElementNeighborLimite(ElementNS* elementNeighbor)
 
 //***********************************************************************
 
+void FaceNS::restoreFace(const Coord& position,
+                         const double& surface,
+                         const Coord& normal,
+                         const Coord& tangent,
+                         const Coord& binormal,
+                         ElementNS* elementGauche,
+                         ElementNS* elementDroite,
+                         const bool& limite,
+                         const bool& comm)
+{
+  m_position      = position;
+  m_surface       = surface;
+  m_normal        = normal;
+  m_tangent       = tangent;
+  m_binormal      = binormal;
+  m_elementGauche = elementGauche;
+  m_elementDroite = elementDroite;
+  m_limite        = limite;
+  m_comm          = comm;
+}
+
+//***********************************************************************
+
 void FaceNS::setEstLimite(const bool& estLimite) { m_limite = estLimite; }
 
 //***********************************************************************
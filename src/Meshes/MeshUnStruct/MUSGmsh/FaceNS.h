@@ -47,6 +47,16 @@ class FaceNS : public Face
     bool faceExists(FaceNS** faces, const int& indexMaxFaces, int& indexFaceExiste);
     void addElementNeighbor(ElementNS* elementNeighbor);
     void addElementNeighborLimite(ElementNS* elementNeighbor);
+    //! \brief     Restore a face read from the binary mesh cache (geometry and neighbors are not recomputed)
+    void restoreFace(const Coord& position,
+                     const double& surface,
+                     const Coord& normal,
+                     const Coord& tangent,
+                     const Coord& binormal,
+                     ElementNS* elementGauche,
+                     ElementNS* elementDroite,
+                     const bool& limite,
+                     const bool& comm);
 
     //Accesseurs
     ElementNS* getElementGauche() const;
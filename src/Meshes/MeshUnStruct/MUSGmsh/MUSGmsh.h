@@ -34,6 +34,7 @@
 #include <sstream>
 #include "../../MeshUnStruct.h"
 #include "HeaderElements.h"
+#include "AsciiMeshReader.h"
 
 class MUSGmsh : public MeshUnStruct
 {
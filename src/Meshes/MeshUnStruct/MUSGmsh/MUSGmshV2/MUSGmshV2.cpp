@@ -29,6 +29,8 @@
 //  If not, see <http://www.gnu.org/licenses/>.
 
 #include "MUSGmshV2.h"
+#include <algorithm>
+#include <thread>
 
 //***********************************************************************
 
@@ -52,10 +54,22 @@ MUSGmshV2::~MUSGmshV2()
 void MUSGmshV2::initGeometryMonoCPU(TypeMeshContainer<Cell*>& cells, TypeMeshContainer<CellInterface*>& cellInterfaces, std::string computeOrder)
 {
   try {
-    // 1) Reading nodes and elements
-    // -----------------------------
+    // 1) Reading nodes and elements (and faces if the binary mesh cache is up to date)
+    // --------------------------------------------------------------------------------
     std::vector<ElementNS*>* neighborNodes; // Size number of nodes
-    this->readMeshMonoCPU(&neighborNodes);  // Fill m_nodes and m_elements
+    bool cacheRead(m_meshCache && this->checkMeshCache());
+    if (cacheRead) {
+      this->readMeshCache(); // Fill m_nodes, m_elements and m_faces
+      neighborNodes = new std::vector<ElementNS*>[m_numberNodes];
+      for (int i = 0; i < m_numberElements; i++) {
+        for (int n = 0; n < m_elements[i]->getNumberNodes(); n++) {
+          neighborNodes[m_elements[i]->getNumNode(n)].push_back(m_elements[i]);
+        }
+      }
+    }
+    else {
+      this->readMeshMonoCPU(&neighborNodes); // Fill m_nodes and m_elements
+    }
 
     // CAUTION: Ordering of m_elements is important. Faces first, then cells.
 
@@ -154,69 +168,73 @@ void MUSGmshV2::initGeometryMonoCPU(TypeMeshContainer<Cell*>& cells, TypeMeshCon
     }
     std::cout << "Total volume : " << volTot << std::endl;
 
-    // 3) Building connectivity table
-    // -------------------------------
-    // Sizing faces array
-    m_faces = new FaceNS*[m_numberFacesTotal];
-    int** facesBuff;
-    int* sumNodesBuff; // We build a temporary array of faces to speed up the search process
-    facesBuff    = new int*[m_numberFacesTotal + 1];
-    sumNodesBuff = new int[m_numberFacesTotal + 1];
-    // Determination of the maximum number of nodes for the faces
-    int sizeFace(1); // Will be initialize at maximale size
-    if (m_numberElements3D != 0) {
-      if (m_numberQuadrangles != 0) {
-        sizeFace = 4;
-      }
-      else if (m_numberTriangles != 0) {
-        sizeFace = 3;
+    // 3) Building connectivity table (already built if read from the binary mesh cache)
+    // ---------------------------------------------------------------------------------
+    clock_t tTemp(clock());
+    double t1(0.);
+    if (!cacheRead) {
+      // Sizing faces array
+      m_faces = new FaceNS*[m_numberFacesTotal];
+      int** facesBuff;
+      int* sumNodesBuff; // We build a temporary array of faces to speed up the search process
+      facesBuff    = new int*[m_numberFacesTotal + 1];
+      sumNodesBuff = new int[m_numberFacesTotal + 1];
+      // Determination of the maximum number of nodes for the faces
+      int sizeFace(1); // Will be initialize at maximale size
+      if (m_numberElements3D != 0) {
+        if (m_numberQuadrangles != 0) {
+          sizeFace = 4;
+        }
+        else if (m_numberTriangles != 0) {
+          sizeFace = 3;
+        }
+        else {
+          Errors::errorMessage("Issue in initGeometryMonoCPU for initialization of facesBuff array");
+        }
       }
-      else {
-        Errors::errorMessage("Issue in initGeometryMonoCPU for initialization of facesBuff array");
+      else if (m_numberElements2D != 0) {
+        sizeFace = 2;
+      }
+      for (int i = 0; i < m_numberFacesTotal + 1; i++) {
+        facesBuff[i] = new int[sizeFace];
       }
-    }
-    else if (m_numberElements2D != 0) {
-      sizeFace = 2;
-    }
-    for (int i = 0; i < m_numberFacesTotal + 1; i++) {
-      facesBuff[i] = new int[sizeFace];
-    }
 
-    // Inner faces
-    int indexMaxFaces(0);
-    clock_t tTemp(clock());
-    double t1(0.);
-    std::cout << "  1/Building faces ..." << std::endl;
-    int printFrequency(std::max((m_numberElements - m_numberBoundFaces) / 10, 1));
-    for (int i = m_numberBoundFaces; i < m_numberElements; i++) {
-      if ((i - m_numberBoundFaces) % printFrequency == 0) {
-        std::cout << "    " << (100 * (i - m_numberBoundFaces) / (m_numberElements - m_numberBoundFaces)) << "% ... " << std::endl;
+      // Inner faces
+      int indexMaxFaces(0);
+      tTemp = clock();
+      std::cout << "  1/Building faces ..." << std::endl;
+      int printFrequency(std::max((m_numberElements - m_numberBoundFaces) / 10, 1));
+      for (int i = m_numberBoundFaces; i < m_numberElements; i++) {
+        if ((i - m_numberBoundFaces) % printFrequency == 0) {
+          std::cout << "    " << (100 * (i - m_numberBoundFaces) / (m_numberElements - m_numberBoundFaces)) << "% ... " << std::endl;
+        }
+        m_elements[i]->construitFaces(m_nodes, m_faces, indexMaxFaces, facesBuff, sumNodesBuff);
       }
-      m_elements[i]->construitFaces(m_nodes, m_faces, indexMaxFaces, facesBuff, sumNodesBuff);
-    }
-    for (int i = 0; i < m_numberFacesTotal + 1; i++) {
-      delete[] facesBuff[i];
-    }
-    delete[] facesBuff;
-    delete[] sumNodesBuff;
-    tTemp = clock() - tTemp;
-    t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
-    std::cout << "    OK in " << t1 << " seconds" << std::endl;
+      for (int i = 0; i < m_numberFacesTotal + 1; i++) {
+        delete[] facesBuff[i];
+      }
+      delete[] facesBuff;
+      delete[] sumNodesBuff;
+      tTemp = clock() - tTemp;
+      t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
+      std::cout << "    OK in " << t1 << " seconds" << std::endl;
 
-    // Boundaries
-    std::cout << "  2/Boundary elements attribution to boundary faces ..." << std::endl;
-    tTemp          = clock();
-    printFrequency = std::max(m_numberBoundFaces / 10, 1);
-    for (int i = 0; i < m_numberBoundFaces; i++) {
-      if (i % printFrequency == 0) {
-        std::cout << "    " << (100 * i / m_numberBoundFaces) << "% ... " << std::endl;
+      // Boundaries
+      std::cout << "  2/Boundary elements attribution to boundary faces ..." << std::endl;
+      tTemp          = clock();
+      printFrequency = std::max(m_numberBoundFaces / 10, 1);
+      for (int i = 0; i < m_numberBoundFaces; i++) {
+        if (i % printFrequency == 0) {
+          std::cout << "    " << (100 * i / m_numberBoundFaces) << "% ... " << std::endl;
+        }
+        // Assigning the boundary
+        m_elements[i]->attributFaceLimite(m_faces, indexMaxFaces);
       }
-      // Assigning the boundary
-      m_elements[i]->attributFaceLimite(m_faces, indexMaxFaces);
+      tTemp = clock() - tTemp;
+      t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
+      std::cout << "    OK in " << t1 << " seconds" << std::endl;
+      if (m_meshCache) this->writeMeshCache();
     }
-    tTemp = clock() - tTemp;
-    t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
-    std::cout << "    OK in " << t1 << " seconds" << std::endl;
 
     // Link Geometry/cellInterfaces of compute
     std::cout << "  3/Linking Geometries -> Physics ..." << std::endl;
@@ -276,11 +294,13 @@ void MUSGmshV2::readMeshMonoCPU(std::vector<ElementNS*>** neighborNodes)
     // --------------------------------------
     std::cout << "------------------------------------------------------" << std::endl;
     std::cout << " C) READING MESH FILE " + m_meshFile + " IN PROGRESS ..." << std::endl;
-    std::ifstream meshFile(m_meshFile.c_str(), std::ios::in);
+    AsciiMeshReader meshFile(m_meshFile);
     if (!meshFile) {
       throw ErrorMeshNS("mesh file not found : " + m_meshFile, __FILE__, __LINE__);
     }
     std::string currentLine;
+    // Sections of the global mesh file are parsed by all the threads available
+    int numberThreads(std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
 
     // Skiping Gmsh version + go to nodes
     // -----------------------------------
@@ -298,12 +318,7 @@ void MUSGmshV2::readMeshMonoCPU(std::vector<ElementNS*>** neighborNodes)
     meshFile >> m_numberNodes;
     m_nodes        = new Coord[m_numberNodes];
     *neighborNodes = new std::vector<ElementNS*>[m_numberNodes];
-    int useless(0);
-    double x, y, z;
-    for (int i = 0; i < m_numberNodes; i++) {
-      meshFile >> useless >> x >> y >> z;
-      m_nodes[i].setXYZ(x, y, z);
-    }
+    this->readNodes(meshFile, m_nodes, m_numberNodes, numberThreads);
     // Skip keyword $EndNodes $Elements and others if necessary
     currentLine = "";
     while (currentLine != "$Elements") {
@@ -325,9 +340,9 @@ void MUSGmshV2::readMeshMonoCPU(std::vector<ElementNS*>** neighborNodes)
     m_numberElements2D = 0;
     m_numberElements3D = 0;
     //int posBeginElement = static_cast<int>(meshFile.tellg()); // id of the position of elements in file for quick return
+    this->readElements(m_nodes, meshFile, m_elements, m_numberElements, numberThreads);
     int nodeG;
     for (int i = 0; i < m_numberElements; i++) {
-      this->readElement(m_nodes, meshFile, &m_elements[i]);
       if (m_elements[i]->getTypeGmsh() == 15) {
         m_numberElements0D++;
       }
@@ -372,7 +387,7 @@ void MUSGmshV2::initCpuMeshSequential(TypeMeshContainer<Cell*>& cells, std::stri
   try {
     // 1) Opening cpu mesh file
     // ------------------------
-    std::ifstream meshFile(m_meshFile.c_str(), std::ios::in);
+    AsciiMeshReader meshFile(m_meshFile);
     if (!meshFile) {
       throw ErrorMeshNS("Mesh file not found: " + m_meshFile, __FILE__, __LINE__);
     }
@@ -392,12 +407,7 @@ void MUSGmshV2::initCpuMeshSequential(TypeMeshContainer<Cell*>& cells, std::stri
     // ------------------------
     meshFile >> m_numberNodes;
     m_nodes = new Coord[m_numberNodes];
-    int useless(0);
-    double x, y, z;
-    for (int i = 0; i < m_numberNodes; i++) {
-      meshFile >> useless >> x >> y >> z;
-      m_nodes[i].setXYZ(x, y, z);
-    }
+    this->readNodes(meshFile, m_nodes, m_numberNodes);
     // Skip keyword $EndNodes $Elements and others if necessary
     currentLine = "";
     while (currentLine != "$Elements") {
@@ -416,8 +426,8 @@ void MUSGmshV2::initCpuMeshSequential(TypeMeshContainer<Cell*>& cells, std::stri
     m_numberElements1D = 0;
     m_numberElements2D = 0;
     m_numberElements3D = 0;
+    this->readElements(m_nodes, meshFile, m_elements, m_numberElements);
     for (int i = 0; i < m_numberElements; i++) {
-      this->readElement(m_nodes, meshFile, &m_elements[i]);
       if (m_elements[i]->getTypeGmsh() == 15) {
         m_numberElements0D++;
       }
@@ -484,7 +494,7 @@ void MUSGmshV2::initCpuMeshParallel(TypeMeshContainer<Cell*>& cells, std::string
   try {
     // 1) Opening cpu mesh file
     // ------------------------
-    std::ifstream meshFile(m_meshFile.c_str(), std::ios::in);
+    AsciiMeshReader meshFile(m_meshFile);
     if (!meshFile) {
       throw ErrorMeshNS("Mesh file not found: " + m_meshFile, __FILE__, __LINE__);
     }
@@ -504,12 +514,7 @@ void MUSGmshV2::initCpuMeshParallel(TypeMeshContainer<Cell*>& cells, std::string
     // ------------------------
     meshFile >> m_numberNodes;
     m_nodes = new Coord[m_numberNodes];
-    int useless(0);
-    double x, y, z;
-    for (int i = 0; i < m_numberNodes; i++) {
-      meshFile >> useless >> x >> y >> z;
-      m_nodes[i].setXYZ(x, y, z);
-    }
+    this->readNodes(meshFile, m_nodes, m_numberNodes);
     // Skip keyword $EndNodes $Elements and others if necessary
     currentLine = "";
     while (currentLine != "$Elements") {
@@ -528,8 +533,8 @@ void MUSGmshV2::initCpuMeshParallel(TypeMeshContainer<Cell*>& cells, std::string
     m_numberElements1D = 0;
     m_numberElements2D = 0;
     m_numberElements3D = 0;
+    this->readElements(m_nodes, meshFile, m_elements, m_numberElements);
     for (int i = 0; i < m_numberElements; i++) {
-      this->readElement(m_nodes, meshFile, &m_elements[i]);
       if (m_elements[i]->getCPU() == cpu) {
         if (m_elements[i]->getTypeGmsh() == 1) {
           m_numberElements1D++;
@@ -607,9 +612,23 @@ void MUSGmshV2::initGeometryParallel(TypeMeshContainer<Cell*>& cells,
 {
   clock_t totalTime(clock());
   try {
-    // 1) Reading nodes and elements
-    // -----------------------------
-    this->readMeshParallel(); // Filling m_nodes and m_elements
+    // 1) Reading nodes and elements (and faces if the binary mesh caches of all CPUs are up to date)
+    // ----------------------------------------------------------------------------------------------
+    bool cacheRead(false);
+    if (m_meshCache) {
+      std::stringstream flux;
+      flux << rankCpu;
+      m_meshFile = m_nameMesh + "_CPU" + flux.str() + ".msh";
+      int cacheValid(this->checkMeshCache()), cacheValidAll(0);
+      MPI_Allreduce(&cacheValid, &cacheValidAll, 1, MPI_INT, MPI_MIN, computingComm);
+      cacheRead = (cacheValidAll == 1);
+    }
+    if (cacheRead) {
+      this->readMeshCache(); // Filling m_nodes, m_elements and m_faces
+    }
+    else {
+      this->readMeshParallel(); // Filling m_nodes and m_elements
+    }
     if (rankCpu == 0) {
       std::cout << "------------------------------------------------------" << std::endl;
       std::cout << " D) BUILDING GEOMETRY ..." << std::endl;
@@ -680,112 +699,116 @@ void MUSGmshV2::initGeometryParallel(TypeMeshContainer<Cell*>& cells,
     // 3) Building internal connectivity table
     // ---------------------------------------
 
-    // Sizing faces array
-    m_faces = new FaceNS*[m_numberFacesTotal];
-    int** facesBuff;   // Array of connectivity
-    int* sumNodesBuff; // We build a temporary array of faces to speed up the search process
-    facesBuff    = new int*[m_numberFacesTotal + 1];
-    sumNodesBuff = new int[m_numberFacesTotal + 1];
-    // Determination of the maximum number of nodes for the faces
-    int sizeFace(1); // Will be initialize at maximale size
-    if (m_numberElements3D != 0) {
-      if (m_numberQuadrangles != 0) {
-        sizeFace = 4;
-      }
-      else if (m_numberTriangles != 0) {
-        sizeFace = 3;
-      }
-      // else { Errors::errorMessage("Issue in initGeometryParallel for initialization of facesBuff array"); }
-      //JC//REMARK When a mesh file is partionned on an important number of CPUs it is highly possible that
-      // a given CPU has no boundary and therefore only 3D elements. In this case, the loop on boundaries is
-      // not executed and is not a problem.
-    }
-    else if (m_numberElements2D != 0) {
-      sizeFace = 2;
-    }
-    for (int i = 0; i < m_numberFacesTotal + 1; i++) // +1 is used for the search for the existence of faces
-    {
-      facesBuff[i] = new int[sizeFace]; // Unknown on the number of points of a face (4 seems to be the max)
-    }
-
-    // Inner faces
-    // -----------
-    int indexMaxFaces(0);
-    MPI_Barrier(MPI_COMM_WORLD);
     int printFrequency(1);
     clock_t tTemp(clock());
     double t1(0.);
-    if (rankCpu == 0) {
-      std::cout << "  1/Building faces ..." << std::endl;
-      printFrequency = std::max((m_numberInnerElements - m_numberBoundFaces) / 10, 1);
-    }
-    for (int i = m_numberBoundFaces; i < m_numberInnerElements; i++) {
-      if (rankCpu == 0 && (i - m_numberBoundFaces) % printFrequency == 0) {
-        std::cout << "    " << (100 * (i - m_numberBoundFaces) / (m_numberInnerElements - m_numberBoundFaces)) << "% ... " << std::endl;
+    if (!cacheRead) {
+      // Sizing faces array
+      m_faces = new FaceNS*[m_numberFacesTotal];
+      int** facesBuff;   // Array of connectivity
+      int* sumNodesBuff; // We build a temporary array of faces to speed up the search process
+      facesBuff    = new int*[m_numberFacesTotal + 1];
+      sumNodesBuff = new int[m_numberFacesTotal + 1];
+      // Determination of the maximum number of nodes for the faces
+      int sizeFace(1); // Will be initialize at maximale size
+      if (m_numberElements3D != 0) {
+        if (m_numberQuadrangles != 0) {
+          sizeFace = 4;
+        }
+        else if (m_numberTriangles != 0) {
+          sizeFace = 3;
+        }
+        // else { Errors::errorMessage("Issue in initGeometryParallel for initialization of facesBuff array"); }
+        //JC//REMARK When a mesh file is partionned on an important number of CPUs it is highly possible that
+        // a given CPU has no boundary and therefore only 3D elements. In this case, the loop on boundaries is
+        // not executed and is not a problem.
       }
-      // Building: Construct Faces from Elements and fill m_faces by Faces, facesBuff by sorted element connectivity
-      // and sumNodesBuff by the sum of the indices of the element nodes.
-      m_elements[i]->construitFaces(m_nodes, m_faces, indexMaxFaces, facesBuff, sumNodesBuff);
-    }
-    for (int i = 0; i < m_numberFacesTotal + 1; i++) {
-      delete[] facesBuff[i];
-    }
-    delete[] facesBuff;
-    delete[] sumNodesBuff;
-    MPI_Barrier(MPI_COMM_WORLD);
-    if (rankCpu == 0) {
-      tTemp = clock() - tTemp;
-      t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
-      std::cout << "    OK in " << t1 << " seconds" << std::endl;
-    }
-
-    // Boundaries
-    // ----------
-    tTemp = clock();
-    if (rankCpu == 0) {
-      std::cout << "  2/Boundary elements attribution to boundary faces ..." << std::endl;
-      printFrequency = std::max(m_numberBoundFaces / 10, 1);
-    }
-    for (int i = 0; i < m_numberBoundFaces; i++) {
-      if (rankCpu == 0 && i % printFrequency == 0) {
-        std::cout << "    " << (100 * i / m_numberBoundFaces) << "% ... " << std::endl;
+      else if (m_numberElements2D != 0) {
+        sizeFace = 2;
+      }
+      for (int i = 0; i < m_numberFacesTotal + 1; i++) // +1 is used for the search for the existence of faces
+      {
+        facesBuff[i] = new int[sizeFace]; // Unknown on the number of points of a face (4 seems to be the max)
       }
-      // Assigning the boundary 'Elements' (elements of dimension 'm_problemDimension-1') to the right
-      // neighbor of boundary 'Faces' stored in 'm_faces'
-      m_elements[i]->attributFaceLimite(m_faces, indexMaxFaces);
-    }
-    MPI_Barrier(MPI_COMM_WORLD);
-    if (rankCpu == 0) {
-      tTemp = clock() - tTemp;
-      t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
-      std::cout << "    OK in " << t1 << " seconds" << std::endl;
-    }
 
-    // Communications
-    // --------------
-    tTemp = clock();
-    if (rankCpu == 0) {
-      std::cout << "  3/Ghost cells attribution to communicating faces ..." << std::endl;
-      printFrequency = std::max((m_numberElements - m_numberInnerElements) / 10, 1);
-    }
-    for (int i = m_numberInnerElements; i < m_numberElements; i++) {
-      if (rankCpu == 0 && (i - m_numberInnerElements) % printFrequency == 0) {
-        std::cout << "    " << (100 * (i - m_numberInnerElements) / (m_numberElements - m_numberInnerElements)) << "% ... " << std::endl;
+      // Inner faces
+      // -----------
+      int indexMaxFaces(0);
+      MPI_Barrier(computingComm);
+      tTemp = clock();
+      if (rankCpu == 0) {
+        std::cout << "  1/Building faces ..." << std::endl;
+        printFrequency = std::max((m_numberInnerElements - m_numberBoundFaces) / 10, 1);
       }
-      // Assigning missing boundary: 1. mark interface with ghosts elements as communicating faces; 2. add limit marker; 3. add the Ghost element as right
-      // neighbour
-      m_elements[i]->attributFaceCommunicante(m_faces, indexMaxFaces, m_numberInnerNodes);
-    }
-    MPI_Barrier(MPI_COMM_WORLD);
-    if (rankCpu == 0) {
-      tTemp = clock() - tTemp;
-      t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
-      std::cout << "    OK in " << t1 << " seconds" << std::endl;
+      for (int i = m_numberBoundFaces; i < m_numberInnerElements; i++) {
+        if (rankCpu == 0 && (i - m_numberBoundFaces) % printFrequency == 0) {
+          std::cout << "    " << (100 * (i - m_numberBoundFaces) / (m_numberInnerElements - m_numberBoundFaces)) << "% ... " << std::endl;
+        }
+        // Building: Construct Faces from Elements and fill m_faces by Faces, facesBuff by sorted element connectivity
+        // and sumNodesBuff by the sum of the indices of the element nodes.
+        m_elements[i]->construitFaces(m_nodes, m_faces, indexMaxFaces, facesBuff, sumNodesBuff);
+      }
+      for (int i = 0; i < m_numberFacesTotal + 1; i++) {
+        delete[] facesBuff[i];
+      }
+      delete[] facesBuff;
+      delete[] sumNodesBuff;
+      MPI_Barrier(computingComm);
+      if (rankCpu == 0) {
+        tTemp = clock() - tTemp;
+        t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
+        std::cout << "    OK in " << t1 << " seconds" << std::endl;
+      }
+
+      // Boundaries
+      // ----------
+      tTemp = clock();
+      if (rankCpu == 0) {
+        std::cout << "  2/Boundary elements attribution to boundary faces ..." << std::endl;
+        printFrequency = std::max(m_numberBoundFaces / 10, 1);
+      }
+      for (int i = 0; i < m_numberBoundFaces; i++) {
+        if (rankCpu == 0 && i % printFrequency == 0) {
+          std::cout << "    " << (100 * i / m_numberBoundFaces) << "% ... " << std::endl;
+        }
+        // Assigning the boundary 'Elements' (elements of dimension 'm_problemDimension-1') to the right
+        // neighbor of boundary 'Faces' stored in 'm_faces'
+        m_elements[i]->attributFaceLimite(m_faces, indexMaxFaces);
+      }
+      MPI_Barrier(computingComm);
+      if (rankCpu == 0) {
+        tTemp = clock() - tTemp;
+        t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
+        std::cout << "    OK in " << t1 << " seconds" << std::endl;
+      }
+
+      // Communications
+      // --------------
+      tTemp = clock();
+      if (rankCpu == 0) {
+        std::cout << "  3/Ghost cells attribution to communicating faces ..." << std::endl;
+        printFrequency = std::max((m_numberElements - m_numberInnerElements) / 10, 1);
+      }
+      for (int i = m_numberInnerElements; i < m_numberElements; i++) {
+        if (rankCpu == 0 && (i - m_numberInnerElements) % printFrequency == 0) {
+          std::cout << "    " << (100 * (i - m_numberInnerElements) / (m_numberElements - m_numberInnerElements)) << "% ... " << std::endl;
+        }
+        // Assigning missing boundary: 1. mark interface with ghosts elements as communicating faces; 2. add limit marker; 3. add the Ghost element as right
+        // neighbour
+        m_elements[i]->attributFaceCommunicante(m_faces, indexMaxFaces, m_numberInnerNodes);
+      }
+      MPI_Barrier(computingComm);
+      if (rankCpu == 0) {
+        tTemp = clock() - tTemp;
+        t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
+        std::cout << "    OK in " << t1 << " seconds" << std::endl;
+      }
+      if (m_meshCache) this->writeMeshCache();
     }
 
     // Link Geometry/cellInterfaces of compute
     // ---------------------------------------
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Barrier(computingComm);
     tTemp = clock();
     if (rankCpu == 0) {
       std::cout << "  4/Linking Geometries -> Physics ..." << std::endl;
@@ -842,7 +865,7 @@ void MUSGmshV2::initGeometryParallel(TypeMeshContainer<Cell*>& cells,
       }
       cellInterfaces[i]->initialize(cells[iCellL], cells[iCellR]);
     }
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Barrier(computingComm);
     if (rankCpu == 0) {
       tTemp = clock() - tTemp;
       t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
@@ -851,7 +874,7 @@ void MUSGmshV2::initGeometryParallel(TypeMeshContainer<Cell*>& cells,
 
     // 4) Building connectivity table for parallel CPUs
     // ------------------------------------------------
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Barrier(computingComm);
     tTemp = clock();
     if (rankCpu == 0) {
       std::cout << "  5/Building connectivity tables for CPUs ..." << std::endl;
@@ -903,7 +926,7 @@ void MUSGmshV2::initGeometryParallel(TypeMeshContainer<Cell*>& cells,
         parallel.addSlopesToReceive(v);
       }
     }
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Barrier(computingComm);
     if (rankCpu == 0) {
       tTemp = clock() - tTemp;
       t1    = static_cast<double>(tTemp) / CLOCKS_PER_SEC;
@@ -942,7 +965,7 @@ void MUSGmshV2::readMeshParallel()
     std::stringstream flux;
     flux << rankCpu;
     m_meshFile = m_nameMesh + "_CPU" + flux.str() + ".msh";
-    std::ifstream meshFile(m_meshFile.c_str(), std::ios::in);
+    AsciiMeshReader meshFile(m_meshFile);
     if (!meshFile) {
       throw ErrorMeshNS("file mesh absent :" + m_meshFile, __FILE__, __LINE__);
     }
@@ -960,18 +983,13 @@ void MUSGmshV2::readMeshParallel()
 
     // 2) Filling m_nodes array
     // ------------------------
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Barrier(computingComm);
     if (rankCpu == 0) {
       std::cout << "  1/Reading mesh nodes ...";
     }
     meshFile >> m_numberNodes;
     m_nodes = new Coord[m_numberNodes];
-    int useless(0);
-    double x, y, z;
-    for (int i = 0; i < m_numberNodes; i++) {
-      meshFile >> useless >> x >> y >> z;
-      m_nodes[i].setXYZ(x, y, z);
-    }
+    this->readNodes(meshFile, m_nodes, m_numberNodes);
     // Skip keyword $EndNodes $Elements and others if necessary
     currentLine = "";
     while (currentLine != "$Elements") {
@@ -986,7 +1004,7 @@ void MUSGmshV2::readMeshParallel()
 
     // 3) 1D/2D/3D elements are stored in m_elements array / counting
     // --------------------------------------------------------------
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Barrier(computingComm);
     if (rankCpu == 0) {
       std::cout << "  2/Reading internal 1D/2D/3D elements ...";
     }
@@ -998,8 +1016,8 @@ void MUSGmshV2::readMeshParallel()
     m_numberElements2D = 0;
     m_numberElements3D = 0;
     //int posBeginElement = static_cast<int>(meshFile.tellg()); // id of the position of elements in file for quick return
+    this->readElements(m_nodes, meshFile, m_elements, m_numberElements);
     for (int i = 0; i < m_numberElements; i++) {
-      this->readElement(m_nodes, meshFile, &m_elements[i]);
       if (m_elements[i]->getCPU() == rankCpu) {
         if (m_elements[i]->getTypeGmsh() == 1) {
           m_numberElements1D++;
@@ -1023,14 +1041,14 @@ void MUSGmshV2::readMeshParallel()
     meshFile.ignore(10, '\n');      // Ignore end of last line parsed by extractor>> operator.
                                     // Ignoring at least 2 characters is needed to avoid errors with '\r\n' (CRLF) end of lines on dos encoded files.
                                     // Remark: fail on old 'mac' encoded files where end of lines are marked by carriage return only (CR or '\r').
-    getline(meshFile, currentLine); // line: '$EndElements'
+    meshFile.getline(currentLine); // line: '$EndElements'
     // Reading informations outside Gmsh
-    getline(meshFile, currentLine); // line: 'Information not read by Gmsh : number of communicating faces'
+    meshFile.getline(currentLine); // line: 'Information not read by Gmsh : number of communicating faces'
     meshFile >> m_numberFacesParallel;
     meshFile.ignore(10, '\n');      // Ignore end of last line parsed by extractor>> operator.
                                     // Ignoring at least 2 characters is needed to avoid errors with '\r\n' (CRLF) end of lines on dos encoded files.
                                     // Remark: fail on old 'mac' encoded files where end of lines are marked by carriage return only (CR or '\r').
-    getline(meshFile, currentLine); // line: 'Information not read by Gmsh : number of inner nodes (except ghosts)'
+    meshFile.getline(currentLine); // line: 'Information not read by Gmsh : number of inner nodes (except ghosts)'
     meshFile >> m_numberInnerNodes;
     meshFile.close();
     // Calculation of the number of elements belonging to the CPU
@@ -1060,11 +1078,13 @@ void MUSGmshV2::preProcessMeshFileForParallel()
     std::cout << "------------------------------------------------------" << std::endl;
     std::cout << " C0) MESH FILE PRETRAITEMENT " + m_meshFile + " IN PROGRESS ..." << std::endl;
     clock_t totalTime(clock());
-    std::ifstream meshFile(m_meshFile.c_str(), std::ios::in);
+    AsciiMeshReader meshFile(m_meshFile);
     if (!meshFile) {
       throw ErrorMeshNS("mesh file not found :" + m_meshFile, __FILE__, __LINE__);
     }
     std::string currentLine;
+    // The global mesh file is parsed by CPU 0 alone: all the threads available share its sections
+    int numberThreads(std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
 
     // Skiping Gmsh version + go to nodes
     // ----------------------------------
@@ -1081,12 +1101,7 @@ void MUSGmshV2::preProcessMeshFileForParallel()
     std::cout << "  1/Mesh nodes reading ...";
     meshFile >> numberNodesGlobal;
     nodesGlobal = new Coord[numberNodesGlobal];
-    int useless(0);
-    double x, y, z;
-    for (int i = 0; i < numberNodesGlobal; i++) {
-      meshFile >> useless >> x >> y >> z;
-      nodesGlobal[i].setXYZ(x, y, z);
-    }
+    this->readNodes(meshFile, nodesGlobal, numberNodesGlobal, numberThreads);
     // Skip keyword $EndNodes $Elements and others if necessary
     currentLine = "";
     while (currentLine != "$Elements") {
@@ -1105,8 +1120,8 @@ void MUSGmshV2::preProcessMeshFileForParallel()
     elementsGlobal = new ElementNS*[numberElementsGlobal];
     // Reading elements and assigning geometric properties
     //int posBeginElement = static_cast<int>(meshFile.tellg()); // id of the position of elements in file for quick return
+    this->readElements(nodesGlobal, meshFile, elementsGlobal, numberElementsGlobal, numberThreads);
     for (int i = 0; i < numberElementsGlobal; i++) {
-      this->readElement(nodesGlobal, meshFile, &elementsGlobal[i]);
       // Counting elements
       if (elementsGlobal[i]->getTypeGmsh() == 15) {
         numberElements0D++;
@@ -1148,6 +1163,12 @@ void MUSGmshV2::preProcessMeshFileForParallel()
     std::cout << "    mesh nodes number : " << numberNodesGlobal << std::endl;
     std::cout << "    elements number : " << numberElementsGlobal << std::endl;
 
+    // 2b) Built-in partitioning (otherwise ownership is given by Gmsh partition tags)
+    // --------------------------------------------------------------------------------
+    if (m_partitioner == "SFC") {
+      this->partitionMesh(elementsGlobal, numberElementsGlobal, numberNodesGlobal);
+    }
+
     // 3) Tracking and allocation by CPU
     // ---------------------------------
     std::cout << "  3/Attributing nodes to CPUs ..." << std::endl;
@@ -1204,8 +1225,8 @@ void MUSGmshV2::preProcessMeshFileForParallel()
     for (int p = 0; p < Ncpu; p++) {
       iMaxFaces[p]       = 0;
       numberFacesBuff[p] = 0;
-      for (unsigned int i = 0; i < elementsCPU[numCPU].size(); i++) {
-        numberFacesBuff[p] += elementsGlobal[elementsCPU[numCPU][i]]->getNumberFaces();
+      for (unsigned int i = 0; i < elementsCPU[p].size(); i++) {
+        numberFacesBuff[p] += elementsGlobal[elementsCPU[p][i]]->getNumberFaces();
       }
     }
     int*** facesBuff2   = new int**[Ncpu];
@@ -1309,6 +1330,7 @@ void MUSGmshV2::preProcessMeshFileForParallel()
       std::cout << "    print '" << meshFileCPU.c_str() << "' in progress ...' " << std::endl;
       std::ofstream fileStream;
       fileStream.open(meshFileCPU.c_str());
+      fileStream.precision(17); // Node coordinates kept exact
 
       fileStream << "$MeshFormat" << std::endl;
       fileStream << "2.2 0 8" << std::endl;
@@ -1380,7 +1402,232 @@ void MUSGmshV2::preProcessMeshFileForParallel()
 
 //***********************************************************************
 
-void MUSGmshV2::readElement(const Coord* nodesTable, std::ifstream& meshFile, ElementNS** element)
+void MUSGmshV2::partitionMesh(ElementNS** elementsGlobal, const int& numberElementsGlobal, const int& numberNodesGlobal)
+{
+  std::cout << "  2b/Partitioning mesh for " << Ncpu << " CPU (space-filling curve) ..." << std::endl;
+  clock_t tTemp(clock());
+
+  // a) Cells are the elements of highest dimension, lower dimension ones are boundaries
+  // ------------------------------------------------------------------------------------
+  std::vector<int> dimension(numberElementsGlobal);
+  int meshDimension(0);
+  for (int i = 0; i < numberElementsGlobal; i++) {
+    int typeGmsh(elementsGlobal[i]->getTypeGmsh());
+    if (typeGmsh == 15) { dimension[i] = 0; }
+    else if (typeGmsh == 1) { dimension[i] = 1; }
+    else if (typeGmsh <= 3) { dimension[i] = 2; }
+    else { dimension[i] = 3; }
+    meshDimension = std::max(meshDimension, dimension[i]);
+  }
+  std::vector<int> cellsGlobal;                        // Element index of each cell
+  std::vector<int> cellIndex(numberElementsGlobal, -1); // Cell index of each element (-1 if not a cell)
+  for (int i = 0; i < numberElementsGlobal; i++) {
+    if (dimension[i] == meshDimension) {
+      cellIndex[i] = cellsGlobal.size();
+      cellsGlobal.push_back(i);
+    }
+  }
+  int numberCells(cellsGlobal.size());
+  if (numberCells < Ncpu) throw ErrorMeshNS("not enough cells in mesh file for the number of CPUs used", __FILE__, __LINE__);
+
+  // b) Node -> cells connectivity (compressed storage)
+  // --------------------------------------------------
+  std::vector<int> nodeCellsOffset(numberNodesGlobal + 1, 0);
+  for (int k = 0; k < numberCells; k++) {
+    ElementNS* element(elementsGlobal[cellsGlobal[k]]);
+    for (int n = 0; n < element->getNumberNodes(); n++) {
+      nodeCellsOffset[element->getNumNode(n) + 1]++;
+    }
+  }
+  for (int node = 0; node < numberNodesGlobal; node++) {
+    nodeCellsOffset[node + 1] += nodeCellsOffset[node];
+  }
+  std::vector<int> nodeCells(nodeCellsOffset[numberNodesGlobal]);
+  std::vector<int> nodeCellsFill(nodeCellsOffset.begin(), nodeCellsOffset.end() - 1);
+  for (int k = 0; k < numberCells; k++) {
+    ElementNS* element(elementsGlobal[cellsGlobal[k]]);
+    for (int n = 0; n < element->getNumberNodes(); n++) {
+      nodeCells[nodeCellsFill[element->getNumNode(n)]++] = k;
+    }
+  }
+
+  // c) Dual graph: two cells are neighbors if they share a face, i.e. at least meshDimension nodes
+  // ---------------------------------------------------------------------------------------------
+  std::vector<std::vector<int>> neighbors(numberCells);
+  std::vector<int> sharedNodes(numberCells, 0);
+  std::vector<int> touchedCells;
+  for (int k = 0; k < numberCells; k++) {
+    ElementNS* element(elementsGlobal[cellsGlobal[k]]);
+    for (int n = 0; n < element->getNumberNodes(); n++) {
+      int node(element->getNumNode(n));
+      for (int j = nodeCellsOffset[node]; j < nodeCellsOffset[node + 1]; j++) {
+        if (nodeCells[j] == k) continue;
+        if (sharedNodes[nodeCells[j]] == 0) touchedCells.push_back(nodeCells[j]);
+        sharedNodes[nodeCells[j]]++;
+      }
+    }
+    for (unsigned int j = 0; j < touchedCells.size(); j++) {
+      if (sharedNodes[touchedCells[j]] >= std::max(meshDimension, 1)) neighbors[k].push_back(touchedCells[j]);
+      sharedNodes[touchedCells[j]] = 0;
+    }
+    touchedCells.clear();
+  }
+
+  // d) Initial partition: cells sorted by Morton key of their center and cut in chunks of equal weight
+  // --------------------------------------------------------------------------------------------------
+  // The weight of a cell is the cost of its faces (fluxes) plus the cost of the cell itself (time evolution, relaxations), see Mesh::setComputationalCosts.
+  Coord posMin(1.e30, 1.e30, 1.e30), posMax(-1.e30, -1.e30, -1.e30);
+  for (int k = 0; k < numberCells; k++) {
+    const Coord& pos(elementsGlobal[cellsGlobal[k]]->getPosition());
+    posMin.setXYZ(std::min(posMin.getX(), pos.getX()), std::min(posMin.getY(), pos.getY()), std::min(posMin.getZ(), pos.getZ()));
+    posMax.setXYZ(std::max(posMax.getX(), pos.getX()), std::max(posMax.getY(), pos.getY()), std::max(posMax.getZ(), pos.getZ()));
+  }
+  const double nbSubdivisions(65535.); // 2^16 - 1, range where decomposition::Key<3> bit splitting is exact
+  double length(std::max(posMax.getX() - posMin.getX(), std::max(posMax.getY() - posMin.getY(), posMax.getZ() - posMin.getZ())));
+  if (length <= 0.) length = 1.;
+  typedef std::pair<decomposition::Key<3>::value_type, int> KeyIndex;
+  std::vector<KeyIndex> keys(numberCells);
+  std::vector<double> weight(numberCells);
+  double totalWeight(0.);
+  for (int k = 0; k < numberCells; k++) {
+    Coord pos(elementsGlobal[cellsGlobal[k]]->getPosition() - posMin);
+    decomposition::Key<3> key(static_cast<int>(pos.getX() / length * nbSubdivisions),
+                              static_cast<int>(pos.getY() / length * nbSubdivisions),
+                              static_cast<int>(pos.getZ() / length * nbSubdivisions));
+    keys[k]      = KeyIndex(key.getIndex(), k);
+    weight[k]    = m_faceCost * elementsGlobal[cellsGlobal[k]]->getNumberFaces() + m_cellCost;
+    totalWeight += weight[k];
+  }
+  std::stable_sort(keys.begin(), keys.end(), [](const KeyIndex& a, const KeyIndex& b) { return a.first < b.first; });
+  std::vector<int> part(numberCells);
+  std::vector<double> load(Ncpu, 0.);
+  std::vector<int> numberCellsCPU(Ncpu, 0);
+  double cumulatedWeight(0.);
+  for (int i = 0; i < numberCells; i++) {
+    int k(keys[i].second);
+    int p(std::min(static_cast<int>((cumulatedWeight + 0.5 * weight[k]) / totalWeight * Ncpu), Ncpu - 1));
+    part[k]  = p;
+    load[p] += weight[k];
+    numberCellsCPU[p]++;
+    cumulatedWeight += weight[k];
+  }
+
+  // e) Refinement: partition-boundary cells move to the CPU owning most of their neighbors
+  // --------------------------------------------------------------------------------------
+  const double maxLoad(1.03 * totalWeight / Ncpu);
+  std::vector<int> connection(Ncpu, 0);
+  for (int sweep = 0; sweep < 4; sweep++) {
+    int numberMoves(0);
+    for (int k = 0; k < numberCells; k++) {
+      int p(part[k]), best(part[k]);
+      for (unsigned int j = 0; j < neighbors[k].size(); j++) {
+        connection[part[neighbors[k][j]]]++;
+      }
+      for (unsigned int j = 0; j < neighbors[k].size(); j++) {
+        int q(part[neighbors[k][j]]);
+        if (connection[q] > connection[best] && load[q] + weight[k] <= maxLoad) best = q;
+      }
+      for (unsigned int j = 0; j < neighbors[k].size(); j++) {
+        connection[part[neighbors[k][j]]] = 0;
+      }
+      if (best != p && numberCellsCPU[p] > 1) {
+        part[k]     = best;
+        load[p]    -= weight[k];
+        load[best] += weight[k];
+        numberCellsCPU[p]--;
+        numberCellsCPU[best]++;
+        numberMoves++;
+      }
+    }
+    if (numberMoves == 0) break;
+  }
+
+  // f) Ownership of every element, written as Gmsh partition tags
+  // -------------------------------------------------------------
+  std::vector<int> tags;
+  for (int i = 0; i < numberElementsGlobal; i++) {
+    ElementNS* element(elementsGlobal[i]);
+    tags.clear();
+    if (cellIndex[i] >= 0) {
+      // Cell: owner + CPUs owning a cell sharing at least one node (ghost candidates, filtered afterward on faces)
+      int k(cellIndex[i]);
+      tags.push_back(part[k] + 1);
+      for (int n = 0; n < element->getNumberNodes(); n++) {
+        int node(element->getNumNode(n));
+        for (int j = nodeCellsOffset[node]; j < nodeCellsOffset[node + 1]; j++) {
+          int tag(-(part[nodeCells[j]] + 1));
+          if (part[nodeCells[j]] != part[k] && std::find(tags.begin(), tags.end(), tag) == tags.end()) tags.push_back(tag);
+        }
+      }
+    }
+    else {
+      // Boundary element: owned by the CPU of the cell containing all its nodes
+      int owner(-1), n0(0);
+      int firstNode(element->getNumNode(n0));
+      for (int j = nodeCellsOffset[firstNode]; j < nodeCellsOffset[firstNode + 1] && owner < 0; j++) {
+        ElementNS* cell(elementsGlobal[cellsGlobal[nodeCells[j]]]);
+        int numberSharedNodes(0);
+        for (int n = 0; n < element->getNumberNodes(); n++) {
+          for (int m = 0; m < cell->getNumberNodes(); m++) {
+            if (cell->getNumNode(m) == element->getNumNode(n)) {
+              numberSharedNodes++;
+              break;
+            }
+          }
+        }
+        if (numberSharedNodes == element->getNumberNodes()) owner = part[nodeCells[j]];
+      }
+      if (owner < 0) owner = (nodeCellsOffset[firstNode + 1] > nodeCellsOffset[firstNode]) ? part[nodeCells[nodeCellsOffset[firstNode]]] : 0;
+      tags.push_back(owner + 1);
+    }
+    element->setAppartenanceCPU(&tags[0], tags.size());
+  }
+
+  // Partition quality
+  int edgeCut(0);
+  for (int k = 0; k < numberCells; k++) {
+    for (unsigned int j = 0; j < neighbors[k].size(); j++) {
+      if (part[neighbors[k][j]] != part[k]) edgeCut++;
+    }
+  }
+  std::cout << "    communicating faces : " << edgeCut / 2 << ", load imbalance (max/mean) : "
+            << *std::max_element(load.begin(), load.end()) * Ncpu / totalWeight << std::endl;
+  tTemp = clock() - tTemp;
+  std::cout << "    OK in " << static_cast<double>(tTemp) / CLOCKS_PER_SEC << " seconds" << std::endl;
+}
+
+//***********************************************************************
+
+void MUSGmshV2::readNodes(AsciiMeshReader& meshFile, Coord* nodesTable, const int& numberNodes, const int& numberThreads)
+{
+  meshFile.parseLines(numberNodes, numberThreads, [nodesTable](AsciiMeshReader& records, const int& firstNode, const int& number) {
+    int useless(0);
+    double x, y, z;
+    for (int i = firstNode; i < firstNode + number; i++) {
+      records >> useless >> x >> y >> z;
+      nodesTable[i].setXYZ(x, y, z);
+    }
+  });
+}
+
+//***********************************************************************
+
+void MUSGmshV2::readElements(const Coord* nodesTable, AsciiMeshReader& meshFile, ElementNS** elements, const int& numberElements, const int& numberThreads)
+{
+  meshFile.parseLines(numberElements, numberThreads, [this, nodesTable, elements](AsciiMeshReader& records, const int& firstElement, const int& number) {
+    for (int i = firstElement; i < firstElement + number; i++) {
+      this->readElement(nodesTable, records, &elements[i]);
+    }
+  });
+  // Counting after parsing, counters being shared by the threads
+  for (int i = 0; i < numberElements; i++) {
+    this->countElement(elements[i]->getTypeGmsh());
+  }
+}
+
+//***********************************************************************
+
+void MUSGmshV2::readElement(const Coord* nodesTable, AsciiMeshReader& meshFile, ElementNS** element)
 {
   int numberElement, numberTags, typeElement, numberPhysicEntity, numberGeometricEntity;
   meshFile >> numberElement >> typeElement;
@@ -1391,42 +1638,9 @@ void MUSGmshV2::readElement(const Coord* nodesTable, std::ifstream& meshFile, El
 
   // 1) Assignation of the number of vertices according to element type
   // ------------------------------------------------------------------
-  switch (typeElement) {
-  case 1: // Segment (two points)
-    *element = new ElementSegment;
-    m_numberSegments++;
-    break;
-  case 2: // Triangle (three points)
-    *element = new ElementTriangle;
-    m_numberTriangles++;
-    break;
-  case 3: // Quadrangle (four points)
-    *element = new ElementQuadrangle;
-    m_numberQuadrangles++;
-    break;
-  case 4: // Tetrahedron (four points)
-    *element = new ElementTetrahedron;
-    m_numberTetrahedrons++;
-    break;
-  case 7: // Quadrangular pyramid (five points) // This element seems to not work with Gmsh, volumes of elements seem to cause this issue
-    *element = new ElementPyramid;
-    m_numberPyramids++;
-    break;
-  case 15: // Point (a vertex)
-    *element = new ElementPoint;
-    m_numberPoints++;
-    break;
-  case 5: // Hexahedron (eight points)
-    *element = new ElementHexahedron;
-    m_numberHexahedrons++;
-    break;
-  case 6: // Prism (six points)
-    *element = new ElementPrism;
-    m_numberHexahedrons++;
-    break;
-  default:
-    Errors::errorMessage("Element type of file .msh inknown for ECOGEN");
-    break;
+  *element = MeshUnStruct::allocateElement(typeElement);
+  if (*element == nullptr) {
+    throw ErrorMeshNS("Element type of .msh not handled by ECOGEN", __FILE__, __LINE__);
   }
 
   // 2) Specific tags for parallel mesh
@@ -50,12 +50,30 @@ class MUSGmshV2 : public MUSGmsh
     void preProcessMeshFileForParallel() override;
     void initCpuMeshSequential(TypeMeshContainer<Cell*>& cells, std::string& computeOrder) override;
     void initCpuMeshParallel(TypeMeshContainer<Cell*>& cells, std::string& computeOrder, int cpu) override;
+    //! \brief     Switch of physical/geometrical tags (applied to the elements stored in the binary mesh cache)
+    int getMeshCacheReaderOptions() const override { return m_switchTags ? 1 : 0; };
 
   private:
     // --- Gmsh v2 related member functions ---
     void readMeshMonoCPU(std::vector<ElementNS*>** neighborNodes);
-    void readElement(const Coord* nodesTable, std::ifstream& meshFile, ElementNS** element);
+    //! \brief     Read the records of the $Nodes section
+    //! \param     numberThreads   number of threads parsing the records (see AsciiMeshReader::parseLines)
+    void readNodes(AsciiMeshReader& meshFile, Coord* nodesTable, const int& numberNodes, const int& numberThreads = 1);
+    //! \brief     Read the records of the $Elements section and update element type counters
+    //! \param     numberThreads   number of threads parsing the records (see AsciiMeshReader::parseLines)
+    void readElements(const Coord* nodesTable, AsciiMeshReader& meshFile, ElementNS** elements, const int& numberElements, const int& numberThreads = 1);
+    //! \brief     Read an element record (element type counters are not updated, may be called by concurrent threads)
+    void readElement(const Coord* nodesTable, AsciiMeshReader& meshFile, ElementNS** element);
     void readMeshParallel();
+    //! \brief     Built-in partitioning of the global mesh (replaces Gmsh partition tags)
+    //! \details   Cells are ordered along the Morton curve of their centers and cut into Ncpu chunks of equal weight (cost of
+    //!            the faces and of the cell, see Mesh::setComputationalCosts), then a few greedy refinement sweeps move partition-boundary cells to reduce the
+    //!            edge cut of the dual graph while keeping the load imbalance under 3%. Ghost CPUs are
+    //!            attributed to each cell as Gmsh does (node sharing), boundary elements follow the cell they bound.
+    //! \param     elementsGlobal         array of all elements of the global mesh
+    //! \param     numberElementsGlobal   number of elements of the global mesh
+    //! \param     numberNodesGlobal      number of nodes of the global mesh
+    void partitionMesh(ElementNS** elementsGlobal, const int& numberElementsGlobal, const int& numberNodesGlobal);
 
     bool m_switchTags;
 };
@@ -478,7 +478,7 @@ void MUSGmshV4::readMeshMonoCPU()
     // --------------------------------------
     std::cout << "------------------------------------------------------" << std::endl;
     std::cout << " C) READING MESH FILE " + m_meshFile + " IN PROGRESS ..." << std::endl;
-    std::ifstream meshFile(m_meshFile.c_str(), std::ios::in);
+    AsciiMeshReader meshFile(m_meshFile);
     if (!meshFile) {
       throw ErrorMeshNS("mesh file not found : " + m_meshFile, __FILE__, __LINE__);
     }
@@ -668,7 +668,7 @@ void MUSGmshV4::readMeshMonoCPU()
 //***********************************************************************
 
 void MUSGmshV4::readElement(const Coord* nodesTable,
-                            std::ifstream& meshFile,
+                            AsciiMeshReader& meshFile,
                             ElementNS** element,
                             std::vector<std::map<int, int>>& entities,
                             int entityDim,
@@ -718,7 +718,7 @@ void MUSGmshV4::readElement(const Coord* nodesTable,
     break;
   case 6: // Prism (six points)
     *element = new ElementPrism;
-    m_numberHexahedrons++;
+    m_numberPrisms++;
     break;
   default:
     Errors::errorMessage("Element type of file .msh inknown for ECOGEN");
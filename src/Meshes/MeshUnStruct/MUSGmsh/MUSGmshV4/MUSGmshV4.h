@@ -70,7 +70,7 @@ class MUSGmshV4 : public MUSGmsh
     // --- Gmsh v4 related member functions ---
     void readMeshMonoCPU();
     void readElement(const Coord* nodesTable,
-                     std::ifstream& meshFile,
+                     AsciiMeshReader& meshFile,
                      ElementNS** element,
                      std::vector<std::map<int, int>>& entities,
                      int entityDim,
@@ -77,6 +77,7 @@ class MixEuler : public Mixture
     void setToZero() override {};
     void setToMax() override {};
     void extrapolate(const Mixture& /*slope*/, const double& /*distance*/) override {};
+    void copyAndExtrapolate(Mixture& /*mixture*/, const Mixture& /*slope*/, const double& /*distance*/) override {};
     void limitSlopes(const Mixture& /*slopeGauche*/, const Mixture& /*slopeDroite*/, Limiter& /*globalLimiter*/) override {};
     void setMin(const Mixture& /*mixture1*/, const Mixture& /*mixture2*/) override {};
     void setMax(const Mixture& /*mixture1*/, const Mixture& /*mixture2*/) override {};
@@ -497,14 +497,22 @@ void ModEuler::solveRiemannInletTank(Cell& cellLeft,
 
     //ITERATIVE PROCESS FOR PRESSURE DETERMINATION
     //--------------------------------------------
-    int iteration(0);
-    double p(0.5 * p0);
+    int iteration(0), warmIterations(0);
+    const bool warmStart(WarmStart::isActive() && boundData[VarBoundary::p] > 0. && boundData[VarBoundary::p] < p0); //Last pressure of the face
+    bool warm(warmStart);
+    double p(warm ? boundData[VarBoundary::p] : 0.5 * p0);
     double f(0.), df(1.);
     double dv, h, dh, drho;
     double uStarR(0.), duStarR(0.), uStarL(0.), duStarL(0.);
     do {
       p -= f / df;
       iteration++;
+      if (iteration > 50 && warm) { //Warm start not converged: restart from the usual initialization
+        warm           = false;
+        warmIterations = iteration - 1;
+        iteration      = 1;
+        p              = 0.5 * p0;
+      }
       if (iteration > 50) Errors::errorMessage("solveRiemannInletTank not converged in modEuler");
       //Physical pressure ?
       eos->verifyAndModifyPressure(p);
@@ -543,6 +551,7 @@ void ModEuler::solveRiemannInletTank(Cell& cellLeft,
       df = duStarR - duStarL;
 
     } while (std::fabs(f) > 1e-3);
+    WarmStart::record(WARMINLETTANK, warmIterations + iteration, warmStart, warmIterations > 0);
 
     pStar = p;
     uStar = 0.5 * (uStarL + uStarR);
@@ -631,13 +640,21 @@ void ModEuler::solveRiemannInletInjStagState(Cell& cellLeft,
   //Subsonic inflow
   //---------------
   else {
-    int iteration(0);
-    pStar = pL;
+    int iteration(0), warmIterations(0);
+    const bool warmStart(WarmStart::isActive() && boundData[VarBoundary::p] > 0.); //Last pressure of the face
+    bool warm(warmStart);
+    pStar = warm ? boundData[VarBoundary::p] : pL;
     double f(0.), df(1.);
     double u, du, v, dv, h;
     do {
       pStar -= f / df;
       iteration++;
+      if (iteration > 50 && warm) { //Warm start not converged: restart from the usual initialization
+        warm           = false;
+        warmIterations = iteration - 1;
+        iteration      = 1;
+        pStar          = pL;
+      }
       if (iteration > 50) Errors::errorMessage("solveRiemannInflow not converged in modEuler");
       //physical pressure ?
       eos->verifyAndModifyPressure(pStar);
@@ -655,6 +672,7 @@ void ModEuler::solveRiemannInletInjStagState(Cell& cellLeft,
       df -= dv * rhok0[0];
 
     } while (std::fabs(f) > 1e-8 && iteration <= 50);
+    WarmStart::record(WARMINFLOW, warmIterations + iteration, warmStart, warmIterations > 0);
     uStar   = u;
     rhoStar = m0 / uStar;
   }
@@ -293,6 +293,37 @@ void PhaseEuler::getBuffer(std::vector<double>& dataToReceive, int& counter, Eos
   m_eos      = eos[static_cast<int>(dataToReceive[counter++])];
 }
 
+//***************************************************************************
+
+int PhaseEuler::numberOfTransmittedVariablesCompact() const
+{
+  //Number EOS not transmitted
+  return 5;
+}
+
+//***************************************************************************
+
+void PhaseEuler::fillBufferCompact(double* buffer, int& counter) const
+{
+  buffer[++counter] = m_density;
+  buffer[++counter] = m_velocity.getX();
+  buffer[++counter] = m_velocity.getY();
+  buffer[++counter] = m_velocity.getZ();
+  buffer[++counter] = m_pressure;
+}
+
+//***************************************************************************
+
+void PhaseEuler::getBufferCompact(double* buffer, int& counter, Eos** eos, const int& numberEos)
+{
+  m_density = buffer[++counter];
+  m_velocity.setX(buffer[++counter]);
+  m_velocity.setY(buffer[++counter]);
+  m_velocity.setZ(buffer[++counter]);
+  m_pressure = buffer[++counter];
+  m_eos      = eos[numberEos];
+}
+
 //****************************************************************************
 //******************************* ORDER 2 ************************************
 //****************************************************************************
@@ -341,6 +372,23 @@ void PhaseEuler::extrapolate(const Phase& slope, const double& distance)
 
 //***************************************************************************
 
+void PhaseEuler::copyAndExtrapolate(Phase& phase, const Phase& slope, const double& distance)
+{
+  const PhaseEuler& source(static_cast<const PhaseEuler&>(phase));
+  const PhaseEuler& sourceSlope(static_cast<const PhaseEuler&>(slope));
+  m_density     = source.m_density + sourceSlope.m_density * distance;
+  m_pressure    = source.m_pressure + sourceSlope.m_pressure * distance;
+  m_velocity.setX(source.m_velocity.getX() + sourceSlope.m_velocity.getX() * distance);
+  m_velocity.setY(source.m_velocity.getY() + sourceSlope.m_velocity.getY() * distance);
+  m_velocity.setZ(source.m_velocity.getZ() + sourceSlope.m_velocity.getZ() * distance);
+  m_eos         = source.m_eos;
+  m_energy      = source.m_energy;
+  m_soundSpeed  = source.m_soundSpeed;
+  m_totalEnergy = source.m_totalEnergy;
+}
+
+//***************************************************************************
+
 void PhaseEuler::limitSlopes(const Phase& slopeGauche, const Phase& slopeDroite, Limiter& globalLimiter, Limiter& /*volumeFractionLimiter*/)
 {
   m_density  = globalLimiter.limiteSlope(slopeGauche.getDensity(), slopeDroite.getDensity());
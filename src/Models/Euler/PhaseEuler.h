@@ -80,6 +80,9 @@ class PhaseEuler : public Phase
     void fillBuffer(std::vector<double>& dataToSend) const override;
     void getBuffer(double* buffer, int& counter, Eos** eos) override;
     void getBuffer(std::vector<double>& dataToReceive, int& counter, Eos** eos) override;
+    int numberOfTransmittedVariablesCompact() const override;
+    void fillBufferCompact(double* buffer, int& counter) const override;
+    void getBufferCompact(double* buffer, int& counter, Eos** eos, const int& numberEos) override;
 
     //Specific methods for second order
     //---------------------------------
@@ -87,6 +90,7 @@ class PhaseEuler : public Phase
     void setToZero() override;
     void setToMax() override;
     void extrapolate(const Phase& slope, const double& distance) override;
+    void copyAndExtrapolate(Phase& phase, const Phase& slope, const double& distance) override;
     void limitSlopes(const Phase& slopeGauche, const Phase& slopeDroite, Limiter& globalLimiter, Limiter& /*volumeFractionLimiter*/) override;
     void setMin(const Phase& phase1, const Phase& phase2) override;
     void setMax(const Phase& phase1, const Phase& phase2) override;
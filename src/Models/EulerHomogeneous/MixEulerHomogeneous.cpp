@@ -437,6 +437,22 @@ void MixEulerHomogeneous::extrapolate(const Mixture& slope, const double& distan
 
 //***************************************************************************
 
+void MixEulerHomogeneous::copyAndExtrapolate(Mixture& mixture, const Mixture& slope, const double& distance)
+{
+  const MixEulerHomogeneous& source(static_cast<const MixEulerHomogeneous&>(mixture));
+  const MixEulerHomogeneous& sourceSlope(static_cast<const MixEulerHomogeneous&>(slope));
+  m_density      = source.m_density;
+  m_pressure     = source.m_pressure + sourceSlope.m_pressure * distance;
+  m_velocity.setX(source.m_velocity.getX() + sourceSlope.m_velocity.getX() * distance);
+  m_velocity.setY(source.m_velocity.getY() + sourceSlope.m_velocity.getY() * distance);
+  m_velocity.setZ(source.m_velocity.getZ() + sourceSlope.m_velocity.getZ() * distance);
+  m_energy       = source.m_energy;
+  m_totalEnergy  = source.m_totalEnergy;
+  m_EqSoundSpeed = source.m_EqSoundSpeed;
+}
+
+//***************************************************************************
+
 void MixEulerHomogeneous::limitSlopes(const Mixture& slopeGauche, const Mixture& slopeDroite, Limiter& globalLimiter)
 {
   m_pressure = globalLimiter.limiteSlope(slopeGauche.getPressure(), slopeDroite.getPressure());
@@ -202,6 +202,33 @@ void PhaseEulerHomogeneous::getBuffer(std::vector<double>& dataToReceive, int& c
   m_eos      = eos[static_cast<int>(std::round(dataToReceive[counter++]))];
 }
 
+//***************************************************************************
+
+int PhaseEulerHomogeneous::numberOfTransmittedVariablesCompact() const
+{
+  //Number EOS not transmitted
+  return 3;
+}
+
+//***************************************************************************
+
+void PhaseEulerHomogeneous::fillBufferCompact(double* buffer, int& counter) const
+{
+  buffer[++counter] = m_alpha;
+  buffer[++counter] = m_density;
+  buffer[++counter] = m_pressure;
+}
+
+//***************************************************************************
+
+void PhaseEulerHomogeneous::getBufferCompact(double* buffer, int& counter, Eos** eos, const int& numberEos)
+{
+  m_alpha    = buffer[++counter];
+  m_density  = buffer[++counter];
+  m_pressure = buffer[++counter];
+  m_eos      = eos[numberEos];
+}
+
 //****************************************************************************
 //******************************* ORDER 2 ************************************
 //****************************************************************************
@@ -225,6 +252,21 @@ void PhaseEulerHomogeneous::extrapolate(const Phase& slope, const double& distan
 
 //***************************************************************************
 
+void PhaseEulerHomogeneous::copyAndExtrapolate(Phase& phase, const Phase& slope, const double& distance)
+{
+  const PhaseEulerHomogeneous& source(static_cast<const PhaseEulerHomogeneous&>(phase));
+  const PhaseEulerHomogeneous& sourceSlope(static_cast<const PhaseEulerHomogeneous&>(slope));
+  m_alpha       = source.m_alpha + sourceSlope.m_alpha * distance;
+  m_density     = source.m_density;
+  m_pressure    = source.m_pressure;
+  m_eos         = source.m_eos;
+  m_energy      = source.m_energy;
+  m_soundSpeed  = source.m_soundSpeed;
+  m_totalEnergy = source.m_totalEnergy;
+}
+
+//***************************************************************************
+
 void PhaseEulerHomogeneous::limitSlopes(const Phase& slopeGauche, const Phase& slopeDroite, Limiter& /*globalLimiter*/, Limiter& volumeFractionLimiter)
 {
   m_alpha = volumeFractionLimiter.limiteSlope(slopeGauche.getAlpha(), slopeDroite.getAlpha());
@@ -76,6 +76,7 @@ class MixEulerKorteweg : public Mixture
     void computeSlopesMixture(const Mixture& /*sLeft*/, const Mixture& /*sRight*/, const double& /*distance*/) override {};
     void setToZero() override {};
     void extrapolate(const Mixture& /*slope*/, const double& /*distance*/) override {};
+    void copyAndExtrapolate(Mixture& /*mixture*/, const Mixture& /*slope*/, const double& /*distance*/) override {};
     void limitSlopes(const Mixture& /*slopeGauche*/, const Mixture& /*slopeDroite*/, Limiter& /*globalLimiter*/) override {};
 
     //Specific methods for parallele computing at second order
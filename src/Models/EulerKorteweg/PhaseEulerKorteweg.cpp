@@ -314,6 +314,50 @@ void PhaseEulerKorteweg::getBuffer(std::vector<double>& dataToReceive, int& coun
   m_eos = eos[static_cast<int>(dataToReceive[counter++])];
 }
 
+//***************************************************************************
+
+int PhaseEulerKorteweg::numberOfTransmittedVariablesCompact() const
+{
+  //Number EOS not transmitted
+  return 9;
+}
+
+//***************************************************************************
+
+void PhaseEulerKorteweg::fillBufferCompact(double* buffer, int& counter) const
+{
+  buffer[++counter] = m_density;
+  buffer[++counter] = m_omega;
+  buffer[++counter] = m_eta;
+
+  buffer[++counter] = m_velocity.getX();
+  buffer[++counter] = m_velocity.getY();
+  buffer[++counter] = m_velocity.getZ();
+
+  buffer[++counter] = m_vectorP.getX();
+  buffer[++counter] = m_vectorP.getY();
+  buffer[++counter] = m_vectorP.getZ();
+}
+
+//***************************************************************************
+
+void PhaseEulerKorteweg::getBufferCompact(double* buffer, int& counter, Eos** eos, const int& numberEos)
+{
+  m_density = buffer[++counter];
+  m_omega   = buffer[++counter];
+  m_eta     = buffer[++counter];
+
+  m_velocity.setX(buffer[++counter]);
+  m_velocity.setY(buffer[++counter]);
+  m_velocity.setZ(buffer[++counter]);
+
+  m_vectorP.setX(buffer[++counter]);
+  m_vectorP.setY(buffer[++counter]);
+  m_vectorP.setZ(buffer[++counter]);
+
+  m_eos = eos[numberEos];
+}
+
 //****************************************************************************
 //******************************* ORDER 2 ************************************
 //****************************************************************************
@@ -80,6 +80,9 @@ class PhaseEulerKorteweg : public Phase
     void fillBuffer(std::vector<double>& dataToSend) const override;
     void getBuffer(double* buffer, int& counter, Eos** eos) override;
     void getBuffer(std::vector<double>& dataToReceive, int& counter, Eos** eos) override;
+    int numberOfTransmittedVariablesCompact() const override;
+    void fillBufferCompact(double* buffer, int& counter) const override;
+    void getBufferCompact(double* buffer, int& counter, Eos** eos, const int& numberEos) override;
 
     //Specific methods for second order
     //---------------------------------
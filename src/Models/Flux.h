@@ -36,10 +36,11 @@ class Flux; //Predeclaration of class Flux to include Cell.h
 #include "Phase.h"
 #include "../Order1/Cell.h"
 #include "../Tools.h"
+#include "../MemoryStats.h"
 
 //! \class     Flux
 //! \brief     Abstract class for conservative variables and fluxes
-class Flux
+class Flux : public MemoryTracked<MEMFLUXES>
 {
   public:
     Flux();
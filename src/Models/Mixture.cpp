@@ -29,6 +29,7 @@
 //  If not, see <http://www.gnu.org/licenses/>.
 
 #include "Mixture.h"
+#include "../WarmStart.h"
 
 int numberScalarsMixture;
 
@@ -56,7 +57,7 @@ void Mixture::printMixture(std::ofstream& fileStream) const
 
 //***************************************************************************
 
-double Mixture::computeTsat(const Eos* eosLiq, const Eos* eosVap, const double& pressure, double* dTsat)
+double Mixture::computeTsat(const Eos* eosLiq, const Eos* eosVap, const double& pressure, double* dTsat, const double& TsatGuess)
 {
   //Restrictions //FP//TODO// to improve
   if (eosLiq->getType() != TypeEOS::IG && eosLiq->getType() != TypeEOS::SG) {
@@ -85,12 +86,20 @@ double Mixture::computeTsat(const Eos* eosLiq, const Eos* eosVap, const double&
   D = (gammaL * cvL - cvL) / (gammaV * cvV - cvV);
 
   //iterative process to catch saturation temperature
-  int iteration(0);
-  double Tsat(0.1 * B / C);
+  int iteration(0), warmIterations(0);
+  const bool warmStart(TsatGuess > 0.);
+  bool warm(warmStart);
+  double Tsat(warm ? TsatGuess : 0.1 * B / C);
   double f(0.), df(1.);
   do {
     Tsat -= f / df;
     iteration++;
+    if (warm && (iteration > 50 || Tsat <= 0.)) { //Warm start not converged: restart from the usual initialization
+      warm           = false;
+      warmIterations = iteration - 1;
+      iteration      = 1;
+      Tsat           = 0.1 * B / C;
+    }
     if (iteration > 50) {
       errors.push_back(Errors("number iterations trop grand dans recherche Tsat", __FILE__, __LINE__));
       break;
@@ -98,6 +107,7 @@ double Mixture::computeTsat(const Eos* eosLiq, const Eos* eosVap, const double&
     f  = A + B / Tsat + C * log(Tsat) - log(pressure + pInfV) + D * log(pressure + pInfL);
     df = C / Tsat - B / (Tsat * Tsat);
   } while (std::fabs(f) > 1e-10);
+  WarmStart::record(WARMTSAT, warmIterations + iteration, warmStart, warmIterations > 0);
 
   double dfdp = -1. / (pressure + pInfV) + D / (pressure + pInfL);
   if (dTsat != 0) *dTsat = -dfdp / df;
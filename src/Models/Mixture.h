@@ -36,10 +36,11 @@
 class Mixture;
 
 #include "../AdditionalPhysics/QuantitiesAddPhys.h"
+#include "../MemoryStats.h"
 
 //! \class     Mixture
 //! \brief     Abstract class for mixture variables
-class Mixture
+class Mixture : public MemoryTracked<MEMMIXTURES>
 {
   public:
     Mixture();
@@ -53,9 +54,10 @@ class Mixture
     //! \param     eosVap             pointer to equation of state of vapor phase
     //! \param     pressure           pressure
     //! \param     dTsat              temperature derivative as function of pressure
+    //! \param     TsatGuess          initial guess of the iterations, e.g. Tsat at a close pressure (usual initialization if not positive)
     //! \return    saturation temperature
     //virtual double computeTsat(const Eos* eosLiq, const Eos* eosVap, const double& pressure, double* dTsat=0) { Errors::errorMessage("computeTsat not available for requested mixture"); return 0.; };
-    double computeTsat(const Eos* eosLiq, const Eos* eosVap, const double& pressure, double* dTsat = 0);
+    double computeTsat(const Eos* eosLiq, const Eos* eosVap, const double& pressure, double* dTsat = 0, const double& TsatGuess = 0.);
     //! \brief     Compute saturation pressure for a liq/vapor couple of fluid at given pressure
     //! \param     eosLiq             pointer to equation of state of liquid phase
     //! \param     eosVap             pointer to equation of state of vapor phase
@@ -292,6 +294,12 @@ class Mixture
     {
       Errors::errorMessage("extrapolate non implemente pour mixture utilise");
     };
+    //! \brief  Set the mixture to mixture extrapolated with slope (same result as copyMixture(mixture) followed by extrapolate(slope, distance))
+    virtual void copyAndExtrapolate(Mixture& mixture, const Mixture& slope, const double& distance)
+    {
+      this->copyMixture(mixture);
+      this->extrapolate(slope, distance);
+    };
     virtual void limitSlopes(const Mixture& /*slopeGauche*/, const Mixture& /*slopeDroite*/, Limiter& /*globalLimiter*/)
     {
       Errors::errorMessage("limitSlopes non implemente pour mixture utilise");
@@ -61,6 +61,17 @@ void Model::allocateEos(Cell& cell) const
 
 //***********************************************************************
 
+void Model::fulfillStateBatch(const TypeMeshContainer<Cell*>& cells)
+{
+  for (unsigned int i = 0; i < cells.size(); i++) {
+    if (!cells[i]->getSplit()) {
+      cells[i]->fulfillState();
+    }
+  }
+}
+
+//***********************************************************************
+
 void Model::initializeRelaxation(Cell* cell) const
 {
   for (unsigned int r = 0; r < m_relaxations.size(); r++) {
@@ -79,6 +90,16 @@ void Model::relaxations(Cell* cell, const double& dt, Prim type) const
 
 //***********************************************************************
 
+bool Model::needsRelaxations(Cell* cell) const
+{
+  for (unsigned int r = 0; r < m_relaxations.size(); r++) {
+    if (m_relaxations[r]->needsRelaxation(cell)) return true;
+  }
+  return false;
+}
+
+//***********************************************************************
+
 void Model::printInfo() const { std::cout << "Model : " << m_name << std::endl; }
 
 //***********************************************************************
@@ -94,6 +94,11 @@ class Model
     //! \param     mixture        mixture variables
     virtual void fulfillState(Phase** /*phases*/, Mixture* /*mixture*/) { Errors::errorMessage("fulfillState not available for required model"); };
 
+    //! \brief     Complete the thermodynamics states of the computed cells of a level
+    //! \param     cells          cells of the level (split cells are skipped)
+    //! \details   Default: fulfillState() cell by cell. Overridden by the models grouping the EOS evaluations by phase.
+    virtual void fulfillStateBatch(const TypeMeshContainer<Cell*>& cells);
+
     //! \brief     Complete some variables if necessary when resuming a simulation
     //! \param     phases         phases array variables
     //! \param     mixture        mixture variables
@@ -309,6 +314,9 @@ class Model
     //! \param     dt                time step
     //! \param     type              primitive-variable type
     void relaxations(Cell* cell, const double& dt, Prim type = vecPhases) const;
+    //! \brief     Cheap test telling whether at least one of the relaxations can modify the cell
+    //! \param     cell              cell
+    bool needsRelaxations(Cell* cell) const;
     //! \brief     Energy correction after relaxations (only for PUEq model)
     //! \param     cell              cell
     //! \param     type              primitive-variable type
@@ -544,6 +552,12 @@ class Model
     void printInfo() const;
     virtual const std::string& whoAmI() const { return Errors::defaultString; };
 
+    //! \brief     Relative cost of the flux computation of a face (Riemann problem and flux accumulation), used to weight the cells of the built-in partitioner
+    //! \details   Costs are given in units of the Riemann problem of the Euler model (ECOGEN_benchmark), default: Euler model
+    virtual double getFaceCost() const { return 1.; };
+    //! \brief     Relative cost of the time evolution and primitive-variable reconstruction of a cell (same units as getFaceCost)
+    virtual double getCellCost() const { return 1.3; };
+
     virtual void setSmoothCrossSection1d(const bool& /*applySmooth*/)
     {
       Errors::errorMessage("setSmoothCrossSection1d not available for required model");
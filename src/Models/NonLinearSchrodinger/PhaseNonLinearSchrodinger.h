@@ -65,6 +65,10 @@ class PhaseNonLinearSchrodinger : public PhaseEulerKorteweg
     void fillBuffer(std::vector<double>& dataToSend) const override;
     void getBuffer(double* buffer, int& counter, Eos** /*eos*/) override;
     void getBuffer(std::vector<double>& dataToReceive, int& counter, Eos** /*eos*/) override;
+    //No EOS index in the buffer of this phase: the compact exchange is the full one
+    int numberOfTransmittedVariablesCompact() const override { return this->numberOfTransmittedVariables(); };
+    void fillBufferCompact(double* buffer, int& counter) const override { this->fillBuffer(buffer, counter); };
+    void getBufferCompact(double* buffer, int& counter, Eos** eos, const int& /*numberEos*/) override { this->getBuffer(buffer, counter, eos); };
 
     //Verifications
     //-------------
@@ -555,6 +555,23 @@ void MixPTUEq::extrapolate(const Mixture& slope, const double& distance)
 
 //***************************************************************************
 
+void MixPTUEq::copyAndExtrapolate(Mixture& mixture, const Mixture& slope, const double& distance)
+{
+  const MixPTUEq& source(static_cast<const MixPTUEq&>(mixture));
+  const MixPTUEq& sourceSlope(static_cast<const MixPTUEq&>(slope));
+  m_density         = source.m_density;
+  m_pressure        = source.m_pressure + sourceSlope.m_pressure * distance;
+  m_temperature     = source.m_temperature + sourceSlope.m_temperature * distance;
+  m_velocity.setX(source.m_velocity.getX() + sourceSlope.m_velocity.getX() * distance);
+  m_velocity.setY(source.m_velocity.getY() + sourceSlope.m_velocity.getY() * distance);
+  m_velocity.setZ(source.m_velocity.getZ() + sourceSlope.m_velocity.getZ() * distance);
+  m_energy          = source.m_energy;
+  m_totalEnergy     = source.m_totalEnergy;
+  m_PTUEqSoundSpeed = source.m_PTUEqSoundSpeed;
+}
+
+//***************************************************************************
+
 void MixPTUEq::limitSlopes(const Mixture& slopeGauche, const Mixture& slopeDroite, Limiter& globalLimiter)
 {
   m_pressure    = globalLimiter.limiteSlope(slopeGauche.getPressure(), slopeDroite.getPressure());
@@ -339,8 +339,10 @@ void ModPTUEq::solveRiemannInletTank(Cell& cellLeft,
     }
     //ITERATIVE PROCESS FOR PRESSURE DETERMINATION
     //--------------------------------------------
-    int iteration(0);
-    double p(0.5 * p0);
+    int iteration(0), warmIterations(0);
+    const bool warmStart(WarmStart::isActive() && boundData[VarBoundary::p] > 0. && boundData[VarBoundary::p] < p0); //Last pressure of the face
+    bool warm(warmStart);
+    double p(warm ? boundData[VarBoundary::p] : 0.5 * p0);
     double f(0.), df(1.);
     double dmL;
     double uStarR(0.), duStarR(0.), uStarL(0.), duStarL(0.);
@@ -350,6 +352,12 @@ void ModPTUEq::solveRiemannInletTank(Cell& cellLeft,
     do {
       p -= f / df;
       iteration++;
+      if (iteration > 50 && warm) { //Warm start not converged: restart from the usual initialization
+        warm           = false;
+        warmIterations = iteration - 1;
+        iteration      = 1;
+        p              = 0.5 * p0;
+      }
       if (iteration > 50) Errors::errorMessage("solveRiemannInletTank not converged in ModPTUEq");
       //Physical pressure ?
       for (int k = 0; k < numberPhases; k++) {
@@ -383,6 +391,7 @@ void ModPTUEq::solveRiemannInletTank(Cell& cellLeft,
       f  = uStarR - uStarL;
       df = duStarR - duStarL;
     } while (std::fabs(f) > 1e-3); //End iterative loop
+    WarmStart::record(WARMINLETTANK, warmIterations + iteration, warmStart, warmIterations > 0);
     pStar   = p;
     uStar   = 0.5 * (uStarL + uStarR);
     rhoStar = 0.;
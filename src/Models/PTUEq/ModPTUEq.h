@@ -103,6 +103,8 @@ class ModPTUEq : public Model
     Coord& getVelocity(Cell* cell) override { return cell->getMixture()->getVelocity(); };
 
     const std::string& whoAmI() const override { return m_name; };
+    double getFaceCost() const override { return 1.6; };
+    double getCellCost() const override { return 4.2; };
 
   private:
     static const std::string NAME;
@@ -178,6 +178,29 @@ void PhasePTUEq::getBuffer(std::vector<double>& dataToReceive, int& counter, Eos
   m_eos   = eos[static_cast<int>(std::round(dataToReceive[counter++]))];
 }
 
+//***************************************************************************
+
+int PhasePTUEq::numberOfTransmittedVariablesCompact() const
+{
+  //Number EOS not transmitted
+  return 1;
+}
+
+//***************************************************************************
+
+void PhasePTUEq::fillBufferCompact(double* buffer, int& counter) const
+{
+  buffer[++counter] = m_alpha;
+}
+
+//***************************************************************************
+
+void PhasePTUEq::getBufferCompact(double* buffer, int& counter, Eos** eos, const int& numberEos)
+{
+  m_alpha = buffer[++counter];
+  m_eos   = eos[numberEos];
+}
+
 //****************************************************************************
 //******************************* ORDER 2 ************************************
 //****************************************************************************
@@ -201,6 +224,21 @@ void PhasePTUEq::extrapolate(const Phase& slope, const double& distance) { m_alp
 
 //***************************************************************************
 
+void PhasePTUEq::copyAndExtrapolate(Phase& phase, const Phase& slope, const double& distance)
+{
+  const PhasePTUEq& source(static_cast<const PhasePTUEq&>(phase));
+  const PhasePTUEq& sourceSlope(static_cast<const PhasePTUEq&>(slope));
+  m_alpha       = source.m_alpha + sourceSlope.m_alpha * distance;
+  m_density     = source.m_density;
+  m_pressure    = source.m_pressure;
+  m_eos         = source.m_eos;
+  m_energy      = source.m_energy;
+  m_soundSpeed  = source.m_soundSpeed;
+  m_totalEnergy = source.m_totalEnergy;
+}
+
+//***************************************************************************
+
 void PhasePTUEq::limitSlopes(const Phase& slopeGauche, const Phase& slopeDroite, Limiter& /*globalLimiter*/, Limiter& volumeFractionLimiter)
 {
   m_alpha = volumeFractionLimiter.limiteSlope(slopeGauche.getAlpha(), slopeDroite.getAlpha());
@@ -72,6 +72,9 @@ class ModPUEq : public ModUEq
     //! \param  numPhases      Phases number's
     double selectScalar(Phase** phases, Mixture* mixture, Transport* transports, Variable nameVariable, int num = 0) const override;
 
+    double getFaceCost() const override { return 2.5; };
+    double getCellCost() const override { return 3.5; };
+
   private:
     static const std::string NAME;
 
@@ -39,11 +39,12 @@
 #include "../libTierces/tinyxml2.h"
 #include "../Order2/HeaderLimiter.h"
 #include "../Tools.h"
+#include "../MemoryStats.h"
 
 //! \class     Phase
 //! \brief     Abstract class for a phase
 //! \details   Can not be instanciated, variables depend on the model
-class Phase
+class Phase : public MemoryTracked<MEMPHASES>
 {
   public:
     Phase();
@@ -143,6 +144,10 @@ class Phase
     {
       Errors::errorMessage("getBuffer not available for requested phase type");
     };
+    //! \brief     Compact exchange: same as the full buffer without the EOS index (given by numberEos on reception)
+    virtual int numberOfTransmittedVariablesCompact() const { return this->numberOfTransmittedVariables(); };
+    virtual void fillBufferCompact(double* buffer, int& counter) const { this->fillBuffer(buffer, counter); };
+    virtual void getBufferCompact(double* buffer, int& counter, Eos** eos, const int& /*numberEos*/) { this->getBuffer(buffer, counter, eos); };
 
     //Specific methods for second order
     //---------------------------------
@@ -156,6 +161,12 @@ class Phase
     {
       Errors::errorMessage("extrapolate not available for requested phase type");
     };
+    //! \brief  Set the phase to phase extrapolated with slope (same result as copyPhase(phase) followed by extrapolate(slope, distance))
+    virtual void copyAndExtrapolate(Phase& phase, const Phase& slope, const double& distance)
+    {
+      this->copyPhase(phase);
+      this->extrapolate(slope, distance);
+    };
     virtual void
     limitSlopes(const Phase& /*slopeGauche*/, const Phase& /*slopeDroite*/, Limiter& /*globalLimiter*/, Limiter& /*volumeFractionLimiter*/)
     {
@@ -184,6 +195,8 @@ class Phase
     {
       Errors::errorMessage("getBufferSlopes not available for requested phase type");
     };
+    //! \brief  Number of first slopes of fillBufferSlopes that are limited with the volume-fraction limiter
+    virtual int numberOfVolumeFractionSlopes() const { return 0; };
 
     //Specific methods for solids
     //---------------------------
@@ -390,6 +390,23 @@ void MixUEq::extrapolate(const Mixture& slope, const double& distance)
 
 //***************************************************************************
 
+void MixUEq::copyAndExtrapolate(Mixture& mixture, const Mixture& slope, const double& distance)
+{
+  const MixUEq& source(static_cast<const MixUEq&>(mixture));
+  const MixUEq& sourceSlope(static_cast<const MixUEq&>(slope));
+  m_density          = source.m_density;
+  m_pressure         = source.m_pressure;
+  m_velocity.setX(source.m_velocity.getX() + sourceSlope.m_velocity.getX() * distance);
+  m_velocity.setY(source.m_velocity.getY() + sourceSlope.m_velocity.getY() * distance);
+  m_velocity.setZ(source.m_velocity.getZ() + sourceSlope.m_velocity.getZ() * distance);
+  m_energy           = source.m_energy;
+  m_totalEnergy      = source.m_totalEnergy;
+  m_frozenSoundSpeed = source.m_frozenSoundSpeed;
+  m_woodSoundSpeed   = source.m_woodSoundSpeed;
+}
+
+//***************************************************************************
+
 void MixUEq::limitSlopes(const Mixture& slopeGauche, const Mixture& slopeDroite, Limiter& globalLimiter)
 {
   m_velocity.setX(globalLimiter.limiteSlope(slopeGauche.getVelocity().getX(), slopeDroite.getVelocity().getX()));
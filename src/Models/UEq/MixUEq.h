@@ -87,6 +87,7 @@ class MixUEq : public Mixture
     void setToZero() override;
     void setToMax() override;
     void extrapolate(const Mixture& slope, const double& distance) override;
+    void copyAndExtrapolate(Mixture& mixture, const Mixture& slope, const double& distance) override;
     void limitSlopes(const Mixture& slopeGauche, const Mixture& slopeDroite, Limiter& globalLimiter) override;
     void setMin(const Mixture& mixture1, const Mixture& mixture2) override;
     void setMax(const Mixture& mixture1, const Mixture& mixture2) override;
@@ -132,6 +133,9 @@ class MixUEq : public Mixture
     double m_totalEnergy;      //!< mixture total specific energy
     double m_frozenSoundSpeed; //!< frozen sound speed
     double m_woodSoundSpeed;   //!< wood sound speed
+
+  private:
+    friend class ModUEq;
 };
 
 #endif // MIXUEQ_H
@@ -96,6 +96,105 @@ void ModUEq::fulfillState(Phase** phases, Mixture* mixture)
   mixture->computeMixtureVariables(phases);
 }
 
+//***********************************************************************
+
+void ModUEq::fulfillStateBatch(const TypeMeshContainer<Cell*>& cells)
+{
+  //1) Computed cells of the level
+  //------------------------------
+  m_batch.cells.clear();
+  for (unsigned int i = 0; i < cells.size(); i++) {
+    if (!cells[i]->getSplit()) m_batch.cells.push_back(cells[i]);
+  }
+  int numberCells(m_batch.cells.size()), size(numberPhases * numberCells);
+  m_batch.phases.resize(size);
+  m_batch.alpha.resize(size);
+  m_batch.density.resize(size);
+  m_batch.pressure.resize(size);
+  m_batch.temperature.resize(size);
+  m_batch.energy.resize(size);
+  m_batch.soundSpeed.resize(size);
+  m_batch.massFraction.resize(size);
+  m_batch.mixDensity.assign(numberCells, 0.);
+  m_batch.mixPressure.assign(numberCells, 0.);
+  m_batch.mixEnergy.assign(numberCells, 0.);
+  m_batch.frozenSoundSpeed.assign(numberCells, 0.);
+  m_batch.woodSoundSpeed.assign(numberCells, 0.);
+
+  //2) Complete phases state: gathering and batched EOS evaluations on the ranges of cells sharing the same EOS
+  //----------------------------------------------------------------------------------------------------------
+  for (int k = 0; k < numberPhases; k++) {
+    int offset(k * numberCells);
+    m_batch.eosStarts.clear();
+    for (int i = 0; i < numberCells; i++) {
+      PhaseUEq* phase(static_cast<PhaseUEq*>(m_batch.cells[i]->getPhase(k)));
+      if (i == 0 || phase->m_eos != m_batch.phases[offset + i - 1]->m_eos) m_batch.eosStarts.push_back(offset + i);
+      m_batch.phases[offset + i]   = phase;
+      m_batch.alpha[offset + i]    = phase->m_alpha;
+      m_batch.density[offset + i]  = phase->m_density;
+      m_batch.pressure[offset + i] = phase->m_pressure;
+    }
+    m_batch.eosStarts.push_back(offset + numberCells);
+    for (unsigned int r = 0; r < m_batch.eosStarts.size() - 1; r++) {
+      int start(m_batch.eosStarts[r]), number(m_batch.eosStarts[r + 1] - start);
+      const Eos* eos(m_batch.phases[start]->m_eos);
+      eos->computeTemperatureBatch(number, &m_batch.density[start], &m_batch.pressure[start], &m_batch.temperature[start]);
+      eos->computeEnergyBatch(number, &m_batch.density[start], &m_batch.pressure[start], &m_batch.energy[start]);
+      eos->computeSoundSpeedBatch(number, &m_batch.density[start], &m_batch.pressure[start], &m_batch.soundSpeed[start]);
+    }
+  }
+
+  //3) Complete mixture variables using phases variable (same operations as MixUEq::computeMixtureVariables())
+  //---------------------------------------------------------------------------------------------------------
+  for (int k = 0; k < numberPhases; k++) {
+    const double* alpha(&m_batch.alpha[k * numberCells]);
+    const double* density(&m_batch.density[k * numberCells]);
+    const double* pressure(&m_batch.pressure[k * numberCells]);
+    for (int i = 0; i < numberCells; i++) {
+      m_batch.mixDensity[i]  += alpha[i] * density[i];
+      m_batch.mixPressure[i] += alpha[i] * pressure[i];
+    }
+  }
+  for (int k = 0; k < numberPhases; k++) {
+    const double* alpha(&m_batch.alpha[k * numberCells]);
+    const double* density(&m_batch.density[k * numberCells]);
+    const double* energy(&m_batch.energy[k * numberCells]);
+    const double* soundSpeed(&m_batch.soundSpeed[k * numberCells]);
+    double* massFraction(&m_batch.massFraction[k * numberCells]);
+    for (int i = 0; i < numberCells; i++) {
+      massFraction[i]               = alpha[i] * density[i] / std::max(m_batch.mixDensity[i], epsilonAlphaNull);
+      m_batch.mixEnergy[i]         += massFraction[i] * energy[i];
+      m_batch.frozenSoundSpeed[i]  += massFraction[i] * soundSpeed[i] * soundSpeed[i];
+      m_batch.woodSoundSpeed[i]    += alpha[i] / std::max((density[i] * soundSpeed[i] * soundSpeed[i]), epsilonAlphaNull);
+    }
+  }
+  for (int i = 0; i < numberCells; i++) {
+    m_batch.frozenSoundSpeed[i] = sqrt(m_batch.frozenSoundSpeed[i]);
+    m_batch.woodSoundSpeed[i]   = 1. / sqrt(m_batch.mixDensity[i] * m_batch.woodSoundSpeed[i]);
+  }
+
+  //4) Scattering
+  //-------------
+  for (int k = 0; k < numberPhases; k++) {
+    int offset(k * numberCells);
+    for (int i = 0; i < numberCells; i++) {
+      PhaseUEq* phase(m_batch.phases[offset + i]);
+      phase->m_Y           = m_batch.massFraction[offset + i];
+      phase->m_temperature = m_batch.temperature[offset + i];
+      phase->m_energy      = m_batch.energy[offset + i];
+      phase->m_soundSpeed  = m_batch.soundSpeed[offset + i];
+    }
+  }
+  for (int i = 0; i < numberCells; i++) {
+    MixUEq* mixture(static_cast<MixUEq*>(m_batch.cells[i]->getMixture()));
+    mixture->m_density          = m_batch.mixDensity[i];
+    mixture->m_pressure         = m_batch.mixPressure[i];
+    mixture->m_energy           = m_batch.mixEnergy[i];
+    mixture->m_frozenSoundSpeed = m_batch.frozenSoundSpeed[i];
+    mixture->m_woodSoundSpeed   = m_batch.woodSoundSpeed[i];
+  }
+}
+
 //****************************************************************************
 //********************* Cell to cell Riemann solvers *************************
 //****************************************************************************
@@ -612,8 +711,10 @@ void ModUEq::solveRiemannInletTank(Cell& cellLeft,
     }
     //ITERATIVE PROCESS FOR PRESSURE DETERMINATION
     //--------------------------------------------
-    int iteration(0);
-    double p(0.5 * p0);
+    int iteration(0), warmIterations(0);
+    const bool warmStart(WarmStart::isActive() && boundData[VarBoundary::p] > 0. && boundData[VarBoundary::p] < p0); //Last pressure of the face
+    bool warm(warmStart);
+    double p(warm ? boundData[VarBoundary::p] : 0.5 * p0);
     double f(0.), df(1.);
     double hk, dhk, rhok, drhok, dmL, YkL;
     double uStarR(0.), duStarR(0.), uStarL(0.), duStarL(0.);
@@ -621,6 +722,12 @@ void ModUEq::solveRiemannInletTank(Cell& cellLeft,
     do {
       p -= f / df;
       iteration++;
+      if (iteration > 50 && warm) { //Warm start not converged: restart from the usual initialization
+        warm           = false;
+        warmIterations = iteration - 1;
+        iteration      = 1;
+        p              = 0.5 * p0;
+      }
       //Physical pressure ?
       for (int k = 0; k < numberPhases; k++) {
         TB->eos[k]->verifyAndModifyPressure(p);
@@ -678,6 +785,7 @@ void ModUEq::solveRiemannInletTank(Cell& cellLeft,
       f  = uStarR - uStarL;
       df = duStarR - duStarL;
     } while (std::fabs(f) > 1e-2); //End iterative loop
+    WarmStart::record(WARMINLETTANK, warmIterations + iteration, warmStart, warmIterations > 0);
     pStar   = p;
     uStar   = 0.5 * (uStarL + uStarR);
     rhoStar = 0.;
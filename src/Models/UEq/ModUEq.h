@@ -66,6 +66,10 @@ class ModUEq : public Model
     //! \details    Complete multiphase state from volume fractions, pressures, densities and velocity
     void fulfillState(Phase** phases, Mixture* mixture) override;
 
+    //! \details    Phase by phase, the EOS evaluations of the cells are done by the batched EOS methods (cells sharing the same EOS at once).
+    //!             Valid as long as the phases are PhaseUEq (or derived) whose extendedCalculusPhase() is the one of PhaseUEq.
+    void fulfillStateBatch(const TypeMeshContainer<Cell*>& cells) override;
+
     //! \details    Does nothing for this model
     void fulfillStateResume(Phase** /*phases*/, Mixture* /*mixture*/) override {};
 
@@ -158,12 +162,34 @@ class ModUEq : public Model
     Coord& getVelocity(Cell* cell) override { return cell->getMixture()->getVelocity(); };
 
     const std::string& whoAmI() const override { return m_name; };
+    double getFaceCost() const override { return 2.8; };
+    double getCellCost() const override { return 4.1; };
 
     void setSmoothCrossSection1d(const bool& applySmooth) override { m_smoothCrossSection1d = applySmooth; };
 
   private:
     static const std::string NAME;
 
+    //! \brief     Buffers of fulfillStateBatch(): phase variables are stored phase by phase (index k * number of cells + i)
+    struct BatchStates
+    {
+      std::vector<Cell*> cells;            //!< Computed cells of the level
+      std::vector<PhaseUEq*> phases;       //!< Phases of the cells
+      std::vector<int> eosStarts;          //!< Starts of the ranges of cells sharing the same EOS for the current phase
+      std::vector<double> alpha;           //!< Phase volume fractions
+      std::vector<double> density;         //!< Phase densities
+      std::vector<double> pressure;        //!< Phase pressures
+      std::vector<double> temperature;     //!< Phase temperatures
+      std::vector<double> energy;          //!< Phase internal energies
+      std::vector<double> soundSpeed;      //!< Phase speeds of sound
+      std::vector<double> massFraction;    //!< Phase mass fractions
+      std::vector<double> mixDensity;      //!< Mixture densities
+      std::vector<double> mixPressure;     //!< Mixture pressures
+      std::vector<double> mixEnergy;       //!< Mixture internal energies
+      std::vector<double> frozenSoundSpeed; //!< Mixture frozen speeds of sound
+      std::vector<double> woodSoundSpeed;  //!< Mixture Wood speeds of sound
+    } m_batch;
+
     friend class FluxUEq;
 };
 
@@ -257,6 +257,33 @@ void PhaseUEq::getBuffer(std::vector<double>& dataToReceive, int& counter, Eos**
   m_eos      = eos[static_cast<int>(std::round(dataToReceive[counter++]))];
 }
 
+//***************************************************************************
+
+int PhaseUEq::numberOfTransmittedVariablesCompact() const
+{
+  //Number EOS not transmitted
+  return 3;
+}
+
+//***************************************************************************
+
+void PhaseUEq::fillBufferCompact(double* buffer, int& counter) const
+{
+  buffer[++counter] = m_alpha;
+  buffer[++counter] = m_density;
+  buffer[++counter] = m_pressure;
+}
+
+//***************************************************************************
+
+void PhaseUEq::getBufferCompact(double* buffer, int& counter, Eos** eos, const int& numberEos)
+{
+  m_alpha    = buffer[++counter];
+  m_density  = buffer[++counter];
+  m_pressure = buffer[++counter];
+  m_eos      = eos[numberEos];
+}
+
 //****************************************************************************
 //******************************* ORDER 2 ************************************
 //****************************************************************************
@@ -297,6 +324,22 @@ void PhaseUEq::extrapolate(const Phase& slope, const double& distance)
 
 //***************************************************************************
 
+void PhaseUEq::copyAndExtrapolate(Phase& phase, const Phase& slope, const double& distance)
+{
+  const PhaseUEq& source(static_cast<const PhaseUEq&>(phase));
+  const PhaseUEq& sourceSlope(static_cast<const PhaseUEq&>(slope));
+  m_alpha       = source.m_alpha + sourceSlope.m_alpha * distance;
+  m_density     = source.m_density + sourceSlope.m_density * distance;
+  m_pressure    = source.m_pressure + sourceSlope.m_pressure * distance;
+  m_Y           = source.m_Y;
+  m_temperature = source.m_temperature;
+  m_eos         = source.m_eos;
+  m_energy      = source.m_energy;
+  m_soundSpeed  = source.m_soundSpeed;
+}
+
+//***************************************************************************
+
 void PhaseUEq::limitSlopes(const Phase& slopeGauche, const Phase& slopeDroite, Limiter& globalLimiter, Limiter& volumeFractionLimiter)
 {
   m_alpha    = volumeFractionLimiter.limiteSlope(slopeGauche.getAlpha(), slopeDroite.getAlpha());
@@ -92,6 +92,8 @@ class ModUEqTotEnergy : public Model
     Coord& getVelocity(Cell* cell) override { return cell->getMixture()->getVelocity(); };
 
     const std::string& whoAmI() const override { return m_name; };
+    double getFaceCost() const override { return 2.4; };
+    double getCellCost() const override { return 4.3; };
 
   private:
     static const std::string NAME;
@@ -253,6 +253,33 @@ void PhaseUEqTotEnergy::getBuffer(std::vector<double>& dataToReceive, int& count
   m_eos      = eos[static_cast<int>(std::round(dataToReceive[counter++]))];
 }
 
+//***************************************************************************
+
+int PhaseUEqTotEnergy::numberOfTransmittedVariablesCompact() const
+{
+  //Number EOS not transmitted
+  return 3;
+}
+
+//***************************************************************************
+
+void PhaseUEqTotEnergy::fillBufferCompact(double* buffer, int& counter) const
+{
+  buffer[++counter] = m_alpha;
+  buffer[++counter] = m_density;
+  buffer[++counter] = m_pressure;
+}
+
+//***************************************************************************
+
+void PhaseUEqTotEnergy::getBufferCompact(double* buffer, int& counter, Eos** eos, const int& numberEos)
+{
+  m_alpha    = buffer[++counter];
+  m_density  = buffer[++counter];
+  m_pressure = buffer[++counter];
+  m_eos      = eos[numberEos];
+}
+
 //****************************************************************************
 //******************************* ORDER 2 ************************************
 //****************************************************************************
@@ -284,6 +311,20 @@ void PhaseUEqTotEnergy::extrapolate(const Phase& slope, const double& distance)
 
 //***************************************************************************
 
+void PhaseUEqTotEnergy::copyAndExtrapolate(Phase& phase, const Phase& slope, const double& distance)
+{
+  const PhaseUEqTotEnergy& source(static_cast<const PhaseUEqTotEnergy&>(phase));
+  const PhaseUEqTotEnergy& sourceSlope(static_cast<const PhaseUEqTotEnergy&>(slope));
+  m_alpha      = source.m_alpha + sourceSlope.m_alpha * distance;
+  m_density    = source.m_density + sourceSlope.m_density * distance;
+  m_pressure   = source.m_pressure + sourceSlope.m_pressure * distance;
+  m_eos        = source.m_eos;
+  m_totEnergy  = source.m_totEnergy;
+  m_soundSpeed = source.m_soundSpeed;
+}
+
+//***************************************************************************
+
 void PhaseUEqTotEnergy::limitSlopes(const Phase& slopeGauche, const Phase& slopeDroite, Limiter& globalLimiter, Limiter& volumeFractionLimiter)
 {
   m_alpha    = volumeFractionLimiter.limiteSlope(slopeGauche.getAlpha(), slopeDroite.getAlpha());
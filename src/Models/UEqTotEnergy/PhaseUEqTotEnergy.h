@@ -78,12 +78,16 @@ class PhaseUEqTotEnergy : public Phase
     void fillBuffer(std::vector<double>& dataToSend) const override;
     void getBuffer(double* buffer, int& counter, Eos** eos) override;
     void getBuffer(std::vector<double>& dataToReceive, int& counter, Eos** eos) override;
+    int numberOfTransmittedVariablesCompact() const override;
+    void fillBufferCompact(double* buffer, int& counter) const override;
+    void getBufferCompact(double* buffer, int& counter, Eos** eos, const int& numberEos) override;
 
     //Specific methods for second order
     //---------------------------------
     void computeSlopesPhase(const Phase& sLeft, const Phase& sRight, const double& distance) override;
     void setToZero() override;
     void extrapolate(const Phase& slope, const double& distance) override;
+    void copyAndExtrapolate(Phase& phase, const Phase& slope, const double& distance) override;
     void limitSlopes(const Phase& slopeGauche, const Phase& slopeDroite, Limiter& globalLimiter, Limiter& volumeFractionLimiter) override;
 
     //Specific methods for parallele computing at second order
@@ -91,6 +95,7 @@ class PhaseUEqTotEnergy : public Phase
     int numberOfTransmittedSlopes() const override;
     void fillBufferSlopes(double* buffer, int& counter) const override;
     void getBufferSlopes(double* buffer, int& counter) override;
+    int numberOfVolumeFractionSlopes() const override { return 1; };
 
     //Verifications
     //-------------
@@ -40,21 +40,42 @@ std::vector<int> numeratorDefault;
 
 //***********************************************************************
 
-Cell::Cell() : m_wall(false), m_vecPhases(0), m_mixture(0), m_vecTransports(0), m_cons(0), m_consTransports(0), m_element(0), m_childrenCells(0)
+Cell::Cell() :
+  m_wall(false),
+  m_narrowBand(true),
+  m_vecPhases(0),
+  m_mixture(0),
+  m_vecTransports(0),
+  m_cons(0),
+  m_consTransports(0),
+  m_element(0),
+  m_childrenCells(0)
 {
   m_lvl   = 0;
   m_xi    = 0.;
   m_split = false;
+
+  m_relaxedPressure = WarmStart::noSolution();
 }
 
 //***********************************************************************
 
 Cell::Cell(int lvl) :
-  m_wall(false), m_vecPhases(0), m_mixture(0), m_vecTransports(0), m_cons(0), m_consTransports(0), m_element(0), m_childrenCells(0)
+  m_wall(false),
+  m_narrowBand(true),
+  m_vecPhases(0),
+  m_mixture(0),
+  m_vecTransports(0),
+  m_cons(0),
+  m_consTransports(0),
+  m_element(0),
+  m_childrenCells(0)
 {
   m_lvl   = lvl;
   m_xi    = 0.;
   m_split = false;
+
+  m_relaxedPressure = WarmStart::noSolution();
 }
 
 //***********************************************************************
@@ -517,6 +538,28 @@ void Cell::timeEvolutionAddPhys(const double& dt)
 
 //***********************************************************************
 
+void Cell::timeEvolutionAddPhysStage(const double& dt, const double& mu, const double& nu, Flux* consStage)
+{
+  //The stage is written as an increment on U_j-1: U_j = U_j-1 + nu (U_j-2 - U_j-1) + mu dt L(U_j-1),
+  //so that the scheme correction of non-conservative models applies as for a forward Euler step
+  // clang-format off
+  m_cons->multiply(mu * dt);       //m_cons (sum of fluxes and non-conservative terms) is multiplied by mu dt
+  if (nu != 0.) {
+    fluxBuff->setCons(consStage);  //fluxBuff receives U_j-2
+    m_cons->addFlux(nu);
+  }
+  m_cons->setBufferFlux(*this);    //fluxBuff receives conservative variables of the previous stage: U_j-1
+  if (nu != 0.) {
+    m_cons->subtractFlux(nu);
+  }
+  consStage->setCons(fluxBuff);    //U_j-1 is kept for the next stage
+  m_cons->schemeCorrection(*this); //Specific correction for non-conservative models (using U_j-1 in fluxBuff and increment in m_cons)
+  m_cons->addFlux(1.);             //Adding the buffer fluxBuff (U_j-1) to obtain U_j in m_cons
+  // clang-format on
+}
+
+//***********************************************************************
+
 void Cell::buildPrim() { m_cons->buildPrim(m_vecPhases, m_mixture); }
 
 //***********************************************************************
@@ -626,7 +669,13 @@ void Cell::deleteInterface(const int& b) { m_cellInterfaces.erase(m_cellInterfac
 void Cell::prepareAddPhys()
 {
   for (unsigned int qpa = 0; qpa < m_vecQuantitiesAddPhys.size(); qpa++) {
-    m_vecQuantitiesAddPhys[qpa]->computeQuantities(this);
+    //Outside the narrow band, the quantities of the interface-localized additional physics vanish
+    if (m_narrowBand || !m_vecQuantitiesAddPhys[qpa]->getAddPhys()->isInterfaceLocalized()) {
+      m_vecQuantitiesAddPhys[qpa]->computeQuantities(this);
+    }
+    else {
+      m_vecQuantitiesAddPhys[qpa]->setToZero();
+    }
   }
 }
 
@@ -1200,6 +1249,7 @@ void Cell::refineCellAndCellInterfaces(const int& nbCellsY,
       m_childrenCells[i]->setConsTransport(0., k);
     }
     m_childrenCells[i]->setXi(m_xi);
+    m_childrenCells[i]->setRelaxedPressure(m_relaxedPressure);
   }
 
   //-----------------------------------
@@ -1473,6 +1523,7 @@ void Cell::unrefineCellAndCellInterfaces()
   //---------------------
 
   this->averageChildrenInParent();
+  m_relaxedPressure = WarmStart::noSolution(); //Older than the children states
 
   //--------------------------------------------
   //Internal children cell-interface destruction
@@ -1640,11 +1691,12 @@ std::vector<Cell*>* Cell::getChildVector() { return &m_childrenCells; }
 //************************** Parallel non-AMR *******************************
 //****************************************************************************
 
-void Cell::fillBufferPrimitives(double* buffer, int& counter, const int& lvl, const int& neighbour, Prim type) const
+void Cell::fillBufferPrimitives(double* buffer, int& counter, const int& lvl, const int& neighbour, Prim type, bool compact) const
 {
   if (m_lvl == lvl) {
     for (int k = 0; k < numberPhases; k++) {
-      this->getPhase(k, type)->fillBuffer(buffer, counter);
+      if (compact) { this->getPhase(k, type)->fillBufferCompact(buffer, counter); }
+      else { this->getPhase(k, type)->fillBuffer(buffer, counter); }
     }
     this->getMixture(type)->fillBuffer(buffer, counter);
     for (int k = 0; k < numberTransports; k++) {
@@ -1654,7 +1706,7 @@ void Cell::fillBufferPrimitives(double* buffer, int& counter, const int& lvl, co
   else {
     for (unsigned int i = 0; i < m_childrenCells.size(); i++) {
       if (m_childrenCells[i]->hasNeighboringGhostCellOfCPUneighbour(neighbour)) {
-        m_childrenCells[i]->fillBufferPrimitives(buffer, counter, lvl, neighbour, type);
+        m_childrenCells[i]->fillBufferPrimitives(buffer, counter, lvl, neighbour, type, compact);
       }
     }
   }
@@ -1662,11 +1714,12 @@ void Cell::fillBufferPrimitives(double* buffer, int& counter, const int& lvl, co
 
 //***********************************************************************
 
-void Cell::getBufferPrimitives(double* buffer, int& counter, const int& lvl, Eos** eos, Prim type)
+void Cell::getBufferPrimitives(double* buffer, int& counter, const int& lvl, Eos** eos, Prim type, const int* phasesEos)
 {
   if (m_lvl == lvl) {
     for (int k = 0; k < numberPhases; k++) {
-      this->getPhase(k, type)->getBuffer(buffer, counter, eos);
+      if (phasesEos) { this->getPhase(k, type)->getBufferCompact(buffer, counter, eos, phasesEos[k]); }
+      else { this->getPhase(k, type)->getBuffer(buffer, counter, eos); }
     }
     this->getMixture(type)->getBuffer(buffer, counter);
     for (int k = 0; k < numberTransports; k++) {
@@ -1676,7 +1729,7 @@ void Cell::getBufferPrimitives(double* buffer, int& counter, const int& lvl, Eos
   }
   else {
     for (unsigned int i = 0; i < m_childrenCells.size(); i++) {
-      m_childrenCells[i]->getBufferPrimitives(buffer, counter, lvl, eos, type);
+      m_childrenCells[i]->getBufferPrimitives(buffer, counter, lvl, eos, type, phasesEos);
     }
   }
 }
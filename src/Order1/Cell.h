@@ -49,13 +49,15 @@ class Cell; //Predeclaration of class to include following .h
 #include "../Meshes/Element.h"
 #include "../Geometries/GeometricalDomain.h"
 #include "../Symmetries/Symmetry.h"
+#include "../MemoryStats.h"
+#include "../WarmStart.h"
 
 class GradPhase;
 class GradMixture;
 
 //! \class     Cell
 //! \brief     Base class for a mesh cell
-class Cell
+class Cell : public MemoryTracked<MEMCELLS>
 {
   public:
     //! \brief     Basic Cell constructor for a non AMR cell
@@ -89,6 +91,11 @@ class Cell
     void setToZeroConsGlobal();
     void timeEvolution(const double& dt, Symmetry* symmetry);
     void timeEvolutionAddPhys(const double& dt);
+    //! \brief     Stage of the super time stepping of the additional physics: U_j = U_j-1 + nu (U_j-2 - U_j-1) + mu dt L(U_j-1)
+    //! \param     dt                stage time step
+    //! \param     mu, nu            stage coefficients (mu = 1 and nu = 0 for the first stage)
+    //! \param     consStage         conservative variables of stage j-2 on input, of stage j-1 on output
+    void timeEvolutionAddPhysStage(const double& dt, const double& mu, const double& nu, Flux* consStage);
     void buildPrim();
     void buildCons();
     virtual void correctionEnergy(Prim /*type*/ = vecPhases);
@@ -161,6 +168,10 @@ class Cell
     const Coord& getVelocity() const;
     void setWall(bool wall);
     bool getWall() const { return m_wall; };
+    void setNarrowBand(bool narrowBand) { m_narrowBand = narrowBand; };
+    bool getNarrowBand() const { return m_narrowBand; };
+    const double& getRelaxedPressure() const { return m_relaxedPressure; };
+    void setRelaxedPressure(const double& pressure) { m_relaxedPressure = pressure; };
     //! \brief  Select a specific scalar variable
     //! \param  nameVariables  Name of the variable to select
     //! \param  numPhases      Phases number's
@@ -197,6 +208,11 @@ class Cell
     virtual void saveCons() {};                                                     /*!< Does nothing for first order cells */
     virtual void getBackCons() {};                                                  /*!< Does nothing for first order cells */
     virtual void predictionOrdre2(const double& /*dt*/, Symmetry* /*symmetry*/) {}; /*!< Does nothing for first order cells */
+    //! \brief    Runge-Kutta stage in Shu-Osher form: U(i) = coefUn * Un + coefStage * (U(i-1) + dt * L(U(i-1))), coefUn = 0 for the first stage
+    virtual void timeEvolutionRungeKutta(const double& /*dt*/, Symmetry* /*symmetry*/, const double& /*coefUn*/, const double& /*coefStage*/)
+    {
+      Errors::errorMessage("timeEvolutionRungeKutta not available for first order cells");
+    };
 
     //Methods for distance to an other object (Cell or CellInterface)
     //---------------------------------------------------------------
@@ -264,8 +280,9 @@ class Cell
     virtual int getRankOfNeighborCPU() const { return -1; };
     virtual void setRankOfNeighborCPU(int /*rank*/) {};                         /*!< Does nothing for non-ghost cells */
     // clang-format on
-    void fillBufferPrimitives(double* buffer, int& counter, const int& lvl, const int& neighbour, Prim type = vecPhases) const;
-    void getBufferPrimitives(double* buffer, int& counter, const int& lvl, Eos** eos, Prim type = vecPhases);
+    //! \brief     Pack/unpack primitive variables; the compact form (phases EOS indexes given in phasesEos) omits the EOS indexes
+    void fillBufferPrimitives(double* buffer, int& counter, const int& lvl, const int& neighbour, Prim type = vecPhases, bool compact = false) const;
+    void getBufferPrimitives(double* buffer, int& counter, const int& lvl, Eos** eos, Prim type = vecPhases, const int* phasesEos = nullptr);
     void fillBufferVector(
       double* buffer, int& counter, const int& lvl, const int& neighbour, const int& dim, Variable nameVector, int num = 0, int index = -1) const;
     void getBufferVector(double* buffer, int& counter, const int& lvl, const int& dim, Variable nameVector, int num = 0, int index = -1);
@@ -339,6 +356,8 @@ class Cell
 
   protected:
     bool m_wall;                                            /*!< Bool indicating if the cell is a solid boundary (for immersed boundaries) */
+    bool m_narrowBand;                                      /*!< Bool indicating if the cell is in the narrow band around the interfaces
+                                                                 (always true when no NarrowBand is used) */
     Phase** m_vecPhases;                                    /*!< Array of phases */
     Mixture* m_mixture;                                     /*!< Mixture */
     Transport* m_vecTransports;                             /*!< Array of passive variables advected in the flow */
@@ -347,6 +366,7 @@ class Cell
     Element* m_element;                                     /*!< Pointer to corresponding geometrical mesh element */
     std::vector<CellInterface*> m_cellInterfaces;           /*!< Vector of cell-interface pointers */
     std::vector<QuantitiesAddPhys*> m_vecQuantitiesAddPhys; /*!< Vector of pointers to the Quantities of Additional Physics of the cell */
+    double m_relaxedPressure;                               /*!< Last relaxed pressure, initial guess of the next relaxation (see WarmStart) */
 
     //Attributs pour methode AMR
     int m_lvl;                                                    /*!< Cell AMR level in the AMR tree */
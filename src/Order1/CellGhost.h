@@ -45,6 +45,13 @@ class CellGhost : public Cell
     CellGhost(int lvl); //Pour AMR
     ~CellGhost() override;
 
+    //! \brief     Ghost cells are accounted apart from the computational cells
+    static void* operator new(std::size_t size) { return MemoryStats::allocate(MemoryStats::redirect(MEMGHOSTCELLS), size); }
+    static void operator delete(void* pointer, std::size_t size)
+    {
+      MemoryStats::deallocate(MemoryStats::redirect(MEMGHOSTCELLS), pointer, size);
+    }
+
     int getRankOfNeighborCPU() const override;
     void setRankOfNeighborCPU(int rank) override;
     void createChildCell(const int& lvl) override;
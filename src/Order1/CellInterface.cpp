@@ -327,6 +327,10 @@ Cell* CellInterface::getCellLeft() const { return m_cellLeft; }
 
 Cell* CellInterface::getCellRight() const { return m_cellRight; }
 
+//***********************************************************************
+
+bool CellInterface::hasGhostCell() const { return m_cellLeft->isCellGhost() || (m_cellRight != nullptr && m_cellRight->isCellGhost()); }
+
 //****************************************************************************
 //******************************AMR Method***********************************
 //****************************************************************************
@@ -43,8 +43,9 @@ class CellInterface; //Predeclaration de la classe CellInterface pour pouvoir in
 
 class Source; //Predeclaration to include following file
 #include "../Sources/Source.h"
+#include "../MemoryStats.h"
 
-class CellInterface
+class CellInterface : public MemoryTracked<MEMCELLINTERFACES>
 {
   public:
     /** Default constructor */
@@ -102,6 +103,7 @@ class CellInterface
     Model* getMod() const;
     Cell* getCellLeft() const;
     Cell* getCellRight() const;
+    bool hasGhostCell() const; /*!< True if the left or right cell belongs to another CPU */
     virtual const int& getNumPhys() const { return Errors::defaultIntNeg; };
     virtual double getBoundData(VarBoundary /*var*/) const
     {
@@ -13,6 +13,7 @@ CellInterfaceO2Cartesian::CellInterfaceO2Cartesian(int lvl) : CellInterfaceO2(lv
 
 CellInterfaceO2Cartesian::~CellInterfaceO2Cartesian()
 {
+  MemoryStats::Redirection slopes(MEMSLOPES);
   if (m_vecPhasesSlopes) {
     for (int k = 0; k < numberPhases; k++) {
       if (m_vecPhasesSlopes[k]) delete m_vecPhasesSlopes[k];
@@ -33,12 +34,16 @@ void CellInterfaceO2Cartesian::allocateSlopes(int& allocateSlopeLocal)
   //On attribut les phases a partir de la cell a gauche (car cell a droite inexistante pour les limites)
   //Necessaire car il faut connaitre le type de phase (ex: PhasePUEq, etc.))
   //Ensuite on met a zero toutes les slopes
-  for (int k = 0; k < numberPhases; k++) {
-    m_cellLeft->getPhase(k)->allocateAndCopyPhase(&m_vecPhasesSlopes[k]);
-    m_vecPhasesSlopes[k]->setToZero();
+  //Slope objects are accounted apart from the phases and mixtures of the cells
+  {
+    MemoryStats::Redirection slopes(MEMSLOPES);
+    for (int k = 0; k < numberPhases; k++) {
+      m_cellLeft->getPhase(k)->allocateAndCopyPhase(&m_vecPhasesSlopes[k]);
+      m_vecPhasesSlopes[k]->setToZero();
+    }
+    m_cellLeft->getMixture()->allocateAndCopyMixture(&m_mixtureSlopes);
+    m_mixtureSlopes->setToZero();
   }
-  m_cellLeft->getMixture()->allocateAndCopyMixture(&m_mixtureSlopes);
-  m_mixtureSlopes->setToZero();
 
   //Allocation des slopes sur transports
   m_vecTransportsSlopes = new Transport[numberTransports];
@@ -69,6 +74,7 @@ void CellInterfaceO2Cartesian::allocateSlopes(int& allocateSlopeLocal)
       slopesTransportLocal2[k] = 0.;
     }
 
+    packedSlopesLocal.initialize(slopesPhasesLocal1, slopesMixtureLocal1);
     allocateSlopeLocal = 1;
   }
 }
@@ -113,19 +119,16 @@ void CellInterfaceO2Cartesian::solveRiemann(double& dtMax,
                                             Prim type)
 {
   //Si la cell gauche ou droite est de niveau inferieur a "lvl", on ne prend pas "type" mais vecPhases (ca evite de prendre vecPhaseO2 alors qu'on ne l'a pas).
-  if (m_cellLeft->getLvl() == m_lvl) {
-    bufferCellLeft->copyVec(m_cellLeft->getPhases(type), m_cellLeft->getMixture(type), m_cellLeft->getTransports(type));
-  }
-  else {
-    bufferCellLeft->copyVec(m_cellLeft->getPhases(vecPhases), m_cellLeft->getMixture(vecPhases), m_cellLeft->getTransports(vecPhases));
-  }
-
-  if (m_cellRight->getLvl() == m_lvl) {
-    bufferCellRight->copyVec(m_cellRight->getPhases(type), m_cellRight->getMixture(type), m_cellRight->getTransports(type));
+  //The buffer cells are directly filled with the extrapolated states (no preliminary copy of the cell states)
+  Prim typeLeft(type), typeRight(type);
+  if (m_cellLeft->getLvl() != m_lvl) {
+    typeLeft = vecPhases;
   }
-  else {
-    bufferCellRight->copyVec(m_cellRight->getPhases(vecPhases), m_cellRight->getMixture(vecPhases), m_cellRight->getTransports(vecPhases));
+  if (m_cellRight->getLvl() != m_lvl) {
+    typeRight = vecPhases;
   }
+  Phase** phasesLeft(m_cellLeft->getPhases(typeLeft));
+  Phase** phasesRight(m_cellRight->getPhases(typeRight));
 
   //Calcul des distances cell interface <-> cells pour l extrapolation
   double distanceGauche(this->distance(m_cellLeft));
@@ -135,8 +138,8 @@ void CellInterfaceO2Cartesian::solveRiemann(double& dtMax,
   int phase0(0), phase1(1);
   double alphaCellLeft(0.), alphaCellLeftLeft(0.), alphaCellRight(0.), alphaCellRightRight(0.);
   double beta(1.6), sign(0.), newAlpha(0.), A(0.), B(0.), C(0.), qmin(0.), qmax(0.), epsInterface(1.e-4);
-  alphaCellLeft  = bufferCellLeft->getPhase(phase0)->getAlpha();
-  alphaCellRight = bufferCellRight->getPhase(phase0)->getAlpha();
+  alphaCellLeft  = phasesLeft[phase0]->getAlpha();
+  alphaCellRight = phasesRight[phase0]->getAlpha();
 
   //Extrapolation gauche
   m_cellLeft->computeLocalSlopes(*this,
@@ -149,13 +152,13 @@ void CellInterfaceO2Cartesian::solveRiemann(double& dtMax,
                                  alphaCellRight,
                                  epsInterface);
   for (int k = 0; k < numberPhases; k++) {
-    bufferCellLeft->getPhase(k)->extrapolate(*slopesPhasesLocal1[k], distanceGauche);
+    bufferCellLeft->getPhase(k)->copyAndExtrapolate(*phasesLeft[k], *slopesPhasesLocal1[k], distanceGauche);
     bufferCellLeft->getPhase(k)->verifyAndCorrectPhase();
     bufferCellLeft->getPhase(k)->verifyAndCorrectDensityMax();
   }
-  bufferCellLeft->getMixture()->extrapolate(*slopesMixtureLocal1, distanceGauche);
+  bufferCellLeft->getMixture()->copyAndExtrapolate(*m_cellLeft->getMixture(typeLeft), *slopesMixtureLocal1, distanceGauche);
   for (int k = 0; k < numberTransports; k++) {
-    bufferCellLeft->getTransport(k).extrapolate(slopesTransportLocal1[k], distanceGauche);
+    bufferCellLeft->getTransport(k).copyAndExtrapolate(m_cellLeft->getTransport(k, typeLeft), slopesTransportLocal1[k], distanceGauche);
   }
   //THINC method (for alpha only)
   if (globalVolumeFractionLimiter.AmITHINC() || interfaceVolumeFractionLimiter.AmITHINC()) {
@@ -196,15 +199,15 @@ void CellInterfaceO2Cartesian::solveRiemann(double& dtMax,
                                   epsInterface);
   for (int k = 0; k < numberPhases; k++) {
     slopesPhasesLocal1[k]->changeSign(); //On doit soustraire les slopes a droite
-    bufferCellRight->getPhase(k)->extrapolate(*slopesPhasesLocal1[k], distanceDroite);
+    bufferCellRight->getPhase(k)->copyAndExtrapolate(*phasesRight[k], *slopesPhasesLocal1[k], distanceDroite);
     bufferCellRight->getPhase(k)->verifyAndCorrectPhase();
     bufferCellRight->getPhase(k)->verifyAndCorrectDensityMax();
   }
   slopesMixtureLocal1->changeSign();
-  bufferCellRight->getMixture()->extrapolate(*slopesMixtureLocal1, distanceDroite);
+  bufferCellRight->getMixture()->copyAndExtrapolate(*m_cellRight->getMixture(typeRight), *slopesMixtureLocal1, distanceDroite);
   for (int k = 0; k < numberTransports; k++) {
     slopesTransportLocal1[k] = -slopesTransportLocal1[k];
-    bufferCellRight->getTransport(k).extrapolate(slopesTransportLocal1[k], distanceDroite);
+    bufferCellRight->getTransport(k).copyAndExtrapolate(m_cellRight->getTransport(k, typeRight), slopesTransportLocal1[k], distanceDroite);
   }
   //THINC method (for alpha only)
   if (globalVolumeFractionLimiter.AmITHINC() || interfaceVolumeFractionLimiter.AmITHINC()) {
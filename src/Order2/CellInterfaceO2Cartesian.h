@@ -32,6 +32,7 @@
 #define CELLINTERFACEO2CARTESIAN_H
 
 #include "CellInterfaceO2.h"
+#include "PackedSlopes.h"
 
 class CellInterfaceO2Cartesian : public CellInterfaceO2
 {
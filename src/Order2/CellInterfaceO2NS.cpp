@@ -17,10 +17,6 @@ void CellInterfaceO2NS::solveRiemann(double& dtMax,
                                      Limiter& /*interfaceVolumeFractionLimiter*/,
                                      Prim type)
 {
-  // Initialize buffer cells used in Riemann problem
-  bufferCellLeft->copyVec(m_cellLeft->getPhases(type), m_cellLeft->getMixture(type), m_cellLeft->getTransports(type));
-  bufferCellRight->copyVec(m_cellRight->getPhases(type), m_cellRight->getMixture(type), m_cellRight->getTransports(type));
-
   // For NS extrapolation a scalar product between the distance
   // Coord rij and the gradient is already done during CellO2NS::computeLocalSlopes
   // and stored in slopesPhase/MixtureLocal1
@@ -28,28 +24,29 @@ void CellInterfaceO2NS::solveRiemann(double& dtMax,
   double distanceLeft  = 1.0;
   double distanceRight = 1.0;
 
-  // Left side of interface extrapolation
+  // Left side of interface extrapolation, directly written in the buffer cells used in Riemann problem
   m_cellLeft->computeLocalSlopes(*this); // Build slopesPhasesLocal1 = theta_i * rij . grad(Wi)
   for (int k = 0; k < numberPhases; k++) {
-    bufferCellLeft->getPhase(k)->extrapolate(*slopesPhasesLocal1[k], distanceLeft); // Build Wij_lim = Wi + theta_i * rij . grad(Wi)
+    // Build Wij_lim = Wi + theta_i * rij . grad(Wi)
+    bufferCellLeft->getPhase(k)->copyAndExtrapolate(*m_cellLeft->getPhase(k, type), *slopesPhasesLocal1[k], distanceLeft);
     bufferCellLeft->getPhase(k)->verifyAndCorrectPhase();
     bufferCellLeft->getPhase(k)->verifyAndCorrectDensityMax();
   }
-  bufferCellLeft->getMixture()->extrapolate(*slopesMixtureLocal1, distanceLeft);
+  bufferCellLeft->getMixture()->copyAndExtrapolate(*m_cellLeft->getMixture(type), *slopesMixtureLocal1, distanceLeft);
   for (int k = 0; k < numberTransports; k++) {
-    bufferCellLeft->getTransport(k).extrapolate(slopesTransportLocal1[k], distanceLeft);
+    bufferCellLeft->getTransport(k).copyAndExtrapolate(m_cellLeft->getTransport(k, type), slopesTransportLocal1[k], distanceLeft);
   }
 
   // Right side of interface extrapolation
   m_cellRight->computeLocalSlopes(*this);
   for (int k = 0; k < numberPhases; k++) {
-    bufferCellRight->getPhase(k)->extrapolate(*slopesPhasesLocal1[k], distanceRight);
+    bufferCellRight->getPhase(k)->copyAndExtrapolate(*m_cellRight->getPhase(k, type), *slopesPhasesLocal1[k], distanceRight);
     bufferCellRight->getPhase(k)->verifyAndCorrectPhase();
     bufferCellRight->getPhase(k)->verifyAndCorrectDensityMax();
   }
-  bufferCellRight->getMixture()->extrapolate(*slopesMixtureLocal1, distanceRight);
+  bufferCellRight->getMixture()->copyAndExtrapolate(*m_cellRight->getMixture(type), *slopesMixtureLocal1, distanceRight);
   for (int k = 0; k < numberTransports; k++) {
-    bufferCellRight->getTransport(k).extrapolate(slopesTransportLocal1[k], distanceRight);
+    bufferCellRight->getTransport(k).copyAndExtrapolate(m_cellRight->getTransport(k, type), slopesTransportLocal1[k], distanceRight);
   }
 
   // Compute extended variables since projection change some of them (Phases, Mixture, AddPhys)
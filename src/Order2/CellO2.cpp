@@ -31,6 +31,8 @@
 #include "CellO2.h"
 #include "../Models/Phase.h"
 
+bool predictionVariablesO2 = true;
+
 //***********************************************************************
 
 CellO2::CellO2() : Cell(), m_vecPhasesO2(0), m_mixtureO2(0), m_vecTransportsO2(0), m_consSauvegarde(0), m_consTransportsSauvegarde(0) {}
@@ -59,25 +61,32 @@ CellO2::~CellO2()
 
 void CellO2::allocate(const std::vector<AddPhys*>& addPhys)
 {
-  m_vecPhases   = new Phase*[numberPhases];
-  m_vecPhasesO2 = new Phase*[numberPhases];
+  m_vecPhases = new Phase*[numberPhases];
   for (int k = 0; k < numberSolids; k++) {
     model->allocatePhaseSolid(&m_vecPhases[k]);
-    model->allocatePhaseSolid(&m_vecPhasesO2[k]);
   }
   for (int k = numberSolids; k < numberPhases; k++) {
     model->allocatePhase(&m_vecPhases[k]);
-    model->allocatePhase(&m_vecPhasesO2[k]);
   }
   model->allocateMixture(&m_mixture);
-  model->allocateMixture(&m_mixtureO2);
   model->allocateCons(&m_cons);
   model->allocateCons(&m_consSauvegarde);
   if (numberTransports > 0) {
     m_vecTransports            = new Transport[numberTransports];
     m_consTransports           = new Transport[numberTransports];
     m_consTransportsSauvegarde = new Transport[numberTransports];
-    m_vecTransportsO2          = new Transport[numberTransports];
+  }
+  //Predicted variables are only needed by the MUSCL-Hancock predictor (Runge-Kutta stages work on vecPhases)
+  if (predictionVariablesO2) {
+    m_vecPhasesO2 = new Phase*[numberPhases];
+    for (int k = 0; k < numberSolids; k++) {
+      model->allocatePhaseSolid(&m_vecPhasesO2[k]);
+    }
+    for (int k = numberSolids; k < numberPhases; k++) {
+      model->allocatePhase(&m_vecPhasesO2[k]);
+    }
+    model->allocateMixture(&m_mixtureO2);
+    if (numberTransports > 0) m_vecTransportsO2 = new Transport[numberTransports];
   }
   for (unsigned int k = 0; k < addPhys.size(); k++) {
     addPhys[k]->addQuantityAddPhys(this);
@@ -89,7 +98,7 @@ void CellO2::allocate(const std::vector<AddPhys*>& addPhys)
 void CellO2::copyPhase(const int& phaseNumber, Phase* phase)
 {
   m_vecPhases[phaseNumber]->copyPhase(*phase);
-  m_vecPhasesO2[phaseNumber]->copyPhase(*phase);
+  if (m_vecPhasesO2) m_vecPhasesO2[phaseNumber]->copyPhase(*phase);
 }
 
 //***********************************************************************
@@ -134,6 +143,39 @@ void CellO2::predictionOrdre2(const double& dt, Symmetry* symmetry)
 
 //***********************************************************************
 
+void CellO2::timeEvolutionRungeKutta(const double& dt, Symmetry* symmetry, const double& coefUn, const double& coefStage)
+{
+  //The stage is written as an increment on U(i-1): U(i) = U(i-1) + coefUn * (Un - U(i-1)) + coefStage * dt * L(U(i-1)),
+  //so that the scheme correction of non-conservative models applies as for a forward Euler step
+  // clang-format off
+  symmetry->addSymmetricTerms(this);        //m_cons (sum of fluxes) is incremented by the cylindrical or spherical symmetric terms from U(i-1)
+  m_cons->multiply(coefStage * dt);         //m_cons is multiplied by coefStage * dt
+  if (coefUn != 0.) {
+    fluxBuff->setCons(m_consSauvegarde);    //fluxBuff receives Un, saved at the first stage
+    m_cons->addFlux(coefUn);
+  }
+  m_cons->setBufferFlux(*this);             //fluxBuff receives conservative variables of the previous stage: U(i-1)
+  if (coefUn != 0.) {
+    m_cons->subtractFlux(coefUn);
+  }
+  else {
+    m_consSauvegarde->setCons(fluxBuff);    //First stage: Un is kept in the save register (free without AMR)
+  }
+  m_cons->schemeCorrection(*this);          //Specific correction for non-conservative models (using U(i-1) in fluxBuff and increment in m_cons)
+  m_cons->addFlux(1.);                      //Adding the buffer fluxBuff (U(i-1)) to obtain U(i) in m_cons
+  // clang-format on
+
+  //Same process for transport
+  for (int k = 0; k < numberTransports; k++) {
+    if (coefUn == 0.) m_consTransportsSauvegarde[k].setValue(m_vecTransports[k].getValue());
+    m_consTransports[k].multiply(coefStage * dt);
+    m_vecTransports[k].setValue(coefUn * m_consTransportsSauvegarde[k].getValue() + (1. - coefUn) * m_vecTransports[k].getValue() +
+                                m_consTransports[k].getValue());
+  }
+}
+
+//***********************************************************************
+
 void CellO2::correctionEnergy(Prim type)
 {
   switch (type) {
@@ -142,7 +184,7 @@ void CellO2::correctionEnergy(Prim type)
     m_cons->correctionEnergy(this);                                 //Pressure correction
     break;
   case vecPhasesO2:                                                   //Used during prediction step
-    m_mixtureO2->totalEnergyToInternalEnergy(m_vecQuantitiesAddPhys); //Building specific internal energy from totale one
+    this->getMixture(vecPhasesO2)->totalEnergyToInternalEnergy(m_vecQuantitiesAddPhys); //Building specific internal energy from totale one
     m_cons->correctionEnergy(this, vecPhasesO2);
     break;
   default:
@@ -169,7 +211,7 @@ void CellO2::fulfillState(Prim type)
     //  - Relaxation or correction: The total energy doesn't have to be updated there.
     break;
   case vecPhasesO2: //Only usefull for the prediction step after relaxations and the parallel with second order
-    model->fulfillState(m_vecPhasesO2, m_mixtureO2);
+    model->fulfillState(this->getPhases(vecPhasesO2), this->getMixture(vecPhasesO2));
     break;
   default:
     break;
@@ -185,7 +227,7 @@ Phase* CellO2::getPhase(const int& phaseNumber, Prim type) const
     return m_vecPhases[phaseNumber];
     break;
   case vecPhasesO2:
-    return m_vecPhasesO2[phaseNumber];
+    return m_vecPhasesO2 ? m_vecPhasesO2[phaseNumber] : m_vecPhases[phaseNumber];
     break;
   default:
     return 0;
@@ -202,7 +244,7 @@ Phase** CellO2::getPhases(Prim type) const
     return m_vecPhases;
     break;
   case vecPhasesO2:
-    return m_vecPhasesO2;
+    return m_vecPhasesO2 ? m_vecPhasesO2 : m_vecPhases;
     break;
   default:
     return 0;
@@ -219,7 +261,7 @@ Mixture* CellO2::getMixture(Prim type) const
     return m_mixture;
     break;
   case vecPhasesO2:
-    return m_mixtureO2;
+    return m_mixtureO2 ? m_mixtureO2 : m_mixture;
     break;
   default:
     return 0;
@@ -236,7 +278,7 @@ Transport& CellO2::getTransport(const int& numTransport, Prim type) const
     return m_vecTransports[numTransport];
     break;
   case vecPhasesO2:
-    return m_vecTransportsO2[numTransport];
+    return m_vecTransportsO2 ? m_vecTransportsO2[numTransport] : m_vecTransports[numTransport];
     break;
   default:
     return m_vecTransports[numTransport];
@@ -253,7 +295,7 @@ Transport* CellO2::getTransports(Prim type) const
     return m_vecTransports;
     break;
   case vecPhasesO2:
-    return m_vecTransportsO2;
+    return m_vecTransportsO2 ? m_vecTransportsO2 : m_vecTransports;
     break;
   default:
     return 0;
@@ -270,7 +312,7 @@ void CellO2::setTransport(double value, int& numTransport, Prim type)
     m_vecTransports[numTransport].setValue(value);
     break;
   case vecPhasesO2:
-    m_vecTransportsO2[numTransport].setValue(value);
+    this->getTransport(numTransport, vecPhasesO2).setValue(value);
     break;
   default:
     break;
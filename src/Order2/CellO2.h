@@ -45,6 +45,7 @@ class CellO2 : public Cell
     void saveCons() override;
     void getBackCons() override;
     void predictionOrdre2(const double& dt, Symmetry* symmetry) override;
+    void timeEvolutionRungeKutta(const double& dt, Symmetry* symmetry, const double& coefUn, const double& coefStage) override;
     void correctionEnergy(Prim type = vecPhases) override;
     void fulfillState(Prim type = vecPhases) override;
 
@@ -120,4 +121,6 @@ class CellO2 : public Cell
   private:
 };
 
+extern bool predictionVariablesO2; /*!< Allocation of the predicted variables (MUSCL-Hancock), vecPhasesO2 falls back on vecPhases otherwise */
+
 #endif // CELLO2_H
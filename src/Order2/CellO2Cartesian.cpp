@@ -215,22 +215,12 @@ void CellO2Cartesian::computeLocalSlopes(CellInterface& cellInterfaceRef,
   //Detection of the interface location
   if ((alphaCell >= epsInterface) && (alphaCell <= 1. - epsInterface) &&
       ((alphaCellOtherInterfaceSide - alphaCell) * (alphaCell - alphaCellAfterOppositeSide) >= 1.e-8)) {
-    for (int k = 0; k < numberPhases; k++) {
-      slopesPhasesLocal1[k]->limitSlopes(*slopesPhasesLocal1[k], *slopesPhasesLocal2[k], interfaceLimiter, interfaceVolumeFractionLimiter);
-    }
-    slopesMixtureLocal1->limitSlopes(*slopesMixtureLocal1, *slopesMixtureLocal2, interfaceLimiter);
-    for (int k = 0; k < numberTransports; k++) {
-      slopesTransportLocal1[k] = interfaceVolumeFractionLimiter.limiteSlope(slopesTransportLocal1[k], slopesTransportLocal2[k]);
-    }
+    packedSlopesLocal.limitSlopes(slopesPhasesLocal1, slopesMixtureLocal1, slopesTransportLocal1, slopesPhasesLocal2, slopesMixtureLocal2,
+                                  slopesTransportLocal2, interfaceLimiter, interfaceVolumeFractionLimiter);
   }
   else {
-    for (int k = 0; k < numberPhases; k++) {
-      slopesPhasesLocal1[k]->limitSlopes(*slopesPhasesLocal1[k], *slopesPhasesLocal2[k], globalLimiter, globalVolumeFractionLimiter);
-    }
-    slopesMixtureLocal1->limitSlopes(*slopesMixtureLocal1, *slopesMixtureLocal2, globalLimiter);
-    for (int k = 0; k < numberTransports; k++) {
-      slopesTransportLocal1[k] = globalVolumeFractionLimiter.limiteSlope(slopesTransportLocal1[k], slopesTransportLocal2[k]);
-    }
+    packedSlopesLocal.limitSlopes(slopesPhasesLocal1, slopesMixtureLocal1, slopesTransportLocal1, slopesPhasesLocal2, slopesMixtureLocal2,
+                                  slopesTransportLocal2, globalLimiter, globalVolumeFractionLimiter);
   }
 }
 
@@ -351,22 +341,12 @@ void CellO2Cartesian::computeLocalSlopesLimite(CellInterface& cellInterfaceRef,
   //Detection of the interface location
   int phase0(0);
   if ((m_vecPhases[phase0]->getAlpha() >= epsInterface) && (m_vecPhases[phase0]->getAlpha() <= 1. - epsInterface)) {
-    for (int k = 0; k < numberPhases; k++) {
-      slopesPhasesLocal1[k]->limitSlopes(*slopesPhasesLocal1[k], *slopesPhasesLocal2[k], interfaceLimiter, interfaceVolumeFractionLimiter);
-    }
-    slopesMixtureLocal1->limitSlopes(*slopesMixtureLocal1, *slopesMixtureLocal2, interfaceLimiter);
-    for (int k = 0; k < numberTransports; k++) {
-      slopesTransportLocal1[k] = interfaceVolumeFractionLimiter.limiteSlope(slopesTransportLocal1[k], slopesTransportLocal2[k]);
-    }
+    packedSlopesLocal.limitSlopes(slopesPhasesLocal1, slopesMixtureLocal1, slopesTransportLocal1, slopesPhasesLocal2, slopesMixtureLocal2,
+                                  slopesTransportLocal2, interfaceLimiter, interfaceVolumeFractionLimiter);
   }
   else {
-    for (int k = 0; k < numberPhases; k++) {
-      slopesPhasesLocal1[k]->limitSlopes(*slopesPhasesLocal1[k], *slopesPhasesLocal2[k], globalLimiter, globalVolumeFractionLimiter);
-    }
-    slopesMixtureLocal1->limitSlopes(*slopesMixtureLocal1, *slopesMixtureLocal2, globalLimiter);
-    for (int k = 0; k < numberTransports; k++) {
-      slopesTransportLocal1[k] = globalVolumeFractionLimiter.limiteSlope(slopesTransportLocal1[k], slopesTransportLocal2[k]);
-    }
+    packedSlopesLocal.limitSlopes(slopesPhasesLocal1, slopesMixtureLocal1, slopesTransportLocal1, slopesPhasesLocal2, slopesMixtureLocal2,
+                                  slopesTransportLocal2, globalLimiter, globalVolumeFractionLimiter);
   }
 }
 
@@ -56,6 +56,7 @@ CellO2GhostCartesian::~CellO2GhostCartesian()
 
 void CellO2GhostCartesian::deleteSlopes(int s)
 {
+  MemoryStats::Redirection slopes(MEMSLOPES);
   for (int k = 0; k < numberPhases; k++) {
     delete m_vecPhasesSlopesGhost[s][k];
   }
@@ -96,6 +97,7 @@ void CellO2GhostCartesian::allocate(const std::vector<AddPhys*>& addPhys)
   CellO2::allocate(addPhys);
 
   // Allocation des slopes fantomes, specifique aux limites paralleles
+  MemoryStats::Redirection slopes(MEMSLOPES); //Slope objects are accounted apart from the phases and mixtures of the cells
   for (unsigned int s = 0; s < m_vecPhasesSlopesGhost.size(); s++) {
     m_vecPhasesSlopesGhost[s] = new Phase*[numberPhases];
     for (int k = 0; k < numberSolids; k++) {
@@ -222,22 +224,12 @@ void CellO2GhostCartesian::computeLocalSlopes(CellInterface& cellInterfaceRef,
 
   if ((alphaCell >= epsInterface) && (alphaCell <= 1. - epsInterface) &&
       ((alphaCellOtherInterfaceSide - alphaCell) * (alphaCell - alphaCellAfterOppositeSide) >= 1.e-8)) {
-    for (int k = 0; k < numberPhases; k++) {
-      slopesPhasesLocal1[k]->limitSlopes(*slopesPhasesLocal1[k], *m_vecPhasesSlopesGhost[s][k], interfaceLimiter, interfaceVolumeFractionLimiter);
-    }
-    slopesMixtureLocal1->limitSlopes(*slopesMixtureLocal1, *m_mixtureSlopesGhost[s], interfaceLimiter);
-    for (int k = 0; k < numberTransports; k++) {
-      slopesTransportLocal1[k] = interfaceVolumeFractionLimiter.limiteSlope(slopesTransportLocal1[k], m_vecTransportsSlopesGhost[s][k]);
-    }
+    packedSlopesLocal.limitSlopes(slopesPhasesLocal1, slopesMixtureLocal1, slopesTransportLocal1, m_vecPhasesSlopesGhost[s], m_mixtureSlopesGhost[s],
+                                  m_vecTransportsSlopesGhost[s], interfaceLimiter, interfaceVolumeFractionLimiter);
   }
   else {
-    for (int k = 0; k < numberPhases; k++) {
-      slopesPhasesLocal1[k]->limitSlopes(*slopesPhasesLocal1[k], *m_vecPhasesSlopesGhost[s][k], globalLimiter, globalVolumeFractionLimiter);
-    }
-    slopesMixtureLocal1->limitSlopes(*slopesMixtureLocal1, *m_mixtureSlopesGhost[s], globalLimiter);
-    for (int k = 0; k < numberTransports; k++) {
-      slopesTransportLocal1[k] = globalVolumeFractionLimiter.limiteSlope(slopesTransportLocal1[k], m_vecTransportsSlopesGhost[s][k]);
-    }
+    packedSlopesLocal.limitSlopes(slopesPhasesLocal1, slopesMixtureLocal1, slopesTransportLocal1, m_vecPhasesSlopesGhost[s], m_mixtureSlopesGhost[s],
+                                  m_vecTransportsSlopesGhost[s], globalLimiter, globalVolumeFractionLimiter);
   }
 }
 
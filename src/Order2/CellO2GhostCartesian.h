@@ -42,6 +42,13 @@ class CellO2GhostCartesian : public CellO2Cartesian
     CellO2GhostCartesian(int lvl); //Pour AMR
     ~CellO2GhostCartesian() override;
 
+    //! \brief     Ghost cells are accounted apart from the computational cells
+    static void* operator new(std::size_t size) { return MemoryStats::allocate(MemoryStats::redirect(MEMGHOSTCELLS), size); }
+    static void operator delete(void* pointer, std::size_t size)
+    {
+      MemoryStats::deallocate(MemoryStats::redirect(MEMGHOSTCELLS), pointer, size);
+    }
+
     virtual void deleteSlopes(int s);
     void pushBackSlope() override;
     void popBackSlope() override;
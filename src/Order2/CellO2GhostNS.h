@@ -39,6 +39,13 @@ class CellO2GhostNS : public CellO2NS
     CellO2GhostNS();
     ~CellO2GhostNS() override;
 
+    //! \brief     Ghost cells are accounted apart from the computational cells
+    static void* operator new(std::size_t size) { return MemoryStats::allocate(MemoryStats::redirect(MEMGHOSTCELLS), size); }
+    static void operator delete(void* pointer, std::size_t size)
+    {
+      MemoryStats::deallocate(MemoryStats::redirect(MEMGHOSTCELLS), pointer, size);
+    }
+
     int getRankOfNeighborCPU() const override;
     void setRankOfNeighborCPU(int rank) override;
 
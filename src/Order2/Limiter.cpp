@@ -40,6 +40,15 @@ Limiter::~Limiter() {}
 
 //***********************************************************************
 
+void Limiter::limiteSlopes(double* slopes, const double* neighbourSlopes, const int& size)
+{
+  for (int i = 0; i < size; i++) {
+    slopes[i] = this->limiteSlope(slopes[i], neighbourSlopes[i]);
+  }
+}
+
+//***********************************************************************
+
 double Limiter::computeGradientLimiter(double val, double min, double max, double slope) const
 {
   double eps(1.e-6);
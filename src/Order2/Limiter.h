@@ -45,6 +45,11 @@ class Limiter
       Errors::errorMessage("Unknown limiter");
       return 0.;
     };
+    //! \brief  Limit an array of slopes with the neighbouring ones (slopes[i] = limiteSlope(slopes[i], neighbourSlopes[i]))
+    //! \param  slopes           slopes to limit, replaced by the limited slopes
+    //! \param  neighbourSlopes  neighbouring slopes
+    //! \param  size             number of slopes
+    virtual void limiteSlopes(double* slopes, const double* neighbourSlopes, const int& size);
     virtual bool AmITHINC() { return false; }
 
     virtual double computeGradientLimiter(double val, double min, double max, double slope) const;
@@ -55,4 +60,12 @@ class Limiter
     LimiterType m_limType; //!< Type of second-order limiter (NS only)
 };
 
+//! \brief  Batched limitation kernel of the limiter L, whose static function L::limit is branch free so that the loop vectorizes
+template <class L> inline void limiteSlopesKernel(double* slopes, const double* neighbourSlopes, const int& size)
+{
+  for (int i = 0; i < size; i++) {
+    slopes[i] = L::limit(slopes[i], neighbourSlopes[i]);
+  }
+}
+
 #endif // LIMITER_H
@@ -38,18 +38,3 @@ LimiterMC::LimiterMC() {}
 
 LimiterMC::~LimiterMC() {}
 
-//***********************************************************************
-
-double LimiterMC::limiteSlope(const double& slope1, const double& slope2)
-{
-  double zero(1e-9);
-  double slope(0.), produit(slope1 * slope2);
-  if (produit > zero) {
-    slope = std::min(2. * std::fabs(slope1), 2. * std::fabs(slope2));
-    slope = std::min(slope, 0.5 * (std::fabs(slope1) + std::fabs(slope2)));
-  }
-  if (slope1 < 0.) {
-    slope = -slope;
-  }
-  return slope;
-}
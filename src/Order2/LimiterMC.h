@@ -39,7 +39,20 @@ class LimiterMC : public Limiter
     LimiterMC();
     ~LimiterMC() override;
 
-    double limiteSlope(const double& slope1, const double& slope2) override;
+    double limiteSlope(const double& slope1, const double& slope2) override { return limit(slope1, slope2); }
+    void limiteSlopes(double* slopes, const double* neighbourSlopes, const int& size) override
+    {
+      limiteSlopesKernel<LimiterMC>(slopes, neighbourSlopes, size);
+    }
+
+    //! \brief  Branch-free MC limitation of slope1 with slope2
+    static double limit(const double& slope1, const double& slope2)
+    {
+      double slope(std::min(2. * std::fabs(slope1), 2. * std::fabs(slope2)));
+      slope = std::min(slope, 0.5 * (std::fabs(slope1) + std::fabs(slope2)));
+      slope = (slope1 * slope2 > 1.e-9) ? slope : 0.;
+      return (slope1 < 0.) ? -slope : slope;
+    }
 };
 
 #endif // LIMITERMC_H
@@ -39,7 +39,19 @@ class LimiterMinmod : public Limiter
     LimiterMinmod();
     ~LimiterMinmod() override;
 
-    double limiteSlope(const double& slope1, const double& slope2) override;
+    double limiteSlope(const double& slope1, const double& slope2) override { return limit(slope1, slope2); }
+    void limiteSlopes(double* slopes, const double* neighbourSlopes, const int& size) override
+    {
+      limiteSlopesKernel<LimiterMinmod>(slopes, neighbourSlopes, size);
+    }
+
+    //! \brief  Branch-free Minmod limitation of slope1 with slope2
+    static double limit(const double& slope1, const double& slope2)
+    {
+      double slope(std::min(std::fabs(slope1), std::fabs(slope2)));
+      slope = (slope1 < 0.) ? -slope : slope;
+      return (slope1 * slope2 > 1.e-9) ? slope : 0.;
+    }
 };
 
 #endif // LIMITERMINMOD_H
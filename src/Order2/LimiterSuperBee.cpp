@@ -38,17 +38,3 @@ LimiterSuperBee::LimiterSuperBee() : Limiter() { m_limType = LimiterType::SUPERB
 
 LimiterSuperBee::~LimiterSuperBee() {}
 
-//***********************************************************************
-
-double LimiterSuperBee::limiteSlope(const double& slope1, const double& slope2)
-{
-  double zero(1e-6);
-  double slope(0.), produit(slope1 * slope2);
-  if (produit > zero) {
-    slope = std::max(std::min(2. * std::fabs(slope1), std::fabs(slope2)), std::min(std::fabs(slope1), 2. * std::fabs(slope2)));
-  }
-  if (slope1 < 0.) {
-    slope = -slope;
-  }
-  return slope;
-}
@@ -39,7 +39,19 @@ class LimiterSuperBee : public Limiter
     LimiterSuperBee();
     ~LimiterSuperBee() override;
 
-    double limiteSlope(const double& slope1, const double& slope2) override;
+    double limiteSlope(const double& slope1, const double& slope2) override { return limit(slope1, slope2); }
+    void limiteSlopes(double* slopes, const double* neighbourSlopes, const int& size) override
+    {
+      limiteSlopesKernel<LimiterSuperBee>(slopes, neighbourSlopes, size);
+    }
+
+    //! \brief  Branch-free SuperBee limitation of slope1 with slope2
+    static double limit(const double& slope1, const double& slope2)
+    {
+      double slope(std::max(std::min(2. * std::fabs(slope1), std::fabs(slope2)), std::min(std::fabs(slope1), 2. * std::fabs(slope2))));
+      slope = (slope1 * slope2 > 1.e-6) ? slope : 0.;
+      return (slope1 < 0.) ? -slope : slope;
+    }
 };
 
 #endif // LIMITERSUPERBEE_H
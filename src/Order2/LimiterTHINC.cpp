@@ -38,18 +38,3 @@ LimiterTHINC::LimiterTHINC() {}
 
 LimiterTHINC::~LimiterTHINC() {}
 
-//***********************************************************************
-
-double LimiterTHINC::limiteSlope(const double& slope1, const double& slope2)
-{
-  //THINC limiter limits as Minmod limiter if it is not at the interface
-  double zero(1e-9);
-  double slope(0.), produit(slope1 * slope2);
-  if (produit > zero) {
-    slope = std::min(std::fabs(slope1), std::fabs(slope2));
-    if (slope1 < 0) {
-      slope = -slope;
-    }
-  }
-  return slope;
-}
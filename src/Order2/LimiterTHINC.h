@@ -31,7 +31,7 @@
 #ifndef LIMITERTHINC_H
 #define LIMITERTHINC_H
 
-#include "Limiter.h"
+#include "LimiterMinmod.h"
 
 class LimiterTHINC : public Limiter
 {
@@ -39,7 +39,12 @@ class LimiterTHINC : public Limiter
     LimiterTHINC();
     ~LimiterTHINC() override;
 
-    double limiteSlope(const double& slope1, const double& slope2) override;
+    //! \brief  THINC limiter limits as Minmod limiter if it is not at the interface
+    double limiteSlope(const double& slope1, const double& slope2) override { return LimiterMinmod::limit(slope1, slope2); }
+    void limiteSlopes(double* slopes, const double* neighbourSlopes, const int& size) override
+    {
+      limiteSlopesKernel<LimiterMinmod>(slopes, neighbourSlopes, size);
+    }
     bool AmITHINC() override { return true; }
 };
 
@@ -38,14 +38,3 @@ LimiterVanAlbada::LimiterVanAlbada() {}
 
 LimiterVanAlbada::~LimiterVanAlbada() {}
 
-//***********************************************************************
-
-double LimiterVanAlbada::limiteSlope(const double& slope1, const double& slope2)
-{
-  double zero(1e-6);
-  double slope(0.), produit(slope1 * slope2), sum(slope1 + slope2);
-  if ((std::fabs(slope1) > zero) && (std::fabs(slope2) > zero) && (std::fabs(sum) > zero) && (produit > zero)) {
-    slope = produit * sum / (slope1 * slope1 + slope2 * slope2);
-  }
-  return slope;
-}
@@ -39,7 +39,19 @@ class LimiterVanAlbada : public Limiter
     LimiterVanAlbada();
     ~LimiterVanAlbada() override;
 
-    double limiteSlope(const double& slope1, const double& slope2) override;
+    double limiteSlope(const double& slope1, const double& slope2) override { return limit(slope1, slope2); }
+    void limiteSlopes(double* slopes, const double* neighbourSlopes, const int& size) override
+    {
+      limiteSlopesKernel<LimiterVanAlbada>(slopes, neighbourSlopes, size);
+    }
+
+    //! \brief  Branch-free VanAlbada limitation of slope1 with slope2
+    static double limit(const double& slope1, const double& slope2)
+    {
+      double produit(slope1 * slope2), sum(slope1 + slope2);
+      double slope(produit * sum / (slope1 * slope1 + slope2 * slope2));
+      return ((std::fabs(slope1) > 1.e-6) && (std::fabs(slope2) > 1.e-6) && (std::fabs(sum) > 1.e-6) && (produit > 1.e-6)) ? slope : 0.;
+    }
 };
 
 #endif // LIMITERVANALBADA_H
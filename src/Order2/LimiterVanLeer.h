@@ -39,7 +39,19 @@ class LimiterVanLeer : public Limiter
     LimiterVanLeer();
     ~LimiterVanLeer() override;
 
-    double limiteSlope(const double& slope1, const double& slope2) override;
+    double limiteSlope(const double& slope1, const double& slope2) override { return limit(slope1, slope2); }
+    void limiteSlopes(double* slopes, const double* neighbourSlopes, const int& size) override
+    {
+      limiteSlopesKernel<LimiterVanLeer>(slopes, neighbourSlopes, size);
+    }
+
+    //! \brief  Branch-free VanLeer limitation of slope1 with slope2
+    static double limit(const double& slope1, const double& slope2)
+    {
+      double produit(slope1 * slope2), sum(slope1 + slope2);
+      double slope(2. * produit / sum);
+      return ((std::fabs(sum) > 1.e-6) && (produit > 1.e-6)) ? slope : 0.;
+    }
 };
 
 #endif // LIMITERVANLEER_H
@@ -0,0 +1,134 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#include "PackedSlopes.h"
+
+PackedSlopes packedSlopesLocal;
+
+//***********************************************************************
+
+PackedSlopes::PackedSlopes() {}
+
+//***********************************************************************
+
+PackedSlopes::~PackedSlopes() {}
+
+//***********************************************************************
+
+void PackedSlopes::initialize(Phase** slopesPhases, Mixture* slopesMixture)
+{
+  m_volumeFractionIndexes.clear();
+  m_otherIndexes.clear();
+  int index(0);
+  for (int k = 0; k < numberPhases; k++) {
+    int numberSlopes(slopesPhases[k]->numberOfTransmittedSlopes());
+    int numberVolumeFractionSlopes(slopesPhases[k]->numberOfVolumeFractionSlopes());
+    for (int i = 0; i < numberSlopes; i++) {
+      if (i < numberVolumeFractionSlopes) {
+        m_volumeFractionIndexes.push_back(index++);
+      }
+      else {
+        m_otherIndexes.push_back(index++);
+      }
+    }
+  }
+  for (int i = 0; i < slopesMixture->numberOfTransmittedSlopes(); i++) {
+    m_otherIndexes.push_back(index++);
+  }
+
+  m_packed1.assign(index, 0.);
+  m_packed2.assign(index, 0.);
+  m_volumeFractionSlopes1.assign(m_volumeFractionIndexes.size() + numberTransports, 0.);
+  m_volumeFractionSlopes2.assign(m_volumeFractionIndexes.size() + numberTransports, 0.);
+  m_otherSlopes1.assign(m_otherIndexes.size(), 0.);
+  m_otherSlopes2.assign(m_otherIndexes.size(), 0.);
+}
+
+//***********************************************************************
+
+void PackedSlopes::limitSlopes(Phase** slopesPhases1,
+                               Mixture* slopesMixture1,
+                               double* slopesTransport1,
+                               Phase** slopesPhases2,
+                               Mixture* slopesMixture2,
+                               const double* slopesTransport2,
+                               Limiter& limiter,
+                               Limiter& volumeFractionLimiter)
+{
+  //1) Packing of phases and mixture slopes
+  //---------------------------------------
+  int counter1(-1), counter2(-1);
+  for (int k = 0; k < numberPhases; k++) {
+    slopesPhases1[k]->fillBufferSlopes(m_packed1.data(), counter1);
+    slopesPhases2[k]->fillBufferSlopes(m_packed2.data(), counter2);
+  }
+  slopesMixture1->fillBufferSlopes(m_packed1.data(), counter1);
+  slopesMixture2->fillBufferSlopes(m_packed2.data(), counter2);
+
+  //2) Gathering per limiter
+  //------------------------
+  int numberVolumeFractions(m_volumeFractionIndexes.size()), numberOthers(m_otherIndexes.size());
+  for (int i = 0; i < numberVolumeFractions; i++) {
+    m_volumeFractionSlopes1[i] = m_packed1[m_volumeFractionIndexes[i]];
+    m_volumeFractionSlopes2[i] = m_packed2[m_volumeFractionIndexes[i]];
+  }
+  for (int k = 0; k < numberTransports; k++) {
+    m_volumeFractionSlopes1[numberVolumeFractions + k] = slopesTransport1[k];
+    m_volumeFractionSlopes2[numberVolumeFractions + k] = slopesTransport2[k];
+  }
+  for (int i = 0; i < numberOthers; i++) {
+    m_otherSlopes1[i] = m_packed1[m_otherIndexes[i]];
+    m_otherSlopes2[i] = m_packed2[m_otherIndexes[i]];
+  }
+
+  //3) One batched limitation per limiter
+  //-------------------------------------
+  volumeFractionLimiter.limiteSlopes(m_volumeFractionSlopes1.data(), m_volumeFractionSlopes2.data(), numberVolumeFractions + numberTransports);
+  limiter.limiteSlopes(m_otherSlopes1.data(), m_otherSlopes2.data(), numberOthers);
+
+  //4) Scattering and unpacking of the limited slopes
+  //-------------------------------------------------
+  for (int i = 0; i < numberVolumeFractions; i++) {
+    m_packed1[m_volumeFractionIndexes[i]] = m_volumeFractionSlopes1[i];
+  }
+  for (int k = 0; k < numberTransports; k++) {
+    slopesTransport1[k] = m_volumeFractionSlopes1[numberVolumeFractions + k];
+  }
+  for (int i = 0; i < numberOthers; i++) {
+    m_packed1[m_otherIndexes[i]] = m_otherSlopes1[i];
+  }
+  counter1 = -1;
+  for (int k = 0; k < numberPhases; k++) {
+    slopesPhases1[k]->getBufferSlopes(m_packed1.data(), counter1);
+  }
+  slopesMixture1->getBufferSlopes(m_packed1.data(), counter1);
+}
+
+//***********************************************************************
@@ -0,0 +1,79 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef PACKEDSLOPES_H
+#define PACKEDSLOPES_H
+
+#include "../Models/Phase.h"
+#include "../Models/Mixture.h"
+
+//! \class     PackedSlopes
+//! \brief     Batched limitation of the local slopes of a Cartesian cell
+//! \details   The slopes of phases and mixture are packed with fillBufferSlopes, then gathered per limiter: volume fractions and
+//!            transports on one side, the other variables on the other. Each limiter is thus applied by a single batched call
+//!            (see Limiter::limiteSlopes) instead of one virtual call per variable.
+class PackedSlopes
+{
+  public:
+    PackedSlopes();
+    ~PackedSlopes();
+
+    //! \brief  Build the layout of the packed slopes
+    //! \param  slopesPhases    slopes of phases (only used for the phase types)
+    //! \param  slopesMixture   slopes of mixture (only used for the mixture type)
+    void initialize(Phase** slopesPhases, Mixture* slopesMixture);
+    //! \brief  Limit slopes 1 with slopes 2 (equivalent to Phase::limitSlopes, Mixture::limitSlopes and Limiter::limiteSlope on transports)
+    //! \param  slopesPhases1, slopesMixture1, slopesTransport1   slopes to limit, replaced by the limited slopes
+    //! \param  slopesPhases2, slopesMixture2, slopesTransport2   neighbouring slopes
+    //! \param  limiter                 limiter of the variables other than the volume fractions and transports
+    //! \param  volumeFractionLimiter   limiter of the volume fractions and transports
+    void limitSlopes(Phase** slopesPhases1,
+                     Mixture* slopesMixture1,
+                     double* slopesTransport1,
+                     Phase** slopesPhases2,
+                     Mixture* slopesMixture2,
+                     const double* slopesTransport2,
+                     Limiter& limiter,
+                     Limiter& volumeFractionLimiter);
+
+  private:
+    std::vector<double> m_packed1;               //!< Packed slopes to limit (phases then mixture)
+    std::vector<double> m_packed2;               //!< Packed neighbouring slopes (phases then mixture)
+    std::vector<int> m_volumeFractionIndexes;    //!< Indexes in the packed slopes of the volume fractions
+    std::vector<int> m_otherIndexes;             //!< Indexes in the packed slopes of the other variables
+    std::vector<double> m_volumeFractionSlopes1; //!< Gathered volume fractions then transports to limit
+    std::vector<double> m_volumeFractionSlopes2; //!< Gathered neighbouring volume fractions then transports
+    std::vector<double> m_otherSlopes1;          //!< Gathered other variables to limit
+    std::vector<double> m_otherSlopes2;          //!< Gathered neighbouring other variables
+};
+
+extern PackedSlopes packedSlopesLocal;
+
+#endif // PACKEDSLOPES_H
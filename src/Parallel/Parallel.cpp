@@ -30,14 +30,18 @@
 
 #include "Parallel.h"
 #include "../Eos/Eos.h"
+#include "../AdditionalPhysics/AddPhys.h"
+#include <limits>
+#include <algorithm>
 
 //Variables linked to parallel computation
 Parallel parallel;
 int rankCpu, Ncpu;
+MPI_Comm computingComm(MPI_COMM_WORLD);
 
 //***********************************************************************
 
-Parallel::Parallel() {}
+Parallel::Parallel() : m_compactExchange(false) {}
 
 //***********************************************************************
 
@@ -45,8 +49,9 @@ Parallel::~Parallel() {}
 
 //***********************************************************************
 
-void Parallel::initialization()
+void Parallel::initialization(const bool& compactExchange)
 {
+  m_compactExchange = compactExchange;
   if (Ncpu == 1) return; //The following is not necessary in the case of monoCPU
 
   m_isNeighbour = new bool[Ncpu];
@@ -82,6 +87,8 @@ void Parallel::initialization()
   m_reqNumberElementsToReceiveFromNeighbour = new MPI_Request*[Ncpu];
   m_reqNumberSlopesToSendToNeighbor         = new MPI_Request*[Ncpu];
   m_reqNumberSlopesToReceiveFromNeighbour   = new MPI_Request*[Ncpu];
+  m_bufferSendFused.resize(Ncpu);
+  m_bufferReceiveFused.resize(Ncpu);
 
   for (int i = 0; i < Ncpu; i++) {
     m_isNeighbour[i]                                = false;
@@ -193,7 +200,7 @@ void Parallel::initializePersistentCommunications(const int& numberPrimitiveVari
     //Initialization of communications of transported variables
     parallel.initializePersistentCommunicationsTransports();
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
 }
 
 //***********************************************************************
@@ -201,7 +208,7 @@ void Parallel::initializePersistentCommunications(const int& numberPrimitiveVari
 void Parallel::computeDt(double& dt)
 {
   double dt_temp = dt;
-  MPI_Allreduce(&dt_temp, &dt, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  MPI_Allreduce(&dt_temp, &dt, 1, MPI_DOUBLE, MPI_MIN, computingComm);
 }
 
 //***********************************************************************
@@ -209,8 +216,8 @@ void Parallel::computeDt(double& dt)
 void Parallel::computePMax(double& pMax, double& pMaxWall)
 {
   double pMax_temp(pMax), pMaxWall_temp(pMaxWall);
-  MPI_Allreduce(&pMax_temp, &pMax, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  MPI_Allreduce(&pMaxWall_temp, &pMaxWall, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allreduce(&pMax_temp, &pMax, 1, MPI_DOUBLE, MPI_MAX, computingComm);
+  MPI_Allreduce(&pMaxWall_temp, &pMaxWall, 1, MPI_DOUBLE, MPI_MAX, computingComm);
 }
 
 //***********************************************************************
@@ -218,7 +225,7 @@ void Parallel::computePMax(double& pMax, double& pMaxWall)
 void Parallel::computeSum(double& var)
 {
   double buff(var);
-  MPI_Allreduce(&buff, &var, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&buff, &var, 1, MPI_DOUBLE, MPI_SUM, computingComm);
 }
 
 //***********************************************************************
@@ -244,15 +251,21 @@ void Parallel::finalize(const int& lvlMax)
     }
     m_elementsToSend.clear();
     m_elementsToReceive.clear();
+
+    for (int neighbour = 0; neighbour < static_cast<int>(m_bufferSendFused.size()); neighbour++) {
+      MemoryStats::remove(MEMCOMMBUFFERS, (m_bufferSendFused[neighbour].capacity() + m_bufferReceiveFused[neighbour].capacity()) * sizeof(double), 0);
+    }
+    m_bufferSendFused.clear();
+    m_bufferReceiveFused.clear();
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
 }
 
 //***********************************************************************
 
 void Parallel::stopRun()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
   MPI_Finalize();
   exit(0);
 }
@@ -264,7 +277,7 @@ bool Parallel::verifyStateCPUs()
   //Gathering of errors
   int nbErr_temp(0);
   int nbErr(errors.size());
-  MPI_Allreduce(&nbErr, &nbErr_temp, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&nbErr, &nbErr_temp, 1, MPI_INT, MPI_SUM, computingComm);
   //Stop if error on one CPU
   if (nbErr_temp) {
     return true;
@@ -287,13 +300,13 @@ void Parallel::initializePersistentCommunicationsPrimitives()
 
       //New sending request and its associated buffer
       m_reqSend[0][neighbour]    = new MPI_Request;
-      m_bufferSend[0][neighbour] = new double[numberSend];
-      MPI_Send_init(m_bufferSend[0][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSend[0][neighbour]);
+      m_bufferSend[0][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSend[0][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSend[0][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceive[0][neighbour]    = new MPI_Request;
-      m_bufferReceive[0][neighbour] = new double[numberReceive];
-      MPI_Recv_init(m_bufferReceive[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceive[0][neighbour]);
+      m_bufferReceive[0][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
+      MPI_Recv_init(m_bufferReceive[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceive[0][neighbour]);
     }
   }
 }
@@ -309,9 +322,9 @@ void Parallel::finalizePersistentCommunicationsPrimitives(const int& lvlMax)
           MPI_Request_free(m_reqSend[lvl][neighbour]);
           MPI_Request_free(m_reqReceive[lvl][neighbour]);
           delete m_reqSend[lvl][neighbour];
-          delete[] m_bufferSend[lvl][neighbour];
+          MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSend[lvl][neighbour]);
           delete m_reqReceive[lvl][neighbour];
-          delete[] m_bufferReceive[lvl][neighbour];
+          MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceive[lvl][neighbour]);
         }
       }
       // next arrays are allocated iff m_isNeighbour is
@@ -333,13 +346,14 @@ void Parallel::communicationsPrimitives(Eos** eos, int lvl, Prim type)
 {
   int count(0);
   MPI_Status status;
+  const int* phasesEos(m_compactExchange ? m_phasesEos.data() : nullptr);
 
   for (int neighbour = 0; neighbour < Ncpu; neighbour++) {
     if (m_isNeighbour[neighbour]) {
       //Prepation of sendings
       count = -1;
       for (int i = 0; i < m_numberElementsToSendToNeighbour[neighbour]; i++) {
-        m_elementsToSend[neighbour][i]->fillBufferPrimitives(m_bufferSend[lvl][neighbour], count, lvl, neighbour, type);
+        m_elementsToSend[neighbour][i]->fillBufferPrimitives(m_bufferSend[lvl][neighbour], count, lvl, neighbour, type, m_compactExchange);
       }
 
       //Sending request
@@ -357,12 +371,46 @@ void Parallel::communicationsPrimitives(Eos** eos, int lvl, Prim type)
       //Receivings
       count = -1;
       for (int i = 0; i < m_numberElementsToReceiveFromNeighbour[neighbour]; i++) {
-        m_elementsToReceive[neighbour][i]->getBufferPrimitives(m_bufferReceive[lvl][neighbour], count, lvl, eos, type);
+        m_elementsToReceive[neighbour][i]->getBufferPrimitives(m_bufferReceive[lvl][neighbour], count, lvl, eos, type, phasesEos);
       }
     }
   }
 }
 
+//***********************************************************************
+
+bool Parallel::initializeCompactExchange(const TypeMeshContainer<Cell*>& cells)
+{
+  if (Ncpu == 1 || !m_compactExchange) return false;
+
+  //1) Local extrema of the EOS index of each phase (-1 for a phase without EOS)
+  //----------------------------------------------------------------------------
+  std::vector<int> eosMin(numberPhases, std::numeric_limits<int>::max()), eosMax(numberPhases, std::numeric_limits<int>::min());
+  for (unsigned int c = 0; c < cells.size(); c++) {
+    for (int k = 0; k < numberPhases; k++) {
+      Eos* eos(cells[c]->getPhase(k)->getEos());
+      int number(eos ? eos->getNumber() : -1);
+      eosMin[k] = std::min(eosMin[k], number);
+      eosMax[k] = std::max(eosMax[k], number);
+    }
+  }
+
+  //2) The EOS index can be dropped from the messages only if it is uniform over the whole domain
+  //---------------------------------------------------------------------------------------------
+  std::vector<int> eosMinGlobal(numberPhases), eosMaxGlobal(numberPhases);
+  MPI_Allreduce(eosMin.data(), eosMinGlobal.data(), numberPhases, MPI_INT, MPI_MIN, computingComm);
+  MPI_Allreduce(eosMax.data(), eosMaxGlobal.data(), numberPhases, MPI_INT, MPI_MAX, computingComm);
+  m_phasesEos = eosMinGlobal;
+  for (int k = 0; k < numberPhases; k++) {
+    if (eosMinGlobal[k] != eosMaxGlobal[k]) m_compactExchange = false;
+  }
+  if (!m_compactExchange && rankCpu == 0) {
+    std::cout << "Compact exchange disabled: the EOS of a phase varies in the domain" << std::endl;
+  }
+
+  return m_compactExchange;
+}
+
 //****************************************************************************
 //********************** Methods for all the slopes **************************
 //****************************************************************************
@@ -377,14 +425,14 @@ void Parallel::initializePersistentCommunicationsSlopes()
 
       //New sending request and its associated buffer
       m_reqSendSlopes[0][neighbour]    = new MPI_Request;
-      m_bufferSendSlopes[0][neighbour] = new double[numberSend];
-      MPI_Send_init(m_bufferSendSlopes[0][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendSlopes[0][neighbour]);
+      m_bufferSendSlopes[0][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSendSlopes[0][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendSlopes[0][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveSlopes[0][neighbour]    = new MPI_Request;
-      m_bufferReceiveSlopes[0][neighbour] = new double[numberReceive];
+      m_bufferReceiveSlopes[0][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
       MPI_Recv_init(
-        m_bufferReceiveSlopes[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveSlopes[0][neighbour]);
+        m_bufferReceiveSlopes[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceiveSlopes[0][neighbour]);
     }
   }
 }
@@ -400,9 +448,9 @@ void Parallel::finalizePersistentCommunicationsSlopes(const int& lvlMax)
           MPI_Request_free(m_reqSendSlopes[lvl][neighbour]);
           MPI_Request_free(m_reqReceiveSlopes[lvl][neighbour]);
           delete m_reqSendSlopes[lvl][neighbour];
-          delete[] m_bufferSendSlopes[lvl][neighbour];
+          MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendSlopes[lvl][neighbour]);
           delete m_reqReceiveSlopes[lvl][neighbour];
-          delete[] m_bufferReceiveSlopes[lvl][neighbour];
+          MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveSlopes[lvl][neighbour]);
         }
       }
       // next arrays are allocated iff m_isNeighbour is
@@ -454,6 +502,98 @@ void Parallel::communicationsSlopes(int lvl)
   }
 }
 
+//***********************************************************************
+
+void Parallel::communicationsSlopesLevels(int lvl)
+{
+  if (!m_compactExchange || lvl == 0) {
+    this->communicationsSlopes(lvl);
+    if (lvl > 0) { this->communicationsSlopes(lvl - 1); }
+    return;
+  }
+
+  //Both levels are packed in a single message per neighbour (their sizes are only known once packed, hence the probe on reception)
+  int count(0);
+
+  for (int neighbour = 0; neighbour < Ncpu; neighbour++) {
+    if (m_isNeighbour[neighbour]) {
+      //Prepation of sendings
+      for (int l = lvl; l >= lvl - 1; l--) {
+        count = -1;
+        for (int i = 0; i < m_numberElementsToSendToNeighbour[neighbour]; i++) {
+          m_elementsToSend[neighbour][i]->fillBufferSlopes(m_bufferSendSlopes[l][neighbour], count, l, neighbour);
+        }
+        this->appendToFusedBuffer(neighbour, m_bufferSendSlopes[l][neighbour], count + 1);
+      }
+
+      //Sending request
+      this->sendFusedBuffer(neighbour, Ncpu + neighbour);
+    }
+  }
+  for (int neighbour = 0; neighbour < Ncpu; neighbour++) {
+    if (m_isNeighbour[neighbour]) {
+      //Receiving
+      double* buffer(this->receiveFusedBuffer(neighbour, Ncpu + rankCpu));
+
+      //Unpacking of the two levels in the order of packing
+      count = -1;
+      for (int l = lvl; l >= lvl - 1; l--) {
+        for (int i = 0; i < m_numberElementsToReceiveFromNeighbour[neighbour]; i++) {
+          m_elementsToReceive[neighbour][i]->getBufferSlopes(buffer, count, l);
+        }
+      }
+    }
+  }
+  this->waitFusedBuffers();
+}
+
+//***********************************************************************
+
+void Parallel::appendToFusedBuffer(const int& neighbour, const double* buffer, const int& number)
+{
+  std::vector<double>& fused(m_bufferSendFused[neighbour]);
+  std::size_t capacity(fused.capacity());
+  fused.insert(fused.end(), buffer, buffer + number);
+  if (fused.capacity() != capacity) MemoryStats::add(MEMCOMMBUFFERS, (fused.capacity() - capacity) * sizeof(double), 0);
+}
+
+//***********************************************************************
+
+void Parallel::sendFusedBuffer(const int& neighbour, const int& tag)
+{
+  std::vector<double>& fused(m_bufferSendFused[neighbour]);
+  m_reqSendFused.push_back(MPI_REQUEST_NULL);
+  MPI_Isend(fused.data(), static_cast<int>(fused.size()), MPI_DOUBLE, neighbour, tag, computingComm, &m_reqSendFused.back());
+}
+
+//***********************************************************************
+
+double* Parallel::receiveFusedBuffer(const int& neighbour, const int& tag)
+{
+  //The size of a fused message is only known once packed, hence the probe
+  std::vector<double>& fused(m_bufferReceiveFused[neighbour]);
+  std::size_t capacity(fused.capacity());
+  int number(0);
+  MPI_Status status;
+  MPI_Probe(neighbour, tag, computingComm, &status);
+  MPI_Get_count(&status, MPI_DOUBLE, &number);
+  fused.resize(number);
+  if (fused.capacity() != capacity) MemoryStats::add(MEMCOMMBUFFERS, (fused.capacity() - capacity) * sizeof(double), 0);
+  MPI_Recv(fused.data(), number, MPI_DOUBLE, neighbour, tag, computingComm, &status);
+  return fused.data();
+}
+
+//***********************************************************************
+
+void Parallel::waitFusedBuffers()
+{
+  MPI_Waitall(static_cast<int>(m_reqSendFused.size()), m_reqSendFused.data(), MPI_STATUSES_IGNORE);
+  m_reqSendFused.clear();
+  for (std::vector<double>& fused : m_bufferSendFused) {
+    fused.clear(); //Capacity kept for the next exchanges
+  }
+}
+
 //****************************************************************************
 //*********************** Methods for the vectors ****************************
 //****************************************************************************
@@ -468,14 +608,14 @@ void Parallel::initializePersistentCommunicationsVector(const int& dim)
 
       //New sending request and its associated buffer
       m_reqSendVector[0][neighbour]    = new MPI_Request;
-      m_bufferSendVector[0][neighbour] = new double[numberSend];
-      MPI_Send_init(m_bufferSendVector[0][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendVector[0][neighbour]);
+      m_bufferSendVector[0][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSendVector[0][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendVector[0][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveVector[0][neighbour]    = new MPI_Request;
-      m_bufferReceiveVector[0][neighbour] = new double[numberReceive];
+      m_bufferReceiveVector[0][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
       MPI_Recv_init(
-        m_bufferReceiveVector[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveVector[0][neighbour]);
+        m_bufferReceiveVector[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceiveVector[0][neighbour]);
     }
   }
 }
@@ -491,9 +631,9 @@ void Parallel::finalizePersistentCommunicationsVector(const int& lvlMax)
           MPI_Request_free(m_reqSendVector[lvl][neighbour]);
           MPI_Request_free(m_reqReceiveVector[lvl][neighbour]);
           delete m_reqSendVector[lvl][neighbour];
-          delete[] m_bufferSendVector[lvl][neighbour];
+          MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendVector[lvl][neighbour]);
           delete m_reqReceiveVector[lvl][neighbour];
-          delete[] m_bufferReceiveVector[lvl][neighbour];
+          MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveVector[lvl][neighbour]);
         }
       }
       // next arrays are allocated iff m_isNeighbour is
@@ -546,6 +686,70 @@ void Parallel::communicationsVector(Variable nameVector, const int& dim, int lvl
   }
 }
 
+//****************************************************************************
+//************ Methods for the vectors of the additional physics *************
+//****************************************************************************
+
+void Parallel::communicationsAddPhys(const std::vector<AddPhys*>& addPhys, const int& dim, int lvl)
+{
+  this->startCommunicationsAddPhys(addPhys, dim, lvl);
+  this->finishCommunicationsAddPhys(dim, lvl);
+}
+
+//***********************************************************************
+
+void Parallel::startCommunicationsAddPhys(const std::vector<AddPhys*>& addPhys, const int& dim, int lvl)
+{
+  m_vectorsAddPhys.clear();
+  for (unsigned int pa = 0; pa < addPhys.size(); pa++) {
+    addPhys[pa]->addCommunicatedVectors(m_vectorsAddPhys);
+  }
+  if (m_vectorsAddPhys.empty()) return;
+
+  int count(0);
+  for (int neighbour = 0; neighbour < Ncpu; neighbour++) {
+    if (m_isNeighbour[neighbour]) {
+      //Prepation of sendings: each vector is filled in the buffer of the vectors then appended to the message of the neighbour
+      for (unsigned int v = 0; v < m_vectorsAddPhys.size(); v++) {
+        count = -1;
+        for (int i = 0; i < m_numberElementsToSendToNeighbour[neighbour]; i++) {
+          m_elementsToSend[neighbour][i]->fillBufferVector(m_bufferSendVector[lvl][neighbour], count, lvl, neighbour, dim, Variable::QPA,
+                                                           m_vectorsAddPhys[v].first, m_vectorsAddPhys[v].second);
+        }
+        this->appendToFusedBuffer(neighbour, m_bufferSendVector[lvl][neighbour], count + 1);
+      }
+
+      //Sending request
+      this->sendFusedBuffer(neighbour, 2 * Ncpu + neighbour);
+    }
+  }
+}
+
+//***********************************************************************
+
+void Parallel::finishCommunicationsAddPhys(const int& dim, int lvl)
+{
+  if (m_vectorsAddPhys.empty()) return;
+
+  int count(0);
+  for (int neighbour = 0; neighbour < Ncpu; neighbour++) {
+    if (m_isNeighbour[neighbour]) {
+      //Receiving
+      double* buffer(this->receiveFusedBuffer(neighbour, 2 * Ncpu + rankCpu));
+
+      //Unpacking of the vectors in the order of packing
+      count = -1;
+      for (unsigned int v = 0; v < m_vectorsAddPhys.size(); v++) {
+        for (int i = 0; i < m_numberElementsToReceiveFromNeighbour[neighbour]; i++) {
+          m_elementsToReceive[neighbour][i]->getBufferVector(buffer, count, lvl, dim, Variable::QPA, m_vectorsAddPhys[v].first,
+                                                             m_vectorsAddPhys[v].second);
+        }
+      }
+    }
+  }
+  this->waitFusedBuffers();
+}
+
 //****************************************************************************
 //************ Methodes pour toutes les variables transportees ***************
 //****************************************************************************
@@ -560,15 +764,15 @@ void Parallel::initializePersistentCommunicationsTransports()
 
       //New sending request and its associated buffer
       m_reqSendTransports[0][neighbour]    = new MPI_Request;
-      m_bufferSendTransports[0][neighbour] = new double[numberSend];
+      m_bufferSendTransports[0][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
       MPI_Send_init(
-        m_bufferSendTransports[0][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendTransports[0][neighbour]);
+        m_bufferSendTransports[0][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendTransports[0][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveTransports[0][neighbour]    = new MPI_Request;
-      m_bufferReceiveTransports[0][neighbour] = new double[numberReceive];
+      m_bufferReceiveTransports[0][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
       MPI_Recv_init(
-        m_bufferReceiveTransports[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveTransports[0][neighbour]);
+        m_bufferReceiveTransports[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceiveTransports[0][neighbour]);
     }
   }
 }
@@ -584,9 +788,9 @@ void Parallel::finalizePersistentCommunicationsTransports(const int& lvlMax)
           MPI_Request_free(m_reqSendTransports[lvl][neighbour]);
           MPI_Request_free(m_reqReceiveTransports[lvl][neighbour]);
           delete m_reqSendTransports[lvl][neighbour];
-          delete[] m_bufferSendTransports[lvl][neighbour];
+          MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendTransports[lvl][neighbour]);
           delete m_reqReceiveTransports[lvl][neighbour];
-          delete[] m_bufferReceiveTransports[lvl][neighbour];
+          MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveTransports[lvl][neighbour]);
         }
       }
       // next arrays are allocated iff m_isNeighbour is
@@ -665,7 +869,7 @@ void Parallel::initializePersistentCommunicationsAMR(
     parallel.initializePersistentCommunicationsFromLvl0AMR(lvlMax);
   }
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
 }
 
 //***********************************************************************
@@ -724,59 +928,59 @@ void Parallel::initializePersistentCommunicationsLvlAMR(const int& lvlMax)
         //-------------------
         //New sending request and its associated buffer
         m_reqSend[lvl][neighbour]    = new MPI_Request;
-        m_bufferSend[lvl][neighbour] = new double[numberSend];
-        MPI_Send_init(m_bufferSend[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSend[lvl][neighbour]);
+        m_bufferSend[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
+        MPI_Send_init(m_bufferSend[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSend[lvl][neighbour]);
 
         //New receiving request and its associated buffer
         m_reqReceive[lvl][neighbour]    = new MPI_Request;
-        m_bufferReceive[lvl][neighbour] = new double[numberReceive];
-        MPI_Recv_init(m_bufferReceive[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceive[lvl][neighbour]);
+        m_bufferReceive[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
+        MPI_Recv_init(m_bufferReceive[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceive[lvl][neighbour]);
 
         //Slope variables
         //---------------
         //New sending request and its associated buffer
         m_reqSendSlopes[lvl][neighbour]    = new MPI_Request;
-        m_bufferSendSlopes[lvl][neighbour] = new double[numberSend];
+        m_bufferSendSlopes[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
         MPI_Send_init(
-          m_bufferSendSlopes[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendSlopes[lvl][neighbour]);
+          m_bufferSendSlopes[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendSlopes[lvl][neighbour]);
 
         //New receiving request and its associated buffer
         m_reqReceiveSlopes[lvl][neighbour]    = new MPI_Request;
-        m_bufferReceiveSlopes[lvl][neighbour] = new double[numberReceive];
+        m_bufferReceiveSlopes[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
         MPI_Recv_init(
-          m_bufferReceiveSlopes[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveSlopes[lvl][neighbour]);
+          m_bufferReceiveSlopes[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceiveSlopes[lvl][neighbour]);
 
         //Vector variables
         //----------------
         //New sending request and its associated buffer
         m_reqSendVector[lvl][neighbour]    = new MPI_Request;
-        m_bufferSendVector[lvl][neighbour] = new double[numberSend];
+        m_bufferSendVector[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
         MPI_Send_init(
-          m_bufferSendVector[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendVector[lvl][neighbour]);
+          m_bufferSendVector[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendVector[lvl][neighbour]);
 
         //New receiving request and its associated buffer
         m_reqReceiveVector[lvl][neighbour]    = new MPI_Request;
-        m_bufferReceiveVector[lvl][neighbour] = new double[numberReceive];
+        m_bufferReceiveVector[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
         MPI_Recv_init(
-          m_bufferReceiveVector[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveVector[lvl][neighbour]);
+          m_bufferReceiveVector[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceiveVector[lvl][neighbour]);
 
         //Transported variables
         //---------------------
         //New sending request and its associated buffer
         m_reqSendTransports[lvl][neighbour]    = new MPI_Request;
-        m_bufferSendTransports[lvl][neighbour] = new double[numberSend];
+        m_bufferSendTransports[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
         MPI_Send_init(
-          m_bufferSendTransports[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendTransports[lvl][neighbour]);
+          m_bufferSendTransports[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendTransports[lvl][neighbour]);
 
         //New receiving request and its associated buffer
         m_reqReceiveTransports[lvl][neighbour]    = new MPI_Request;
-        m_bufferReceiveTransports[lvl][neighbour] = new double[numberReceive];
+        m_bufferReceiveTransports[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
         MPI_Recv_init(m_bufferReceiveTransports[lvl][neighbour],
                       numberReceive,
                       MPI_DOUBLE,
                       neighbour,
                       rankCpu,
-                      MPI_COMM_WORLD,
+                      computingComm,
                       m_reqReceiveTransports[lvl][neighbour]);
       }
     }
@@ -855,18 +1059,18 @@ void Parallel::clearRequestsAndBuffers(int lvl)
       destroy(m_reqSendSplit[lvl][neighbour]);
       destroy(m_reqReceiveSplit[lvl][neighbour]);
 
-      destroy_array(m_bufferSend[lvl][neighbour]);
-      destroy_array(m_bufferReceive[lvl][neighbour]);
-      destroy_array(m_bufferSendSlopes[lvl][neighbour]);
-      destroy_array(m_bufferReceiveSlopes[lvl][neighbour]);
-      destroy_array(m_bufferSendVector[lvl][neighbour]);
-      destroy_array(m_bufferReceiveVector[lvl][neighbour]);
-      destroy_array(m_bufferSendTransports[lvl][neighbour]);
-      destroy_array(m_bufferReceiveTransports[lvl][neighbour]);
-      destroy_array(m_bufferSendXi[lvl][neighbour]);
-      destroy_array(m_bufferReceiveXi[lvl][neighbour]);
-      destroy_array(m_bufferSendSplit[lvl][neighbour]);
-      destroy_array(m_bufferReceiveSplit[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSend[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceive[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendSlopes[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveSlopes[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendVector[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveVector[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendTransports[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveTransports[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendXi[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveXi[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendSplit[lvl][neighbour]);
+      MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveSplit[lvl][neighbour]);
     }
   }
 }
@@ -892,7 +1096,7 @@ void Parallel::updatePersistentCommunicationsAMR(const int& dim)
   parallel.initializePersistentCommunicationsXi(rootLvl, number);
   parallel.initializePersistentCommunicationsSplit(rootLvl, number);
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
 }
 
 //***********************************************************************
@@ -913,13 +1117,13 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int& dim)
 
       //New sending request and its associated buffer
       m_reqSend[lvl][neighbour]    = new MPI_Request;
-      m_bufferSend[lvl][neighbour] = new double[numberSend];
-      MPI_Send_init(m_bufferSend[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSend[lvl][neighbour]);
+      m_bufferSend[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSend[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSend[lvl][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceive[lvl][neighbour]    = new MPI_Request;
-      m_bufferReceive[lvl][neighbour] = new double[numberReceive];
-      MPI_Recv_init(m_bufferReceive[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceive[lvl][neighbour]);
+      m_bufferReceive[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
+      MPI_Recv_init(m_bufferReceive[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceive[lvl][neighbour]);
 
       //Slope variables
       //---------------
@@ -928,14 +1132,14 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int& dim)
 
       //New sending request and its associated buffer
       m_reqSendSlopes[lvl][neighbour]    = new MPI_Request;
-      m_bufferSendSlopes[lvl][neighbour] = new double[numberSend];
-      MPI_Send_init(m_bufferSendSlopes[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendSlopes[lvl][neighbour]);
+      m_bufferSendSlopes[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSendSlopes[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendSlopes[lvl][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveSlopes[lvl][neighbour]    = new MPI_Request;
-      m_bufferReceiveSlopes[lvl][neighbour] = new double[numberReceive];
+      m_bufferReceiveSlopes[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
       MPI_Recv_init(
-        m_bufferReceiveSlopes[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveSlopes[lvl][neighbour]);
+        m_bufferReceiveSlopes[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceiveSlopes[lvl][neighbour]);
 
       //Vector variables
       //----------------
@@ -943,14 +1147,14 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int& dim)
       numberReceive = dim * m_bufferNumberElementsToReceiveFromNeighbour[neighbour];
       //New sending request and its associated buffer
       m_reqSendVector[lvl][neighbour]    = new MPI_Request;
-      m_bufferSendVector[lvl][neighbour] = new double[numberSend];
-      MPI_Send_init(m_bufferSendVector[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendVector[lvl][neighbour]);
+      m_bufferSendVector[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSendVector[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendVector[lvl][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveVector[lvl][neighbour]    = new MPI_Request;
-      m_bufferReceiveVector[lvl][neighbour] = new double[numberReceive];
+      m_bufferReceiveVector[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
       MPI_Recv_init(
-        m_bufferReceiveVector[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveVector[lvl][neighbour]);
+        m_bufferReceiveVector[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceiveVector[lvl][neighbour]);
 
       //Transported variables
       //---------------------
@@ -958,19 +1162,19 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int& dim)
       numberReceive = m_numberTransportVariables * m_bufferNumberElementsToReceiveFromNeighbour[neighbour];
       //New sending request and its associated buffer
       m_reqSendTransports[lvl][neighbour]    = new MPI_Request;
-      m_bufferSendTransports[lvl][neighbour] = new double[numberSend];
+      m_bufferSendTransports[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
       MPI_Send_init(
-        m_bufferSendTransports[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendTransports[lvl][neighbour]);
+        m_bufferSendTransports[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendTransports[lvl][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveTransports[lvl][neighbour]    = new MPI_Request;
-      m_bufferReceiveTransports[lvl][neighbour] = new double[numberReceive];
+      m_bufferReceiveTransports[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
       MPI_Recv_init(m_bufferReceiveTransports[lvl][neighbour],
                     numberReceive,
                     MPI_DOUBLE,
                     neighbour,
                     rankCpu,
-                    MPI_COMM_WORLD,
+                    computingComm,
                     m_reqReceiveTransports[lvl][neighbour]);
 
       //Xi variable
@@ -979,26 +1183,26 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int& dim)
       numberReceive = m_bufferNumberElementsToReceiveFromNeighbour[neighbour];
       //New sending request and its associated buffer
       m_reqSendXi[lvl][neighbour]    = new MPI_Request;
-      m_bufferSendXi[lvl][neighbour] = new double[numberSend];
-      MPI_Send_init(m_bufferSendXi[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendXi[lvl][neighbour]);
+      m_bufferSendXi[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSendXi[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendXi[lvl][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveXi[lvl][neighbour]    = new MPI_Request;
-      m_bufferReceiveXi[lvl][neighbour] = new double[numberReceive];
-      MPI_Recv_init(m_bufferReceiveXi[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveXi[lvl][neighbour]);
+      m_bufferReceiveXi[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
+      MPI_Recv_init(m_bufferReceiveXi[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceiveXi[lvl][neighbour]);
 
       //Split variable
       //--------------
       //New sending request and its associated buffer
       m_reqSendSplit[lvl][neighbour]    = new MPI_Request;
-      m_bufferSendSplit[lvl][neighbour] = new bool[numberSend];
-      MPI_Send_init(m_bufferSendSplit[lvl][neighbour], numberSend, MPI_C_BOOL, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendSplit[lvl][neighbour]);
+      m_bufferSendSplit[lvl][neighbour] = MemoryStats::allocateArray<bool>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSendSplit[lvl][neighbour], numberSend, MPI_C_BOOL, neighbour, neighbour, computingComm, m_reqSendSplit[lvl][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveSplit[lvl][neighbour]    = new MPI_Request;
-      m_bufferReceiveSplit[lvl][neighbour] = new bool[numberReceive];
+      m_bufferReceiveSplit[lvl][neighbour] = MemoryStats::allocateArray<bool>(MEMCOMMBUFFERS, numberReceive);
       MPI_Recv_init(
-        m_bufferReceiveSplit[lvl][neighbour], numberReceive, MPI_C_BOOL, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveSplit[lvl][neighbour]);
+        m_bufferReceiveSplit[lvl][neighbour], numberReceive, MPI_C_BOOL, neighbour, rankCpu, computingComm, m_reqReceiveSplit[lvl][neighbour]);
     }
   }
 }
@@ -1013,7 +1217,7 @@ void Parallel::finalizeAMR(const int& lvlMax)
     this->finalizePersistentCommunicationsNumberGhostCells();
   }
   this->finalize(lvlMax);
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
 }
 
 //***********************************************************************
@@ -1029,13 +1233,13 @@ void Parallel::initializePersistentCommunicationsXi(const int& lvl, const int& n
 
       //New sending request and its associated buffer
       m_reqSendXi[lvl][neighbour]    = new MPI_Request;
-      m_bufferSendXi[lvl][neighbour] = new double[numberSend];
-      MPI_Send_init(m_bufferSendXi[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendXi[lvl][neighbour]);
+      m_bufferSendXi[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSendXi[lvl][neighbour], numberSend, MPI_DOUBLE, neighbour, neighbour, computingComm, m_reqSendXi[lvl][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveXi[lvl][neighbour]    = new MPI_Request;
-      m_bufferReceiveXi[lvl][neighbour] = new double[numberReceive];
-      MPI_Recv_init(m_bufferReceiveXi[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveXi[lvl][neighbour]);
+      m_bufferReceiveXi[lvl][neighbour] = MemoryStats::allocateArray<double>(MEMCOMMBUFFERS, numberReceive);
+      MPI_Recv_init(m_bufferReceiveXi[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, computingComm, m_reqReceiveXi[lvl][neighbour]);
     }
   }
 }
@@ -1050,9 +1254,9 @@ void Parallel::finalizePersistentCommunicationsXi(const int& lvlMax)
         MPI_Request_free(m_reqSendXi[lvl][neighbour]);
         MPI_Request_free(m_reqReceiveXi[lvl][neighbour]);
         delete m_reqSendXi[lvl][neighbour];
-        delete[] m_bufferSendXi[lvl][neighbour];
+        MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendXi[lvl][neighbour]);
         delete m_reqReceiveXi[lvl][neighbour];
-        delete[] m_bufferReceiveXi[lvl][neighbour];
+        MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveXi[lvl][neighbour]);
       }
     }
     delete[] m_reqSendXi[lvl];
@@ -1117,14 +1321,14 @@ void Parallel::initializePersistentCommunicationsSplit(const int& lvl, const int
 
       //New sending request and its associated buffer
       m_reqSendSplit[lvl][neighbour]    = new MPI_Request;
-      m_bufferSendSplit[lvl][neighbour] = new bool[numberSend];
-      MPI_Send_init(m_bufferSendSplit[lvl][neighbour], numberSend, MPI_C_BOOL, neighbour, neighbour, MPI_COMM_WORLD, m_reqSendSplit[lvl][neighbour]);
+      m_bufferSendSplit[lvl][neighbour] = MemoryStats::allocateArray<bool>(MEMCOMMBUFFERS, numberSend);
+      MPI_Send_init(m_bufferSendSplit[lvl][neighbour], numberSend, MPI_C_BOOL, neighbour, neighbour, computingComm, m_reqSendSplit[lvl][neighbour]);
 
       //New receiving request and its associated buffer
       m_reqReceiveSplit[lvl][neighbour]    = new MPI_Request;
-      m_bufferReceiveSplit[lvl][neighbour] = new bool[numberReceive];
+      m_bufferReceiveSplit[lvl][neighbour] = MemoryStats::allocateArray<bool>(MEMCOMMBUFFERS, numberReceive);
       MPI_Recv_init(
-        m_bufferReceiveSplit[lvl][neighbour], numberReceive, MPI_C_BOOL, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveSplit[lvl][neighbour]);
+        m_bufferReceiveSplit[lvl][neighbour], numberReceive, MPI_C_BOOL, neighbour, rankCpu, computingComm, m_reqReceiveSplit[lvl][neighbour]);
     }
   }
 }
@@ -1139,9 +1343,9 @@ void Parallel::finalizePersistentCommunicationsSplit(const int& lvlMax)
         MPI_Request_free(m_reqSendSplit[lvl][neighbour]);
         MPI_Request_free(m_reqReceiveSplit[lvl][neighbour]);
         delete m_reqSendSplit[lvl][neighbour];
-        delete[] m_bufferSendSplit[lvl][neighbour];
+        MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferSendSplit[lvl][neighbour]);
         delete m_reqReceiveSplit[lvl][neighbour];
-        delete[] m_bufferReceiveSplit[lvl][neighbour];
+        MemoryStats::releaseArray(MEMCOMMBUFFERS, m_bufferReceiveSplit[lvl][neighbour]);
       }
     }
     delete[] m_reqSendSplit[lvl];
@@ -1213,7 +1417,7 @@ void Parallel::initializePersistentCommunicationsNumberGhostCells()
                   MPI_INT,
                   neighbour,
                   neighbour,
-                  MPI_COMM_WORLD,
+                  computingComm,
                   m_reqNumberElementsToSendToNeighbor[neighbour]);
 
     //New receiving request and its associated buffer
@@ -1224,7 +1428,7 @@ void Parallel::initializePersistentCommunicationsNumberGhostCells()
                   MPI_INT,
                   neighbour,
                   rankCpu,
-                  MPI_COMM_WORLD,
+                  computingComm,
                   m_reqNumberElementsToReceiveFromNeighbour[neighbour]);
 
     //New sending request and its associated buffer
@@ -1235,7 +1439,7 @@ void Parallel::initializePersistentCommunicationsNumberGhostCells()
                   MPI_INT,
                   neighbour,
                   neighbour,
-                  MPI_COMM_WORLD,
+                  computingComm,
                   m_reqNumberSlopesToSendToNeighbor[neighbour]);
 
     //New receiving request and its associated buffer
@@ -1246,7 +1450,7 @@ void Parallel::initializePersistentCommunicationsNumberGhostCells()
                   MPI_INT,
                   neighbour,
                   rankCpu,
-                  MPI_COMM_WORLD,
+                  computingComm,
                   m_reqNumberSlopesToReceiveFromNeighbour[neighbour]);
   }
 }
@@ -36,13 +36,17 @@
 #include "../Models/Phase.h"
 #include "../Order1/Cell.h"
 
+class AddPhys;
+
 class Parallel
 {
   public:
     Parallel();
     ~Parallel();
 
-    void initialization();
+    //! \brief     Allocate the neighbour arrays
+    //! \param     compactExchange    compact ghost exchange requested (EOS indexes dropped, fused multi-level slopes)
+    void initialization(const bool& compactExchange = false);
     void setNeighbour(const int neighbour);
     void addElementToSend(int neighbour, Cell* cell);
     void addElementToReceive(int neighbour, Cell* cell);
@@ -68,11 +72,18 @@ class Parallel
     void initializePersistentCommunicationsPrimitives();
     void finalizePersistentCommunicationsPrimitives(const int& lvlMax);
     void communicationsPrimitives(Eos** eos, int lvl, Prim type = vecPhases);
+    //! \brief     Activate the compact exchange if requested and if the EOS of each phase is the same in every cell of every CPU
+    //! \param     cells              local cells (collective call)
+    //! \return    true if the compact primitive buffers are used
+    bool initializeCompactExchange(const TypeMeshContainer<Cell*>& cells);
+    bool isCompactExchange() const { return m_compactExchange; };
 
     //Methodes pour toutes les slopes
     void initializePersistentCommunicationsSlopes();
     void finalizePersistentCommunicationsSlopes(const int& lvlMax);
     void communicationsSlopes(int lvl);
+    //! \brief     Exchange the slopes of levels lvl and lvl-1 (one message per neighbour in compact mode)
+    void communicationsSlopesLevels(int lvl);
 
     //Methodes pour une variable scalar
     void initializePersistentCommunicationsScalar();
@@ -83,6 +94,15 @@ class Parallel
     void finalizePersistentCommunicationsVector(const int& lvlMax);
     void communicationsVector(Variable nameVector, const int& dim, int lvl, int num = 0, int index = -1);
 
+    //Methodes pour les vecteurs des physiques additionnelles
+    //! \brief     Exchange the vectors of every additional physic in one message per neighbour
+    void communicationsAddPhys(const std::vector<AddPhys*>& addPhys, const int& dim, int lvl);
+    //! \brief     Pack and post the messages of the additional-physics vectors (completed by finishCommunicationsAddPhys)
+    //! \details   Local work not involving the ghost cells may be done between the two calls
+    void startCommunicationsAddPhys(const std::vector<AddPhys*>& addPhys, const int& dim, int lvl);
+    //! \brief     Receive and unpack the additional-physics vectors posted by startCommunicationsAddPhys
+    void finishCommunicationsAddPhys(const int& dim, int lvl);
+
     //Methodes pour toutes les variables transports
     void initializePersistentCommunicationsTransports();
     void finalizePersistentCommunicationsTransports(const int& lvlMax);
@@ -112,6 +132,11 @@ class Parallel
     void communicationsNumberGhostCells(int lvl);
 
   private:
+    void appendToFusedBuffer(const int& neighbour, const double* buffer, const int& number);
+    void sendFusedBuffer(const int& neighbour, const int& tag);
+    double* receiveFusedBuffer(const int& neighbour, const int& tag);
+    void waitFusedBuffers();
+
     bool* m_isNeighbour;
     std::vector<TypeMeshContainer<Cell*>> m_elementsToSend;
     std::vector<TypeMeshContainer<Cell*>> m_elementsToReceive;
@@ -122,6 +147,8 @@ class Parallel
     int m_numberPrimitiveVariables; /*Number of primitive variables to send (phases + mixture + transports)*/
     int m_numberSlopeVariables;     /*Number of slope variables to send (phases + mixture + transports)*/
     int m_numberTransportVariables; /*Number of transport variables to send*/
+    bool m_compactExchange;         /*Compact exchange of the ghost cells (EOS indexes not sent, fused slope levels)*/
+    std::vector<int> m_phasesEos;   /*EOS index of each phase, known on both sides in compact exchange*/
 
     std::vector<double**> m_bufferReceive;
     std::vector<double**> m_bufferSend;
@@ -137,6 +164,10 @@ class Parallel
     std::vector<double**> m_bufferSendXi;
     std::vector<bool**> m_bufferReceiveSplit;
     std::vector<bool**> m_bufferSendSplit;
+    std::vector<std::vector<double>> m_bufferReceiveFused; /*Buffers of the fused messages (slope levels, additional physics), one per neighbour*/
+    std::vector<std::vector<double>> m_bufferSendFused;
+    std::vector<MPI_Request> m_reqSendFused;           /*Pending sendings of the fused messages*/
+    std::vector<std::pair<int, int>> m_vectorsAddPhys; /*Additional-physics vectors (QPA number, index) of the pending exchange*/
     int* m_bufferNumberElementsToSendToNeighbor;
     int* m_bufferNumberElementsToReceiveFromNeighbour;
     int* m_bufferNumberSlopesToSendToNeighbor;
@@ -165,5 +196,6 @@ class Parallel
 extern Parallel parallel;
 extern int rankCpu;
 extern int Ncpu;
+extern MPI_Comm computingComm; //!< Communicator of the CPUs running the current test case (MPI_COMM_WORLD unless ensemble execution)
 
 #endif // PARALLEL_H
@@ -56,7 +56,7 @@ class Decomposition
 
     Decomposition(std::array<int, Dim> _nCells) : nCells_global_(_nCells) {}
 
-    void printDomainDecomposition(std::ofstream& fileStream) const noexcept
+    void printDomainDecomposition(std::ostream& fileStream) const noexcept
     {
       fileStream << key_rank_map_.size() << " ";
       auto it = key_rank_map_.begin();
@@ -66,7 +66,7 @@ class Decomposition
       }
     }
 
-    void readDomainDecomposition(std::ifstream& fileStream) noexcept
+    void readDomainDecomposition(std::istream& fileStream) noexcept
     {
       int sizeKeyRankMap(0), rank(0);
       fileStream >> sizeKeyRankMap;
@@ -175,6 +175,32 @@ class Decomposition
       return (_key.coordinate()[0] < nCells_global_[0] && _key.coordinate()[1] < nCells_global_[1] && _key.coordinate()[2] < nCells_global_[2]);
     }
 
+    //Number of valid keys lower than _key, i.e. position of _key in the ordered sequence of valid keys.
+    //For each bit set in _key, the keys sharing the upper bits with this bit unset are counted
+    //(their coordinates span one range per direction, clipped to the physical domain).
+    typename key_type::value_type count_valid_keys_before(const key_type& _key) const noexcept
+    {
+      using value_type    = typename key_type::value_type;
+      const auto coord    = _key.coordinate();
+      constexpr int nBits = (8 * sizeof(value_type)) / Dim;
+      value_type count(0);
+      for (int b = nBits - 1; b >= 0; --b) {
+        for (int d = Dim - 1; d >= 0; --d) {
+          if (((static_cast<value_type>(coord[d]) >> b) & 1) == 0) continue;
+          value_type number(1);
+          for (int e = 0; e < Dim; ++e) {
+            const int freeBits  = (e < d) ? b + 1 : b;
+            const int fixedBits = (e == d) ? b + 1 : freeBits;
+            value_type low      = (static_cast<value_type>(coord[e]) >> fixedBits) << fixedBits;
+            value_type high     = std::min(low + (static_cast<value_type>(1) << freeBits), static_cast<value_type>(nCells_global_[e]));
+            number *= (high > low) ? high - low : 0;
+          }
+          count += number;
+        }
+      }
+      return count;
+    }
+
     template <class Coord> bool is_inside(const Coord& _coord)
     {
       for (int d = 0; d < Dim; ++d) {
@@ -204,7 +230,7 @@ class Decomposition
 
       //All gather sizes of maps
       std::vector<int> mapSizes(_nCpu);
-      MPI_Allgather(&localMapSize, 1, MPI_INT, &mapSizes[0], 1, MPI_INT, MPI_COMM_WORLD);
+      MPI_Allgather(&localMapSize, 1, MPI_INT, &mapSizes[0], 1, MPI_INT, computingComm);
 
       //All gather maps (keys and ranks)
       std::vector<int> displacements(_nCpu);
@@ -216,8 +242,8 @@ class Decomposition
       std::vector<typename key_type::value_type> globalKeys(sumMapSizes);
       std::vector<int> globalRanks(sumMapSizes);
       MPI_Allgatherv(
-        &localKeys[0], localMapSize, MPI_UNSIGNED_LONG_LONG, &globalKeys[0], &mapSizes[0], &displacements[0], MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD);
-      MPI_Allgatherv(&localRanks[0], localMapSize, MPI_INT, &globalRanks[0], &mapSizes[0], &displacements[0], MPI_INT, MPI_COMM_WORLD);
+        &localKeys[0], localMapSize, MPI_UNSIGNED_LONG_LONG, &globalKeys[0], &mapSizes[0], &displacements[0], MPI_UNSIGNED_LONG_LONG, computingComm);
+      MPI_Allgatherv(&localRanks[0], localMapSize, MPI_INT, &globalRanks[0], &mapSizes[0], &displacements[0], MPI_INT, computingComm);
 
       //Compose global map from keys and ranks
       auto keyRankEnd = *(key_rank_map_.rbegin());
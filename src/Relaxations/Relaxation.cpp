@@ -39,3 +39,37 @@ Relaxation::Relaxation() {}
 Relaxation::~Relaxation() {}
 
 //***********************************************************************
+
+bool Relaxation::isPurePhase(Cell* cell) const
+{
+  if (epsilonAlphaNull > 1.e-20) { // alpha = 0 is activated
+    for (int k = 0; k < numberPhases; k++) {
+      if (cell->getPhase(k)->getAlpha() > (1. - 1.e-5)) return true;
+    }
+  }
+  return false;
+}
+
+//***********************************************************************
+
+bool Relaxation::isRelaxed(Cell* cell, const bool& temperature) const
+{
+  //The tolerance is well below the convergence criteria of the relaxation procedures:
+  //skipping such a cell only differs from relaxing it by round-off
+  double tolerance(1.e-12);
+  Phase* phase0(cell->getPhase(0));
+  double p0(phase0->getPressure()), T0(0.);
+  if (temperature) T0 = phase0->getEos()->computeTemperature(phase0->getDensity(), p0);
+  for (int k = 1; k < numberPhases; k++) {
+    Phase* phase(cell->getPhase(k));
+    double pk(phase->getPressure());
+    if (std::fabs(pk - p0) > tolerance * (std::fabs(pk) + std::fabs(p0))) return false;
+    if (temperature) {
+      double Tk(phase->getEos()->computeTemperature(phase->getDensity(), pk));
+      if (std::fabs(Tk - T0) > tolerance * (std::fabs(Tk) + std::fabs(T0))) return false;
+    }
+  }
+  return true;
+}
+
+//***********************************************************************
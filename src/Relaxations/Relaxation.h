@@ -69,6 +69,23 @@ class Relaxation
     //! \param     numberPhases   number of phases
     virtual void initializeCriticalPressure(Cell* /*cell*/) {};
 
+    //! \brief     Cheap test telling whether the relaxation can modify the state of the cell
+    //! \details   Cells found inactive (pure phase, already relaxed) are skipped by the relaxation loop of the run.
+    //! \param     cell           cell to test
+    virtual bool needsRelaxation(Cell* /*cell*/) const { return true; };
+
+    //! \brief     Relative cost of the relaxation of a cell, in the units of Model::getFaceCost (default: pressure relaxation)
+    virtual double getCellCost() const { return 3.7; };
+
+  protected:
+    //! \brief     Pure-phase test used by the relaxations when alpha = 0 is activated (a phase fills the cell)
+    //! \param     cell           cell to test
+    bool isPurePhase(Cell* cell) const;
+    //! \brief     Test of equal phasic pressures (and temperatures if required) within round-off
+    //! \param     cell           cell to test
+    //! \param     temperature    true to also test the phasic temperatures
+    bool isRelaxed(Cell* cell, const bool& temperature = false) const;
+
   private:
 };
 
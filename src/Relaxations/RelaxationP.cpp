@@ -40,7 +40,7 @@ RelaxationP::~RelaxationP() {}
 
 //***********************************************************************
 
-void RelaxationP::NewtonRaphson(double& pStar, int& iteration)
+void RelaxationP::NewtonRaphson(double& pStar, int& iteration, const bool& warn)
 {
   //Iterative process for relaxed pressure determination
   double f(0.), df(1.), drhodp(0.), dalpha(0.);
@@ -62,7 +62,7 @@ void RelaxationP::NewtonRaphson(double& pStar, int& iteration)
     }
   } while (std::fabs(f) > 1e-10 && iteration < 100);
 
-  if (iteration == 100 && std::fabs(pStar) > 1.e-7) {
+  if (warn && iteration == 100 && std::fabs(pStar) > 1.e-7) {
     std::stringstream warningMessage;
     warningMessage << "Not converged in RelaxationP::NewtonRaphson.";
     warningMessage << "Convergence error = " << std::fabs(f);
@@ -72,6 +72,32 @@ void RelaxationP::NewtonRaphson(double& pStar, int& iteration)
 
 //***********************************************************************
 
+void RelaxationP::NewtonRaphson(Cell* cell, double& pStar, int& iteration)
+{
+  int warmIterations(0);
+  if (WarmStart::isActive() && WarmStart::isValid(cell->getRelaxedPressure())) {
+    //Warm start from the last relaxed pressure of the cell
+    double pWarm(cell->getRelaxedPressure());
+    iteration = 0;
+    NewtonRaphson(pWarm, iteration, false);
+    if (iteration < 100) {
+      WarmStart::record(WARMRELAXP, iteration, true);
+      pStar = pWarm;
+      cell->setRelaxedPressure(pStar);
+      return;
+    }
+    warmIterations = iteration;
+  }
+
+  //Usual initialization
+  iteration = 0;
+  NewtonRaphson(pStar, iteration);
+  WarmStart::record(WARMRELAXP, warmIterations + iteration, warmIterations > 0, warmIterations > 0);
+  if (WarmStart::isActive() && iteration < 100) cell->setRelaxedPressure(pStar);
+}
+
+//***********************************************************************
+
 double RelaxationP::computeInterfacePressure(Cell* cell, Prim type)
 {
   //pI = sum_k (p_k sum_j Z_j) / (N - 1) sum_k (Z_k) ; where j is different from k and where p_k also considers solid terms
@@ -48,7 +48,16 @@ class RelaxationP : public Relaxation
     //! \details   Call of this method computes the totally relaxed pressure in a given cell.
     //! \param     pStar          initial and final pressure value
     //! \param     iteration      number of iterations for convergence of the method
-    void NewtonRaphson(double& pStar, int& iteration);
+    //! \param     warn           add a warning if the method does not converge
+    void NewtonRaphson(double& pStar, int& iteration, const bool& warn = true);
+
+    //! \brief     Newton-Raphson method for the infinite pressure relaxation, warm started if WarmStart is active
+    //! \details   The iterations start from the last relaxed pressure of the cell when it is known, and restart from
+    //!            pStar if they do not converge. The relaxed pressure of the cell is updated on convergence.
+    //! \param     cell           cell
+    //! \param     pStar          initial (usual initialization) and final pressure value
+    //! \param     iteration      number of iterations for convergence of the method (100 if not converged)
+    void NewtonRaphson(Cell* cell, double& pStar, int& iteration);
 
     //! \brief     Compute interface pressure
     //! \details   Call for this method computes the interface pressure in a cell.
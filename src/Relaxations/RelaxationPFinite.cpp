@@ -257,7 +257,7 @@ void RelaxationPFinite::relaxation(Cell* cell, const double& dt, Prim type)
 
         //Iterative process for relaxed pressure determination
         int iteration(0);
-        NewtonRaphson(pStar, iteration);
+        NewtonRaphson(cell, pStar, iteration);
 
         //Apply the relaxation procedure if it has converged to a solution.
         if (iteration < 100) {
@@ -347,7 +347,7 @@ void RelaxationPFinite::relaxation(Cell* cell, const double& dt, Prim type)
 
           //Iterative process for relaxed pressure determination
           int iteration(0);
-          NewtonRaphson(pStar, iteration);
+          NewtonRaphson(cell, pStar, iteration);
 
           //Apply the relaxation procedure only if it has converged to a solution.
           if (iteration < 100) {
@@ -40,6 +40,10 @@ RelaxationPInfinite::~RelaxationPInfinite() {}
 
 //***********************************************************************
 
+bool RelaxationPInfinite::needsRelaxation(Cell* cell) const { return !this->isPurePhase(cell) && !this->isRelaxed(cell); }
+
+//***********************************************************************
+
 void RelaxationPInfinite::relaxation(Cell* cell, const double& /*dt*/, Prim type)
 {
   //Is the pressure-relaxation procedure necessary?
@@ -66,7 +70,7 @@ void RelaxationPInfinite::relaxation(Cell* cell, const double& /*dt*/, Prim type
 
     //Iterative process for relaxed pressure determination
     int iteration(0);
-    NewtonRaphson(pStar, iteration);
+    NewtonRaphson(cell, pStar, iteration);
 
     //Apply the relaxation procedure only if it has converged to a solution.
     if (iteration < 100) {
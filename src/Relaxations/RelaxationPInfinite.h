@@ -47,6 +47,7 @@ class RelaxationPInfinite : public RelaxationP
     //! \param     dt             time step (not used here)
     //! \param     type           enumeration allowing to relax either state in the cell or second order half time step state
     void relaxation(Cell* cell, const double& /*dt*/, Prim type = vecPhases) override;
+    bool needsRelaxation(Cell* cell) const override;
 };
 
 #endif // RELAXATIONPINFINITE_H
@@ -40,6 +40,10 @@ RelaxationPT::~RelaxationPT() {}
 
 //***********************************************************************
 
+bool RelaxationPT::needsRelaxation(Cell* cell) const { return !this->isPurePhase(cell) && !this->isRelaxed(cell, true); }
+
+//***********************************************************************
+
 void RelaxationPT::relaxation(Cell* cell, const double& /*dt*/, Prim type)
 {
   //Is the pressure-Temperature relaxation procedure necessary?
@@ -47,6 +47,7 @@ class RelaxationPT : public Relaxation
     //! \param     dt             time step (not used here)
     //! \param     type           enumeration allowing to relax either state in the cell or second order half time step state
     void relaxation(Cell* cell, const double& /*dt*/, Prim type = vecPhases) override;
+    bool needsRelaxation(Cell* cell) const override;
 
     //! \brief     Pressure determination with analytical formulae for 2 phases governed by SG or IG EOS
     //! \details   call for this method determines the pressure using the analytical formulae only valid in the specific case of 2 phases governed by SG or IG EOS
@@ -65,6 +66,7 @@ class RelaxationPT : public Relaxation
 
     //! \brief     Return the pressure- and temperature-relaxation type
     int getType() const override { return PT; }
+    double getCellCost() const override { return 3.5; };
 };
 
 #endif // RELAXATIONPT_H
@@ -150,12 +150,25 @@ void RelaxationPTMu::relaxation(Cell* cell, const double& /*dt*/, Prim type)
   double rhoLSat(0.), rhoVSat(0.), drhoLSat, drhoVSat;
   double aLSat(0.), aVSat(0.), daLSat, daVSat;
   double rhoeLSat, rhoeVSat, drhoeLSat, drhoeVSat;
-  int iteration(0);
+  int iteration(0), warmIterations(0);
   double f(0.), df(1.);
+  //Warm start from the last relaxed pressure of the cell, Tsat is warm started from the previous iteration
+  const double pStarCold(pStar);
+  const bool warmStart(WarmStart::isActive() && WarmStart::isValid(cell->getRelaxedPressure()) && cell->getRelaxedPressure() < m_pcrit);
+  bool warm(warmStart);
+  double TsatGuess(0.);
+  if (warm) pStar = cell->getRelaxedPressure();
   do {
     pStar -= f / df;
     iteration++;
 
+    if (iteration > 50 && warm) { //Warm start not converged: restart from the usual initialization
+      warm           = false;
+      warmIterations = iteration - 1;
+      iteration      = 1;
+      pStar          = pStarCold;
+      TsatGuess      = 0.;
+    }
     if (iteration > 50) {
       errors.push_back(Errors("Number of iterations too large in relaxPTMu", __FILE__, __LINE__));
       break;
@@ -167,9 +180,11 @@ void RelaxationPTMu::relaxation(Cell* cell, const double& /*dt*/, Prim type)
     }
 
     //Liquid-vapor densities calculus using phases' EOS
-    Tsat    = cell->getMixture(type)->computeTsat(cell->getPhase(m_liq, type)->getEos(), cell->getPhase(m_vap, type)->getEos(), pStar, &dTsat);
-    rhoLSat = TB->eos[m_liq]->computeDensitySaturation(pStar, Tsat, dTsat, &drhoLSat);
-    rhoVSat = TB->eos[m_vap]->computeDensitySaturation(pStar, Tsat, dTsat, &drhoVSat);
+    Tsat = cell->getMixture(type)->computeTsat(
+      cell->getPhase(m_liq, type)->getEos(), cell->getPhase(m_vap, type)->getEos(), pStar, &dTsat, TsatGuess);
+    TsatGuess = WarmStart::isActive() ? Tsat : 0.;
+    rhoLSat   = TB->eos[m_liq]->computeDensitySaturation(pStar, Tsat, dTsat, &drhoLSat);
+    rhoVSat   = TB->eos[m_vap]->computeDensitySaturation(pStar, Tsat, dTsat, &drhoVSat);
 
     //Liquid-vapor volume fraction calculus using mass conservation within a cell
     aLSat  = (rho - rhoVSat) / (rhoLSat - rhoVSat);
@@ -188,6 +203,8 @@ void RelaxationPTMu::relaxation(Cell* cell, const double& /*dt*/, Prim type)
     f  /= rhoe;
     df /= rhoe;
   } while (std::fabs(f) > 1e-10);
+  WarmStart::record(WARMRELAXP, warmIterations + iteration, warmStart, warmIterations > 0);
+  if (WarmStart::isActive() && iteration <= 50) cell->setRelaxedPressure(pStar);
 
   //Cell update
   phase = cell->getPhase(m_liq, type);
@@ -61,6 +61,7 @@ class RelaxationPTMu : public Relaxation
 
     //! \brief     Return the pressure-, temperature- and chemical-potential-relaxation type
     int getType() const override { return PTMU; }
+    double getCellCost() const override { return 65.; };
 
   private:
     int m_liq;      //!< Liquid phase number for phase change
@@ -42,6 +42,7 @@ Run::Run(std::string nameCasTest, const int& number) :
   m_numberTransports(0),
   m_MRF(-1),
   m_viscous(false),
+  m_timeIntegration(MUSCLHANCOCK),
   m_extractRefLength(false),
   m_smoothCrossSection1d(false),
   m_dt(1.e-15),
@@ -49,6 +50,9 @@ Run::Run(std::string nameCasTest, const int& number) :
   m_iteration(0),
   m_resumeSimulation(0),
   m_resumeAMRsaveFreq(0),
+  m_resumeFromCheckpoint(false),
+  m_compactExchange(false),
+  m_superTimeStepping(false),
   m_recordPsat(false)
 {
   m_mesh                           = nullptr;
@@ -65,6 +69,8 @@ Run::Run(std::string nameCasTest, const int& number) :
   m_interfaceVolumeFractionLimiter = nullptr;
   m_input                          = nullptr;
   m_outPut                         = nullptr;
+  m_checkpoint                     = nullptr;
+  m_narrowBand                     = nullptr;
 
   // Specific for simulation restart with mesh mapping
   m_outputMeshMapping  = nullptr;
@@ -99,24 +105,36 @@ void Run::initialize()
     throw;
   }
   TB = new Tools(m_numberPhases, m_numberSolids, m_numberTransports);
+  if (m_superTimeStepping) {
+    for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) {
+      if (m_addPhys[pa]->isDiffusive()) m_addPhysDiffusive.push_back(m_addPhys[pa]);
+      else m_addPhysOthers.push_back(m_addPhys[pa]);
+    }
+  }
+  if (m_narrowBand != nullptr && !m_narrowBand->initialize(m_addPhys)) destroy(m_narrowBand);
 
   //2) Initialization of parallel computing (also needed for 1 CPU)
   //---------------------------------------------------------------
-  parallel.initialization();
+  parallel.initialization(m_compactExchange);
   if (Ncpu > 1) {
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Barrier(computingComm);
     if (rankCpu == 0) std::cout << "T" << m_numTest << " | Number of CPU: " << Ncpu << std::endl;
   }
 
   //3) Mesh data initialization
   //---------------------------
+  predictionVariablesO2 = (m_timeIntegration == MUSCLHANCOCK);
   m_mesh->assignLimits(boundCond);
   m_cellsLvl          = new TypeMeshContainer<Cell*>[m_lvlMax + 1];
   m_cellsLvlGhost     = new TypeMeshContainer<Cell*>[m_lvlMax + 1];
   m_cellInterfacesLvl = new TypeMeshContainer<CellInterface*>[m_lvlMax + 1];
   try {
     if (m_resumeSimulation > 0) {
-      if (m_outPut->getType() == TypeOutput::VTK) {
+      if (m_resumeFromCheckpoint) {
+        if (rankCpu == 0) std::cout << "T" << m_numTest << " | Resuming simulation from checkpoint number: " << m_resumeSimulation << "..." << std::endl;
+        m_checkpoint->readHeader(m_resumeSimulation, m_mesh);
+      }
+      else if (m_outPut->getType() == TypeOutput::VTK) {
         if (rankCpu == 0)
           std::cout << "T" << m_numTest << " | Resuming simulation from result file number: " << m_resumeSimulation << "..." << std::endl;
         m_outPut->readInfos();
@@ -140,9 +158,20 @@ void Run::initialize()
         Errors::errorMessage("Run::resumeSimulation: Resume option only available for VTK output");
       }
     }
+    //Relative costs of the faces and cells, used by the built-in partitioner to weight the cells
+    double faceCost(m_model->getFaceCost()), cellCost(m_model->getCellCost());
+    for (unsigned int r = 0; r < m_model->getRelaxations()->size(); r++) {
+      cellCost += (*m_model->getRelaxations())[r]->getCellCost();
+    }
+    for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) {
+      faceCost += m_addPhys[pa]->getFaceCost();
+    }
+    m_mesh->setComputationalCosts(faceCost, cellCost);
+    //A checkpoint does not depend on the domain decomposition: AMR level-0 cells are distributed again by key ranges
+    int resumeDecomposition(m_resumeFromCheckpoint ? 0 : m_resumeSimulation);
     if (m_mesh->getType() == AMR) m_stat.startAMRTime();
     m_dimension =
-      m_mesh->initializeGeometrie(m_cellsLvl[0], m_cellsLvlGhost[0], m_cellInterfacesLvl[0], m_resumeSimulation, m_parallelPreTreatment, m_order);
+      m_mesh->initializeGeometrie(m_cellsLvl[0], m_cellsLvlGhost[0], m_cellInterfacesLvl[0], resumeDecomposition, m_parallelPreTreatment, m_order);
     if (m_dimension == 0) {
       // Problem when initializing the geometry
       throw ErrorECOGEN("Error when initializing the problem geometry");
@@ -232,6 +261,7 @@ void Run::initialize()
   for (unsigned int p = 0; p < m_probes.size(); p++) m_probes[p]->initializeOutput(*bufferCellLeft);
   for (unsigned int g = 0; g < m_globalQuantities.size(); g++) m_globalQuantities[g]->initializeOutput(*bufferCellLeft);
   for (unsigned int b = 0; b < m_recordBoundaries.size(); b++) m_recordBoundaries[b]->initializeOutput(m_cellInterfacesLvl);
+  if (m_checkpoint != nullptr) m_checkpoint->initializeCheckpoint(bufferCellLeft);
 
   //12) Resume simulation
   //----------------------
@@ -252,7 +282,7 @@ void Run::initialize()
   if (m_restartMeshMapping) {
     try {
       this->restartSimulationMeshMapping(domains, m_mesh);
-      MPI_Barrier(MPI_COMM_WORLD);
+      MPI_Barrier(computingComm);
     }
     catch (ErrorECOGEN&) {
       for (unsigned int k = 0; k < domains.size(); k++) {
@@ -293,6 +323,7 @@ void Run::initialize()
       // m_alphaWanted = 0.;
       //-----
       m_outPut->initializeOutputInfos();
+      m_outPut->reduceMemoryStats();
       if (rankCpu == 0) m_outPut->writeInfos();
       m_outPut->saveInfoCells();
       if (m_mesh->getType() == AMR) m_outPut->printTree(m_mesh, m_cellsLvl, m_resumeAMRsaveFreq);
@@ -417,12 +448,17 @@ void Run::resumeSimulation()
 {
   //Reconstruct the AMR mesh if any and get physical data from resume point
   try {
-    if (m_mesh->getType() == AMR) {
-      if (m_resumeSimulation % m_resumeAMRsaveFreq == 0) {
-        m_outPut->readTree(m_mesh, m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, m_addPhys, m_nbCellsTotalAMR);
+    if (m_resumeFromCheckpoint) {
+      m_checkpoint->readData(m_mesh, m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, m_addPhys, m_nbCellsTotalAMR);
+    }
+    else {
+      if (m_mesh->getType() == AMR) {
+        if (m_resumeSimulation % m_resumeAMRsaveFreq == 0) {
+          m_outPut->readTree(m_mesh, m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, m_addPhys, m_nbCellsTotalAMR);
+        }
       }
+      m_outPut->readResults(m_mesh, m_cellsLvl);
     }
-    m_outPut->readResults(m_mesh, m_cellsLvl);
   }
   catch (ErrorECOGEN&) {
     throw;
@@ -437,8 +473,7 @@ void Run::resumeSimulation()
   }
   if (Ncpu > 1) {
     for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
-      parallel.communicationsPrimitives(m_eos, lvl);
-      parallel.communicationsTransports(lvl);
+      parallel.communicationsPrimitives(m_eos, lvl); //Transports are part of the primitive messages
     }
   }
   for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
@@ -459,6 +494,16 @@ void Run::resumeSimulation()
     }
   }
 
+  //Cells of a checkpoint are distributed by level-0 key ranges: balance the load of the restored tree
+  if (m_resumeFromCheckpoint && m_mesh->getType() == AMR && Ncpu > 1) {
+    m_stat.startAMRTime();
+    m_mesh->parallelLoadBalancingAMR(m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, m_order, m_addPhys, m_eos, m_nbCellsTotalAMR, m_solidDomains, true);
+    for (unsigned int p = 0; p < m_probes.size(); p++) {
+      m_probes[p]->locateProbeInMesh(m_cellsLvl[0], m_mesh->getNumberCells());
+    }
+    m_stat.endAMRTime();
+  }
+
   if (rankCpu == 0) std::cout << " OK" << std::endl;
 }
 
@@ -468,6 +513,8 @@ void Run::solver()
 {
   int nbCellsTotalAMRMax = m_nbCellsTotalAMR;
   double dtMax;
+  int iterations(0);         //Iterations computed by this run (resumed ones excluded)
+  double cellIterations(0.); //Local cells times iterations computed by this run (performance analysis)
 
   //-------------------
   //Time iterative loop
@@ -504,6 +551,8 @@ void Run::solver()
     m_physicalTime   += m_dt;
     TB->physicalTime  = m_physicalTime;
     m_iteration++;
+    iterations++;
+    cellIterations += m_nbCellsTotalAMR;
     //Managing output files printing / End of time iterative loop
     if (m_timeControlIterations) {
       if (m_iteration % m_freq == 0) {
@@ -540,6 +589,7 @@ void Run::solver()
     }
     if (print) {
       m_stat.updateComputationTime();
+      m_stat.startStageTime(OUTPUTS);
       //General printings
       //Only for few test case
       //-----
@@ -561,6 +611,7 @@ void Run::solver()
       // } while (mass < 0.999*m_massWanted && m_alphaWanted > 0.001);
       // if (m_alphaWanted < 1.e-10) m_alphaWanted = 0.;
       //-----
+      m_outPut->reduceMemoryStats();
       if (rankCpu == 0) m_outPut->writeInfos();
       m_outPut->saveInfoCells();
       if (m_mesh->getType() == AMR) m_outPut->printTree(m_mesh, m_cellsLvl, m_resumeAMRsaveFreq);
@@ -570,6 +621,7 @@ void Run::solver()
       m_outPut->writeResults(m_mesh, m_cellsLvl);
       if (rankCpu == 0) std::cout << "OK" << std::endl;
       print = false;
+      m_stat.endStageTime(OUTPUTS);
     }
 
     //Printing cuts data
@@ -587,12 +639,22 @@ void Run::solver()
       if (m_recordBoundaries[b]->getNextTime() <= m_physicalTime) m_recordBoundaries[b]->writeResults(m_cellInterfacesLvl);
     }
 
+    //Writing checkpoint
+    if (m_checkpoint != nullptr && m_checkpoint->isToWrite(m_iteration, computeFini)) {
+      m_stat.updateComputationTime();
+      m_checkpoint->write(m_mesh, m_cellsLvl);
+    }
+
     //-------------------------- TIME STEP UPDATING --------------------------
     m_dt = m_dtNext;
 
   } //time iterative loop end
+  m_outPut->drainWritings();
+  m_stat.updateComputationTime();
+  m_outPut->savePerformance(iterations, cellIterations);
   if (rankCpu == 0) std::cout << "T" << m_numTest << " | -------------------------------------------" << std::endl;
-  MPI_Barrier(MPI_COMM_WORLD);
+  WarmStart::printReport(m_numTest);
+  MPI_Barrier(computingComm);
   if (m_mesh->getType() == AMR) {
     double localLoad(0.);
     for (unsigned int i = 0; i < m_cellsLvl[0].size(); i++) {
@@ -649,15 +711,13 @@ void Run::integrationProcedure(double& dt, int lvl, double& dtMax, int& nbCellsT
     }
     if (Ncpu > 1) {
       m_stat.startCommunicationTime();
-      parallel.communicationsSlopes(lvl);
-      if (lvl > 0) {
-        parallel.communicationsSlopes(lvl - 1);
-      }
+      parallel.communicationsSlopesLevels(lvl);
       m_stat.endCommunicationTime();
     }
   }
   if (lvl < m_lvlMax) {
     if (m_numberAddPhys) {
+      if (m_narrowBand != nullptr) m_narrowBand->update(m_cellsLvl[lvl], m_cellInterfacesLvl[lvl]);
       for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
         if (!m_cellsLvl[lvl][i]->getSplit()) {
           m_cellsLvl[lvl][i]->prepareAddPhys();
@@ -665,9 +725,7 @@ void Run::integrationProcedure(double& dt, int lvl, double& dtMax, int& nbCellsT
       }
       if (Ncpu > 1) {
         m_stat.startCommunicationTime();
-        for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) {
-          m_addPhys[pa]->communicationsAddPhys(m_dimension, lvl);
-        }
+        parallel.communicationsAddPhys(m_addPhys, m_dimension, lvl);
         m_stat.endCommunicationTime();
       }
     }
@@ -688,10 +746,7 @@ void Run::integrationProcedure(double& dt, int lvl, double& dtMax, int& nbCellsT
       }
       if (Ncpu > 1) {
         m_stat.startCommunicationTime();
-        parallel.communicationsSlopes(lvl);
-        if (lvl > 0) {
-          parallel.communicationsSlopes(lvl - 1);
-        }
+        parallel.communicationsSlopesLevels(lvl);
         m_stat.endCommunicationTime();
       }
     }
@@ -707,18 +762,35 @@ void Run::integrationProcedure(double& dt, int lvl, double& dtMax, int& nbCellsT
 void Run::advancingProcedure(double& dt, int& lvl, double& dtMax)
 {
   //1) Finite volume scheme for hyperbolic systems (Godunov or MUSCL)
+  m_stat.startStageTime(HYPERBOLIC);
   if (m_order == "FIRSTORDER") {
     this->solveHyperbolic(dt, lvl, dtMax);
   }
-  else {
+  else if (m_timeIntegration == MUSCLHANCOCK) {
     this->solveHyperbolicO2(dt, lvl, dtMax);
   }
+  else {
+    this->solveHyperbolicRungeKutta(dt, lvl, dtMax);
+  }
+  m_stat.endStageTime(HYPERBOLIC);
   //2) Finite volume scheme for additional physics
-  if (m_numberAddPhys) this->solveAdditionalPhysics(dt, lvl);
+  if (m_numberAddPhys) {
+    m_stat.startStageTime(ADDPHYS);
+    this->solveAdditionalPhysics(dt, lvl);
+    m_stat.endStageTime(ADDPHYS);
+  }
   //3) Source terms integration before relaxations
-  if (m_numberSources) this->solveSourceTerms(dt, lvl);
+  if (m_numberSources) {
+    m_stat.startStageTime(SOURCES);
+    this->solveSourceTerms(dt, lvl);
+    m_stat.endStageTime(SOURCES);
+  }
   //4) Relaxations to equilibria
-  if (m_model->getRelaxations()->size() > 0) this->solveRelaxations(dt, lvl);
+  if (m_model->getRelaxations()->size() > 0) {
+    m_stat.startStageTime(RELAXATIONS);
+    this->solveRelaxations(dt, lvl);
+    m_stat.endStageTime(RELAXATIONS);
+  }
   //5) Averaging childs cells in mother cell (if AMR)
   if (lvl < m_lvlMax) {
     for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
@@ -836,10 +908,7 @@ void Run::solveHyperbolicO2(double& dt, int& lvl, double& dtMax)
     }
     if (Ncpu > 1) {
       m_stat.startCommunicationTime();
-      parallel.communicationsSlopes(lvl);
-      if (lvl > 0) {
-        parallel.communicationsSlopes(lvl - 1);
-      }
+      parallel.communicationsSlopesLevels(lvl);
       m_stat.endCommunicationTime();
     }
   }
@@ -868,6 +937,85 @@ void Run::solveHyperbolicO2(double& dt, int& lvl, double& dtMax)
 
 //***********************************************************************
 
+void Run::solveHyperbolicRungeKutta(double& dt, int& lvl, double& dtMax)
+{
+  //Low-storage SSP Runge-Kutta in Shu-Osher form (Gottlieb & Shu 1998): U(i) = coefUn * Un + coefStage * (U(i-1) + dt * L(U(i-1))).
+  //The two registers are the primitive variables of the cells and their conservative save (Un).
+  static const double coefRK2[2][2] = {{0., 1.}, {0.5, 0.5}};
+  static const double coefRK3[3][2] = {{0., 1.}, {0.75, 0.25}, {1. / 3., 2. / 3.}};
+  const double(*coefs)[2] = (m_timeIntegration == SSPRK2) ? coefRK2 : coefRK3;
+  int numberStages(m_timeIntegration);
+
+  for (int stage = 0; stage < numberStages; stage++) {
+    //1) Slopes on the previous stage (those of the first stage are computed in the integration procedure)
+    //----------------------------------------------------------------------------------------------------
+    if (stage > 0) {
+      if (m_mesh->getType() != TypeM::UNS) {
+        for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) {
+          if (!m_cellInterfacesLvl[lvl][i]->getSplit()) {
+            m_cellInterfacesLvl[lvl][i]->computeSlopes();
+          }
+        }
+      }
+      else {
+        for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
+          if (!m_cellsLvl[lvl][i]->getSplit()) {
+            m_cellsLvl[lvl][i]->computeGradientsO2();
+            m_cellsLvl[lvl][i]->limitGradientsO2(*m_globalLimiter);
+          }
+        }
+      }
+      if (Ncpu > 1) {
+        m_stat.startCommunicationTime();
+        parallel.communicationsSlopesLevels(lvl);
+        m_stat.endCommunicationTime();
+      }
+    }
+
+    //2) Spatial second order scheme
+    //------------------------------
+    for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) {
+      if (!m_cellInterfacesLvl[lvl][i]->getSplit()) {
+        m_cellInterfacesLvl[lvl][i]->computeFlux(
+          dtMax, *m_globalLimiter, *m_interfaceLimiter, *m_globalVolumeFractionLimiter, *m_interfaceVolumeFractionLimiter);
+      }
+    }
+
+    //3) Stage time evolution
+    //-----------------------
+    for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
+      if (!m_cellsLvl[lvl][i]->getSplit()) {
+        m_cellsLvl[lvl][i]->timeEvolutionRungeKutta(dt, m_symmetry, coefs[stage][0], coefs[stage][1]);
+        m_cellsLvl[lvl][i]->buildPrim();
+        m_cellsLvl[lvl][i]->setToZeroCons();
+      }
+    }
+    if (stage == numberStages - 1) break;
+
+    //4) Option: Relaxations of the intermediate stage (same treatment as the MUSCL-Hancock prediction)
+    //-------------------------------------------------------------------------------------------------
+    if (m_model->getRelaxations()->size() > 0) {
+      for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
+        if (!m_cellsLvl[lvl][i]->getSplit()) {
+          m_model->relaxations(m_cellsLvl[lvl][i], dt);
+          m_model->correctionEnergy(m_cellsLvl[lvl][i]);
+          m_cellsLvl[lvl][i]->fulfillState();
+        }
+      }
+    }
+
+    //5) Intermediate stage communications
+    //------------------------------------
+    if (Ncpu > 1) {
+      m_stat.startCommunicationTime();
+      parallel.communicationsPrimitives(m_eos, lvl);
+      m_stat.endCommunicationTime();
+    }
+  }
+}
+
+//***********************************************************************
+
 void Run::solveHyperbolic(double& dt, int& lvl, double& dtMax)
 {
   //1) Spatial scheme
@@ -894,6 +1042,113 @@ void Run::solveHyperbolic(double& dt, int& lvl, double& dtMax)
 //***********************************************************************
 
 void Run::solveAdditionalPhysics(double& dt, int& lvl)
+{
+  if (m_superTimeStepping) {
+    //Diffusive additional physics by super time stepping, the others by one explicit step
+    if (!m_addPhysOthers.empty()) this->explicitStepAdditionalPhysics(m_addPhysOthers, dt, lvl);
+    if (!m_addPhysDiffusive.empty()) this->superTimeSteppingAdditionalPhysics(dt, lvl);
+  }
+  else {
+    this->explicitStepAdditionalPhysics(m_addPhys, dt, lvl);
+  }
+}
+
+//***********************************************************************
+
+void Run::explicitStepAdditionalPhysics(const std::vector<AddPhys*>& addPhys, double& dt, int& lvl)
+{
+  this->computeFluxesAdditionalPhysics(addPhys, lvl);
+
+  //Time evolution for additional physics
+  //When they are all interface-localized, the increments vanish outside the narrow band and the cells sharing one of its faces
+  bool narrowBandOnly(m_narrowBand != nullptr);
+  for (unsigned int pa = 0; pa < addPhys.size(); pa++) {
+    narrowBandOnly = narrowBandOnly && addPhys[pa]->isInterfaceLocalized();
+  }
+  if (narrowBandOnly) {
+    const std::vector<Cell*>& bandCells(m_narrowBand->getCells());
+    for (unsigned int i = 0; i < bandCells.size(); i++) {
+      bandCells[i]->timeEvolutionAddPhys(dt);
+      bandCells[i]->buildPrim();
+      bandCells[i]->setToZeroCons();
+    }
+    const std::vector<Cell*>& fringeCells(m_narrowBand->getFringeCells());
+    for (unsigned int i = 0; i < fringeCells.size(); i++) {
+      fringeCells[i]->timeEvolutionAddPhys(dt);
+      fringeCells[i]->buildPrim();
+      fringeCells[i]->setToZeroCons();
+    }
+#ifdef DEBUG
+    //No increment may be left in the other cells of the level
+    for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
+      const Flux* cons(m_cellsLvl[lvl][i]->getCons());
+      if (!m_cellsLvl[lvl][i]->getSplit() && (cons->getMomentum().norm() != 0. || cons->getEnergyMix() != 0.)) {
+        Errors::errorMessage("explicitStepAdditionalPhysics: additional-physics increment left outside the narrow band");
+      }
+    }
+#endif // DEBUG
+    return;
+  }
+  for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
+    if (!m_cellsLvl[lvl][i]->getSplit()) {
+      m_cellsLvl[lvl][i]->timeEvolutionAddPhys(dt); //Obtention des cons pour shema sur (Un+1-Un)/dt
+      m_cellsLvl[lvl][i]->buildPrim();              //On peut reconstruire Prim a partir de m_cons
+      m_cellsLvl[lvl][i]->setToZeroCons();          //Mise a zero des cons pour shema spatial sur dU/dt : permet de s affranchir du pas de temps
+    }
+  }
+}
+
+//***********************************************************************
+
+void Run::superTimeSteppingAdditionalPhysics(double& dt, int& lvl)
+{
+  //1) Diffusive time-step limit of the level and number of stages
+  //--------------------------------------------------------------
+  //The first-order Runge-Kutta-Legendre scheme (RKL1) with s stages is stable for dt <= (s^2 + s) / 2 dtDiffusive
+  double dtDiffusive(1.e10), diffusivity(0.);
+  for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
+    if (!m_cellsLvl[lvl][i]->getSplit()) {
+      diffusivity = 0.;
+      for (unsigned int pa = 0; pa < m_addPhysDiffusive.size(); pa++) {
+        diffusivity = std::max(diffusivity, m_addPhysDiffusive[pa]->computeDiffusivity(m_cellsLvl[lvl][i]));
+      }
+      if (diffusivity > 0.) {
+        double lCFL(m_cellsLvl[lvl][i]->getElement()->getLCFL());
+        dtDiffusive = std::min(dtDiffusive, 0.5 * lCFL * lCFL / diffusivity); //lCFL already includes the multi-dimensional reduction
+      }
+    }
+  }
+  if (Ncpu > 1) {
+    parallel.computeDt(dtDiffusive);
+  }
+  int numberStages(1);
+  while (0.5 * (numberStages * numberStages + numberStages) * 0.9 * dtDiffusive < dt) numberStages++; //0.9: safety factor
+  m_stat.addSuperTimeStep(numberStages);
+
+  //2) Stages: U_j = mu_j (U_j-1 + w dt L(U_j-1)) + nu_j U_j-2, with w = 2 / (s^2 + s), mu_j = (2j - 1) / j, nu_j = 1 - mu_j
+  //-----------------------------------------------------------------------------------------------------------------------
+  //A single stage is the explicit step
+  while (m_consStages.size() < m_cellsLvl[lvl].size()) {
+    m_consStages.push_back(nullptr);
+    m_model->allocateCons(&m_consStages.back());
+  }
+  double w(2. / (numberStages * numberStages + numberStages));
+  for (int j = 1; j <= numberStages; j++) {
+    double mu((2. * j - 1.) / j), nu(1. - mu);
+    this->computeFluxesAdditionalPhysics(m_addPhysDiffusive, lvl);
+    for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
+      if (!m_cellsLvl[lvl][i]->getSplit()) {
+        m_cellsLvl[lvl][i]->timeEvolutionAddPhysStage(w * dt, mu, nu, m_consStages[i]);
+        m_cellsLvl[lvl][i]->buildPrim();
+        m_cellsLvl[lvl][i]->setToZeroCons();
+      }
+    }
+  }
+}
+
+//***********************************************************************
+
+void Run::computeFluxesAdditionalPhysics(const std::vector<AddPhys*>& addPhys, int& lvl)
 {
   //1) Preparation of variables for additional (gradients computations, etc) and communications
   //-------------------------------------------------------------------------------------------
@@ -902,6 +1157,10 @@ void Run::solveAdditionalPhysics(double& dt, int& lvl)
     parallel.communicationsPrimitives(m_eos, lvl);
     m_stat.endCommunicationTime();
   }
+  if (m_narrowBand != nullptr) {
+    m_narrowBand->update(m_cellsLvl[lvl], m_cellInterfacesLvl[lvl]);
+    m_stat.addActiveCells(ADDPHYS, m_narrowBand->getCells().size(), m_narrowBand->getNumberCandidates());
+  }
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
     if (!m_cellsLvl[lvl][i]->getSplit()) {
       m_cellsLvl[lvl][i]->prepareAddPhys();
@@ -909,35 +1168,48 @@ void Run::solveAdditionalPhysics(double& dt, int& lvl)
   }
   if (Ncpu > 1) {
     m_stat.startCommunicationTime();
-    for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) {
-      m_addPhys[pa]->communicationsAddPhys(m_dimension, lvl);
-    }
+    parallel.startCommunicationsAddPhys(addPhys, m_dimension, lvl);
     m_stat.endCommunicationTime();
   }
 
   //2) Additional physics fluxes determination (Surface tensions, viscosity, conductivity, ...)
   //-------------------------------------------------------------------------------------------
   //Calcul de la sum des flux des physiques additionnelles que l on stock dans m_cons de chaque cell
-  for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) {
+  //The interfaces without ghost cell are treated while the additional-physics vectors are exchanged
+  //The interface-localized additional physics only work on the narrow band (their terms vanish outside)
+  for (unsigned int pa = 0; pa < addPhys.size(); pa++) {
+    if (m_narrowBand != nullptr && addPhys[pa]->isInterfaceLocalized()) {
+      const std::vector<CellInterface*>& bandCellInterfaces(m_narrowBand->getCellInterfaces());
+      for (unsigned int i = 0; i < bandCellInterfaces.size(); i++) {
+        bandCellInterfaces[i]->computeFluxAddPhys(*addPhys[pa]);
+      }
+      const std::vector<Cell*>& bandCells(m_narrowBand->getCells());
+      for (unsigned int i = 0; i < bandCells.size(); i++) {
+        bandCells[i]->addNonConsAddPhys(*addPhys[pa], m_symmetry);
+      }
+      continue;
+    }
     for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) {
-      if (!m_cellInterfacesLvl[lvl][i]->getSplit()) {
-        m_cellInterfacesLvl[lvl][i]->computeFluxAddPhys(*m_addPhys[pa]);
+      if (!m_cellInterfacesLvl[lvl][i]->getSplit() && !m_cellInterfacesLvl[lvl][i]->hasGhostCell()) {
+        m_cellInterfacesLvl[lvl][i]->computeFluxAddPhys(*addPhys[pa]);
       }
     }
     for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
       if (!m_cellsLvl[lvl][i]->getSplit()) {
-        m_cellsLvl[lvl][i]->addNonConsAddPhys(*m_addPhys[pa], m_symmetry);
+        m_cellsLvl[lvl][i]->addNonConsAddPhys(*addPhys[pa], m_symmetry);
       }
     }
   }
-
-  //3) Time evolution for additional physics
-  //----------------------------------------
-  for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
-    if (!m_cellsLvl[lvl][i]->getSplit()) {
-      m_cellsLvl[lvl][i]->timeEvolutionAddPhys(dt); //Obtention des cons pour shema sur (Un+1-Un)/dt
-      m_cellsLvl[lvl][i]->buildPrim();              //On peut reconstruire Prim a partir de m_cons
-      m_cellsLvl[lvl][i]->setToZeroCons();          //Mise a zero des cons pour shema spatial sur dU/dt : permet de s affranchir du pas de temps
+  if (Ncpu > 1) {
+    m_stat.startCommunicationTime();
+    parallel.finishCommunicationsAddPhys(m_dimension, lvl);
+    m_stat.endCommunicationTime();
+    for (unsigned int pa = 0; pa < addPhys.size(); pa++) {
+      for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) {
+        if (!m_cellInterfacesLvl[lvl][i]->getSplit() && m_cellInterfacesLvl[lvl][i]->hasGhostCell()) {
+          m_cellInterfacesLvl[lvl][i]->computeFluxAddPhys(*addPhys[pa]);
+        }
+      }
     }
   }
 }
@@ -946,26 +1218,48 @@ void Run::solveAdditionalPhysics(double& dt, int& lvl)
 
 void Run::solveSourceTerms(double& dt, int& lvl)
 {
+  //Compacted list of the cells belonging to the physical entity of at least one source
+  int numberCandidates(0);
+  m_activeCells.clear();
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
     if (!m_cellsLvl[lvl][i]->getSplit()) {
+      numberCandidates++;
       for (unsigned int s = 0; s < m_sources.size(); s++) {
-        m_sources[s]->integrateSourceTerms(m_cellsLvl[lvl][i], dt);
+        if (m_sources[s]->appliesTo(m_cellsLvl[lvl][i])) {
+          m_activeCells.push_back(i);
+          break;
+        }
       }
-      m_cellsLvl[lvl][i]->setToZeroCons();
     }
   }
+  m_stat.addActiveCells(SOURCES, m_activeCells.size(), numberCandidates);
+
+  for (unsigned int a = 0; a < m_activeCells.size(); a++) {
+    Cell* cell(m_cellsLvl[lvl][m_activeCells[a]]);
+    for (unsigned int s = 0; s < m_sources.size(); s++) {
+      m_sources[s]->integrateSourceTerms(cell, dt);
+    }
+    cell->setToZeroCons();
+  }
 }
 
 //***********************************************************************
 
 void Run::solveRelaxations(double& dt, int& lvl)
 {
-  //Relaxations
+  //Relaxations on the compacted list of the cells where at least one of them is active (pure-phase or already relaxed cells are skipped)
+  int numberCandidates(0);
+  m_activeCells.clear();
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
     if (!m_cellsLvl[lvl][i]->getSplit()) {
-      m_model->relaxations(m_cellsLvl[lvl][i], dt);
+      numberCandidates++;
+      if (m_model->needsRelaxations(m_cellsLvl[lvl][i])) m_activeCells.push_back(i);
     }
   }
+  m_stat.addActiveCells(RELAXATIONS, m_activeCells.size(), numberCandidates);
+  for (unsigned int a = 0; a < m_activeCells.size(); a++) {
+    m_model->relaxations(m_cellsLvl[lvl][m_activeCells[a]], dt);
+  }
   //Reset of colour function (transports) using volume fraction
   for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) {
     if (m_addPhys[pa]->reinitializationActivated()) {
@@ -978,6 +1272,7 @@ void Run::solveRelaxations(double& dt, int& lvl)
     }
   }
   //Prepare additional physics terms for next primitive build and/or time-step
+  if (m_narrowBand != nullptr) m_narrowBand->update(m_cellsLvl[lvl], m_cellInterfacesLvl[lvl]);
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
     if (!m_cellsLvl[lvl][i]->getSplit()) {
       m_cellsLvl[lvl][i]->prepareAddPhys();
@@ -985,18 +1280,16 @@ void Run::solveRelaxations(double& dt, int& lvl)
   }
   if (Ncpu > 1) {
     m_stat.startCommunicationTime();
-    for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) {
-      m_addPhys[pa]->communicationsAddPhys(m_dimension, lvl);
-    }
+    parallel.communicationsAddPhys(m_addPhys, m_dimension, lvl);
     m_stat.endCommunicationTime();
   }
   //Correction of energies for PUEq model
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
     if (!m_cellsLvl[lvl][i]->getSplit()) {
       m_model->correctionEnergy(m_cellsLvl[lvl][i]);
-      m_cellsLvl[lvl][i]->fulfillState();
     }
   }
+  m_model->fulfillStateBatch(m_cellsLvl[lvl]);
 }
 
 //***********************************************************************
@@ -1068,6 +1361,10 @@ void Run::finalize()
   for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) {
     delete m_addPhys[pa];
   }
+  for (unsigned int i = 0; i < m_consStages.size(); i++) {
+    delete m_consStages[i];
+  }
+  m_consStages.clear();
   for (unsigned int s = 0; s < m_sources.size(); s++) {
     delete m_sources[s];
   }
@@ -1136,6 +1433,8 @@ void Run::finalize()
   destroy(m_interfaceVolumeFractionLimiter);
   destroy(m_input);
   destroy(m_outPut);
+  destroy(m_checkpoint);
+  destroy(m_narrowBand);
   for (unsigned int d = 0; d < m_solidDomains.size(); d++) {
     delete m_solidDomains[d];
   }
@@ -50,9 +50,11 @@ class Run;
 #include "Order2/HeaderLimiter.h"
 #include "AdditionalPhysics/HeaderQuantitiesAddPhys.h"
 #include "AdditionalPhysics/HeaderAddPhys.h"
+#include "AdditionalPhysics/NarrowBand.h"
 
 #include "InputOutput/Input.h"
 #include "InputOutput/Output.h"
+#include "InputOutput/Checkpoint.h"
 #include "timeStats.h"
 
 #include "Relaxations/HeaderRelaxations.h"
@@ -86,7 +88,11 @@ class Run
     void advancingProcedure(double& dt, int& lvl, double& dtMax);
     void solveHyperbolic(double& dt, int& lvl, double& dtMax);
     void solveHyperbolicO2(double& dt, int& lvl, double& dtMax);
+    void solveHyperbolicRungeKutta(double& dt, int& lvl, double& dtMax);
     void solveAdditionalPhysics(double& dt, int& lvl);
+    void explicitStepAdditionalPhysics(const std::vector<AddPhys*>& addPhys, double& dt, int& lvl);
+    void superTimeSteppingAdditionalPhysics(double& dt, int& lvl);
+    void computeFluxesAdditionalPhysics(const std::vector<AddPhys*>& addPhys, int& lvl);
     void solveSourceTerms(double& dt, int& lvl);
     void solveRelaxations(double& dt, int& lvl);
     void verifyErrors() const;
@@ -110,6 +116,7 @@ class Run
     int m_MRF;                                 //!<source term for Moving Reference Frame computation index(in the list of source term)
     bool m_viscous;                            //!<Viscous flow additionnal physic option required to set proper wall boundary condition (false by default)
     std::string m_order;                       //!<Precision scheme order (firstorder or secondOrder)
+    TimeIntegration m_timeIntegration;         //!<Second-order time integration (MUSCL-Hancock or low-storage SSP Runge-Kutta)
     bool m_extractRefLength;                   //!<Option to extract cells' reference length
     std::vector<GeometricalDomain*> m_solidDomains; //!<Solid domains (immersed boundaries)
 
@@ -130,6 +137,7 @@ class Run
                                                             //!< (or between a cell and a physical domain boundary)
     Eos** m_eos;                               //!<Array of Equations of states: Contains fluid EOS parameters
     std::vector<AddPhys*> m_addPhys;           //!<Vector of Additional physics
+    NarrowBand* m_narrowBand;                  //!<Narrow band around the interfaces for the interface-localized additional physics (or nullptr)
     Symmetry* m_symmetry;                      //!<Specific object for symmetry (cylindrical or spherical) if active
     std::vector<Source*> m_sources;            //!<Vector of source terms
     Limiter* m_globalLimiter;                  //!<Slope limiter type object for second order in space
@@ -147,6 +155,13 @@ class Run
     int m_iteration;                           //!<time iteration number
     int m_resumeSimulation;                    //!<File number for resuming a simulation
     int m_resumeAMRsaveFreq;                   //!<Frequency at which a save to resume a simulation is done (usefull only for AMR)
+    bool m_resumeFromCheckpoint;               //!<Choice to resume from a checkpoint file (m_resumeSimulation is then the checkpoint number)
+    bool m_compactExchange;                    //!<Compact exchange of the ghost cells between CPUs (no EOS indexes, fused slope levels)
+    bool m_superTimeStepping;                  //!<Super time stepping (Runge-Kutta-Legendre stages) of the diffusive additional physics
+    std::vector<AddPhys*> m_addPhysDiffusive;  //!<Additional physics advanced by super time stepping (viscosity, conductivity)
+    std::vector<AddPhys*> m_addPhysOthers;     //!<Additional physics advanced by one explicit step when super time stepping is used
+    std::vector<unsigned int> m_activeCells;   //!<Compacted indexes of the cells of a level on which relaxations or sources are active
+    std::vector<Flux*> m_consStages;           //!<Conservative variables of the previous stage of each cell of a level (super time stepping)
 
     //Input/Output attributes
     Input* m_input;                            //!<Input object
@@ -155,6 +170,7 @@ class Run
     std::vector<Output*> m_probes;             //!<Vector of output objects for probes
     std::vector<Output*> m_globalQuantities;   //!<Vector of output objects for global quantities (mass or total energy)
     std::vector<Output*> m_recordBoundaries;   //!<Vector of output object for boundaries data recording
+    Checkpoint* m_checkpoint;                  //!<Native binary checkpoint/restart files (nullptr if not used)
     timeStats m_stat;                          //!<Object linked to computational time statistics
     double* m_pMax;                            //!<Maximal pressure found between each written output (only for few test cases)
     double* m_pMaxWall;                        //!<Coordinate of the maximal pressure found between each written output (only for few test cases)
@@ -180,6 +196,7 @@ class Run
     friend class OutputBoundaryFluxGNU;
     friend class OutputBoundaryAllGNU;
     friend class Mesh;
+    friend class Checkpoint;
 };
 
 #endif // RUN_H
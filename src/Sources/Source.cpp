@@ -37,3 +37,12 @@ Source::Source(int physicalEntity) : m_physicalEntity(physicalEntity) {}
 //***********************************************************************
 
 Source::~Source() {}
+
+//***********************************************************************
+
+bool Source::appliesTo(Cell* cell) const
+{
+  // For unstructured mesh if source term is not applied on specific physicalEntity all cells include it.
+  // For Cartesian mesh, there is no physicalEntity (default value is 0) thus source is applied on all cells.
+  return m_physicalEntity == 0 || cell->getElement()->getAppartenancePhysique() == m_physicalEntity;
+}
@@ -85,6 +85,10 @@ class Source
 
     virtual int getPhysicalEntity() { return m_physicalEntity; }
 
+    //! \brief     Membership of the cell to the physical entity of the source (whole domain if 0)
+    //! \param     cell           cell to test
+    bool appliesTo(Cell* cell) const;
+
   protected:
     int m_physicalEntity;
 };
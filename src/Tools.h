@@ -149,6 +149,14 @@ enum LimiterType
   SUPERBEE = 2
 };
 
+//! \brief     Enumeration for the second-order time integration (MUSCL-Hancock predictor-corrector or low-storage SSP Runge-Kutta)
+enum TimeIntegration
+{
+  MUSCLHANCOCK = 0,
+  SSPRK2       = 2,
+  SSPRK3       = 3
+};
+
 //! \brief     Enumeration for the flow variables
 enum class Variable
 {
@@ -112,6 +112,14 @@ class Transport
     //! \param     slope                  value of the slope
     //! \param     distance               distance between the center and the corresponding edge of the cell
     void extrapolate(const double& slope, const double& distance);
+    //! \brief     Set the value to the one of transport extrapolated from the center of the cell to its edge
+    //! \param     transport              transport variable at the center of the cell
+    //! \param     slope                  value of the slope
+    //! \param     distance               distance between the center and the corresponding edge of the cell
+    void copyAndExtrapolate(const Transport& transport, const double& slope, const double& distance)
+    {
+      m_value = transport.m_value + slope * distance;
+    }
     //Second order on cartesian grids
     //! \brief     Compute the slope at the edge of a cell
     //! \param     valueLeft              transport value of the left cell
@@ -0,0 +1,92 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#include "WarmStart.h"
+#include "Parallel/Parallel.h"
+#include <iomanip>
+
+bool WarmStart::active(false);
+long long WarmStart::solves[NUMBERWARMSTARTSOLVERS][2]     = {};
+long long WarmStart::iterations[NUMBERWARMSTARTSOLVERS][2] = {};
+long long WarmStart::fallbacks[NUMBERWARMSTARTSOLVERS]     = {};
+
+//***********************************************************************
+
+void WarmStart::record(const WarmStartSolver& solver, const int& numberIterations, const bool& warm, const bool& fallback)
+{
+  if (!active) return;
+  solves[solver][warm]++;
+  iterations[solver][warm] += numberIterations;
+  if (fallback) fallbacks[solver]++;
+}
+
+//***********************************************************************
+
+void WarmStart::reset()
+{
+  for (int s = 0; s < NUMBERWARMSTARTSOLVERS; s++) {
+    for (int w = 0; w < 2; w++) {
+      solves[s][w]     = 0;
+      iterations[s][w] = 0;
+    }
+    fallbacks[s] = 0;
+  }
+}
+
+//***********************************************************************
+
+void WarmStart::printReport(const int& numTest)
+{
+  if (!active) return;
+
+  const int numberCounters(5 * NUMBERWARMSTARTSOLVERS);
+  long long localCounters[numberCounters], counters[numberCounters];
+  for (int s = 0; s < NUMBERWARMSTARTSOLVERS; s++) {
+    localCounters[5 * s]     = solves[s][0];
+    localCounters[5 * s + 1] = iterations[s][0];
+    localCounters[5 * s + 2] = solves[s][1];
+    localCounters[5 * s + 3] = iterations[s][1];
+    localCounters[5 * s + 4] = fallbacks[s];
+  }
+  MPI_Reduce(localCounters, counters, numberCounters, MPI_LONG_LONG, MPI_SUM, 0, computingComm);
+  if (rankCpu != 0) return;
+
+  const char* names[NUMBERWARMSTARTSOLVERS] = {"relaxed pressure", "inlet tank", "inflow", "saturation temperature"};
+  for (int s = 0; s < NUMBERWARMSTARTSOLVERS; s++) {
+    long long* c(&counters[5 * s]);
+    if (c[0] + c[2] == 0) continue;
+    double coldAverage(c[0] > 0 ? static_cast<double>(c[1]) / c[0] : 0.);
+    double warmAverage(c[2] > 0 ? static_cast<double>(c[3]) / c[2] : 0.);
+    std::cout << "T" << numTest << " | Warm start " << names[s] << ": " << c[2] << " warm solves (" << std::setprecision(3) << warmAverage
+              << " it. avg, " << c[4] << " fallbacks), " << c[0] << " cold solves (" << coldAverage << " it. avg)";
+    if (c[0] > 0 && c[2] > 0) std::cout << ", " << coldAverage - warmAverage << " it. saved per solve";
+    std::cout << std::endl;
+  }
+}
@@ -0,0 +1,80 @@
+//
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-.
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| |
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | |
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  |
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)|
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_)
+//      (__)              (_)      (__)     (__)     (__)
+//      Official webSite: https://code-mphi.github.io/ECOGEN/
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names
+//  are listed in the copyright file included with this source
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published
+//  by the Free Software Foundation, either version 3 of the License,
+//  or (at your option) any later version.
+//
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef WARMSTART_H
+#define WARMSTART_H
+
+#include <cmath>
+#include <limits>
+
+//! \brief     Enumeration for the iterative solvers that can be warm started
+enum WarmStartSolver
+{
+  WARMRELAXP             = 0, //!< Relaxed pressure of the pressure relaxations (RelaxationPInfinite, RelaxationPFinite)
+  WARMINLETTANK          = 1, //!< Boundary pressure of the inlet tank boundary conditions
+  WARMINFLOW             = 2, //!< Boundary pressure of the stagnation-state injection boundary condition (Euler)
+  WARMTSAT               = 3, //!< Saturation temperature (Mixture::computeTsat)
+  NUMBERWARMSTARTSOLVERS = 4
+};
+
+//! \class     WarmStart
+//! \brief     Optional warm start of the Newton iterations from the last converged solution of the same cell/face
+//! \details   The last solution is stored by the caller (cell or boundary face) and is only an initial guess:
+//!            if the iterations started from it do not converge, the solver restarts from its usual initialization.
+//!            A cell without cached solution (new AMR cell, cell received by load balancing) holds noSolution().
+//!            Iterations of warm-started and cold-started solves are counted to report the iterations saved.
+class WarmStart
+{
+  public:
+    static void activate(const bool& activeWarmStart) { active = activeWarmStart; };
+    static bool isActive() { return active; };
+
+    //! \brief     Value of an empty cache
+    static double noSolution() { return std::numeric_limits<double>::quiet_NaN(); };
+    static bool isValid(const double& solution) { return !std::isnan(solution); };
+
+    //! \brief     Count a solve of the given solver (only if warm starts are active)
+    //! \param     numberIterations    number of iterations of the solve (including the ones of a failed warm start)
+    //! \param     warm                solve started from a cached solution
+    //! \param     fallback            warm start failed and the solve restarted from the usual initialization
+    static void record(const WarmStartSolver& solver, const int& numberIterations, const bool& warm, const bool& fallback = false);
+    static void reset();
+
+    //! \brief     Print the average iterations of the warm and cold solves summed over the CPUs (collective on computingComm)
+    static void printReport(const int& numTest);
+
+  private:
+    static bool active;
+    static long long solves[NUMBERWARMSTARTSOLVERS][2];     //!< Number of solves, cold [0] and warm [1]
+    static long long iterations[NUMBERWARMSTARTSOLVERS][2]; //!< Number of iterations, cold [0] and warm [1]
+    static long long fallbacks[NUMBERWARMSTARTSOLVERS];     //!< Number of warm starts that did not converge
+};
+
+#endif // WARMSTART_H
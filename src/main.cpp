@@ -51,10 +51,15 @@ int main(int argc, char* argv[])
   std::cerr.rdbuf(Out.rdbuf());
   int errorCode(0);
 
-  //Parallel initialization
-  MPI_Init(&argc, &argv);
-  MPI_Comm_rank(MPI_COMM_WORLD, &rankCpu);
-  MPI_Comm_size(MPI_COMM_WORLD, &Ncpu);
+  //Parallel initialization (result files may be written by a background thread which never calls MPI)
+  int threadSupport(0);
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &threadSupport);
+  config.setThreadedOutput(threadSupport >= MPI_THREAD_FUNNELED);
+  int rankWorld(0), NcpuWorld(1);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rankWorld);
+  MPI_Comm_size(MPI_COMM_WORLD, &NcpuWorld);
+  rankCpu = rankWorld;
+  Ncpu    = NcpuWorld;
 
   if (rankCpu == 0) displayHeader();
   MPI_Barrier(MPI_COMM_WORLD);
@@ -76,11 +81,34 @@ int main(int argc, char* argv[])
     //Find the root of the XML folder
     XMLNode* xmlNode = xmlEcogen.FirstChildElement("ecogen");
 
-    //Loop on the test cases to execute
-    //---------------------------------
+    //Ensemble execution: the CPUs are split in groups running different test cases concurrently
+    //-------------------------------------------------------------------------------------------
+    int numberGroups(1);
+    XMLElement* elementEnsemble = xmlNode->FirstChildElement("ensemble");
+    if (elementEnsemble != NULL) {
+      error = elementEnsemble->QueryIntAttribute("numberGroups", &numberGroups);
+      if (error != XML_NO_ERROR) throw ErrorXMLAttribut("numberGroups", fileName.str(), __FILE__, __LINE__);
+      if (numberGroups < 1 || numberGroups > NcpuWorld) {
+        throw ErrorXMLAttribut("numberGroups (between 1 and the number of CPU)", fileName.str(), __FILE__, __LINE__);
+      }
+    }
+    int group(static_cast<int>(static_cast<long long>(rankWorld) * numberGroups / NcpuWorld));
+    if (numberGroups > 1) {
+      MPI_Comm_split(MPI_COMM_WORLD, group, rankWorld, &computingComm);
+      MPI_Comm_rank(computingComm, &rankCpu);
+      MPI_Comm_size(computingComm, &Ncpu);
+      if (rankWorld == 0) std::cout << "Ensemble execution: test cases distributed on " << numberGroups << " groups of CPU" << std::endl;
+    }
+
+    //Loop on the test cases to execute (test case n is run by group (n-1) modulo number of groups)
+    //---------------------------------------------------------------------------------------------
     int numTestCase(0);
     XMLElement* elementTestCase = xmlNode->FirstChildElement("testCase");
     while (elementTestCase != NULL) {
+      if (numTestCase++ % numberGroups != group) {
+        elementTestCase = elementTestCase->NextSiblingElement("testCase");
+        continue;
+      }
       try {
         XMLNode* xmlNode2 = elementTestCase->FirstChild();
         if (xmlNode2 == NULL) throw ErrorXMLElement("testCase", fileName.str(), __FILE__, __LINE__);
@@ -91,16 +119,16 @@ int main(int argc, char* argv[])
         testLocation << xmlText->Value();
 
         //1) Creation of the test case
-        numTestCase++;
         run = new Run(testLocation.str(), numTestCase);
-        MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Barrier(computingComm);
         if (rankCpu == 0) {
           std::cout << "************************************************************" << std::endl;
           std::cout << "           EXECUTION OF THE TEST CASE NUMBER: " << numTestCase << std::endl;
           std::cout << "************************************************************" << std::endl;
           std::cout << "T" << numTestCase << " | Test case: " << testLocation.str() << std::endl;
+          if (numberGroups > 1) std::cout << "T" << numTestCase << " | Run by group of CPU: " << group << std::endl;
         }
-        MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Barrier(computingComm);
         //2) Execution of the test case
         run->initialize();
         run->solver();
@@ -138,6 +166,7 @@ int main(int argc, char* argv[])
     if (rankCpu == 0) std::cout << e.infoError() << std::endl;
   }
 
+  if (computingComm != MPI_COMM_WORLD) MPI_Comm_free(&computingComm);
   MPI_Barrier(MPI_COMM_WORLD);
   MPI_Finalize();
   std::cerr.rdbuf(strBackup);
@@ -29,6 +29,8 @@
 //  If not, see <http://www.gnu.org/licenses/>.
 
 #include "timeStats.h"
+#include "Parallel/Parallel.h"
+#include <algorithm>
 
 //***********************************************************************
 
@@ -47,6 +49,15 @@ void timeStats::initialize()
   m_computationTime   = 0;
   m_AMRTime           = 0;
   m_communicationTime = 0;
+  for (int s = 0; s < NUMBERSTAGES; s++) {
+    m_stageRefTime[s]         = 0.;
+    m_stageTime[s]            = 0.;
+    m_numberActiveCells[s]    = 0;
+    m_numberCandidateCells[s] = 0;
+  }
+  m_numberSuperTimeSteps      = 0;
+  m_numberSuperTimeStepStages = 0;
+  m_maxSuperTimeStepStages    = 0;
 }
 
 //***********************************************************************
@@ -61,7 +72,7 @@ void timeStats::updateComputationTime()
 
 void timeStats::startAMRTime()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
   m_AMRRefTime = MPI_Wtime();
 }
 
@@ -69,7 +80,7 @@ void timeStats::startAMRTime()
 
 void timeStats::endAMRTime()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
   m_AMRTime += (MPI_Wtime() - m_AMRRefTime);
 }
 
@@ -77,7 +88,7 @@ void timeStats::endAMRTime()
 
 void timeStats::startCommunicationTime()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
   m_communicationRefTime = MPI_Wtime();
 }
 
@@ -85,12 +96,47 @@ void timeStats::startCommunicationTime()
 
 void timeStats::endCommunicationTime()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(computingComm);
   m_communicationTime += (MPI_Wtime() - m_communicationRefTime);
 }
 
 //***********************************************************************
 
+std::string timeStats::getStageName(const TimeStage& stage)
+{
+  switch (stage) {
+  case HYPERBOLIC:
+    return "hyperbolic";
+    break;
+  case ADDPHYS:
+    return "additionalPhysics";
+    break;
+  case SOURCES:
+    return "sourceTerms";
+    break;
+  case RELAXATIONS:
+    return "relaxations";
+    break;
+  case OUTPUTS:
+    return "outputs";
+    break;
+  default:
+    return "unknown";
+    break;
+  }
+}
+
+//***********************************************************************
+
+void timeStats::addSuperTimeStep(const int& numberStages)
+{
+  m_numberSuperTimeSteps++;
+  m_numberSuperTimeStepStages += numberStages;
+  m_maxSuperTimeStepStages     = std::max(m_maxSuperTimeStepStages, numberStages);
+}
+
+//***********************************************************************
+
 void timeStats::setCompTime(const double& compTime, const double& AMRTime, const double& comTime)
 {
   m_computationTime   = compTime;
@@ -105,6 +151,10 @@ void timeStats::printScreenStats(const int& numTest) const
   printScreenTime(m_computationTime, "Elapsed time", numTest);
   printScreenTime(m_AMRTime, "AMR time", numTest);
   printScreenTime(m_communicationTime, "Communication time", numTest);
+  if (m_numberSuperTimeSteps > 0) {
+    std::cout << "T" << numTest << " |     Diffusive stages    = " << static_cast<double>(m_numberSuperTimeStepStages) / m_numberSuperTimeSteps
+              << " per step (max " << m_maxSuperTimeStepStages << ")" << std::endl;
+  }
 
   //Estimation temps restant
   //A faire...
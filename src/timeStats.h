@@ -36,6 +36,17 @@
 #include <mpi.h>
 #include <cmath>
 
+//! \brief     Enumeration for the stages of an iteration timed separately (performance analysis)
+enum TimeStage
+{
+  HYPERBOLIC   = 0,
+  ADDPHYS      = 1,
+  SOURCES      = 2,
+  RELAXATIONS  = 3,
+  OUTPUTS      = 4,
+  NUMBERSTAGES = 5
+};
+
 class timeStats
 {
   public:
@@ -51,6 +62,27 @@ class timeStats
     void startCommunicationTime();
     void endCommunicationTime();
 
+    //! \brief     Stage timers: local wall time (no synchronization), communications of the stage included
+    void startStageTime(const TimeStage& stage) { m_stageRefTime[stage] = MPI_Wtime(); };
+    void endStageTime(const TimeStage& stage) { m_stageTime[stage] += (MPI_Wtime() - m_stageRefTime[stage]); };
+    double getStageTime(const TimeStage& stage) const { return m_stageTime[stage]; };
+    static std::string getStageName(const TimeStage& stage);
+
+    //! \brief     Super time stepping of the diffusive additional physics: one call per advance of a level
+    void addSuperTimeStep(const int& numberStages);
+    long long getNumberSuperTimeSteps() const { return m_numberSuperTimeSteps; };
+    long long getNumberSuperTimeStepStages() const { return m_numberSuperTimeStepStages; };
+    int getMaxSuperTimeStepStages() const { return m_maxSuperTimeStepStages; };
+
+    //! \brief     Activity masks: cells worked on by a stage among its candidate (non-split) cells
+    void addActiveCells(const TimeStage& stage, const int& numberActive, const int& numberCandidates)
+    {
+      m_numberActiveCells[stage]    += numberActive;
+      m_numberCandidateCells[stage] += numberCandidates;
+    };
+    long long getNumberActiveCells(const TimeStage& stage) const { return m_numberActiveCells[stage]; };
+    long long getNumberCandidateCells(const TimeStage& stage) const { return m_numberCandidateCells[stage]; };
+
     void setCompTime(const double& compTime, const double& AMRTime, const double& comTime);
     double getComputationTime() const { return m_computationTime; };
     double getAMRTime() const { return m_AMRTime; };
@@ -69,6 +101,16 @@ class timeStats
 
     double m_communicationRefTime;
     double m_communicationTime; //!<Communication time among computational time
+
+    double m_stageRefTime[NUMBERSTAGES];
+    double m_stageTime[NUMBERSTAGES]; //!<Time spent in each stage of the iterations since the start of this run
+
+    long long m_numberSuperTimeSteps;      //!<Number of super time steps of the diffusive additional physics
+    long long m_numberSuperTimeStepStages; //!<Total number of stages of these super time steps
+    int m_maxSuperTimeStepStages;          //!<Largest number of stages of a super time step
+
+    long long m_numberActiveCells[NUMBERSTAGES];    //!<Cells worked on by the stages using activity masks (relaxations, sources, narrow band)
+    long long m_numberCandidateCells[NUMBERSTAGES]; //!<Non-split cells seen by these stages
     // clang-format on
 };
 